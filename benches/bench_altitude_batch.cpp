@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/// Altitude-curve benchmarks: batched `altitude_at` versus a per-instant loop.
+///
+/// Typical usage:
+///   const auto curve = siderust::altitude_at(
+///       siderust::Subject::body(siderust::Body::Sun), geo, start, step, count);
+
+#include <benchmark/benchmark.h>
+#include <siderust/siderust.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace siderust;
+using namespace qtty::literals;
+
+namespace {
+
+constexpr double kMinutesPerDay = 1440.0;
+
+std::vector<Time<TT, MJD>> minute_grid(const Time<TT, MJD> &start, std::size_t count) {
+  std::vector<Time<TT, MJD>> grid;
+  grid.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    grid.push_back(Time<TT, MJD>(start.value() + static_cast<double>(i) / kMinutesPerDay));
+  }
+  return grid;
+}
+
+std::size_t minutes_in_days(int64_t days) {
+  return static_cast<std::size_t>(days) * static_cast<std::size_t>(kMinutesPerDay);
+}
+
+void bench_altitude_loop(benchmark::State &state, Subject subj) {
+  const auto geo = ROQUE_DE_LOS_MUCHACHOS();
+  const auto start = Time<TT, MJD>::from_utc({2026, 1, 1, 0, 0, 0});
+  const auto grid = minute_grid(start, minutes_in_days(state.range(0)));
+  std::vector<qtty::Radian> out(grid.size());
+
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t i = 0; i < grid.size(); ++i) {
+      out[i] = altitude_at(subj, geo, grid[i]);
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(grid.size()));
+  state.counters["days"] = static_cast<double>(state.range(0));
+}
+
+void bench_altitude_span(benchmark::State &state, Subject subj) {
+  const auto geo = ROQUE_DE_LOS_MUCHACHOS();
+  const auto start = Time<TT, MJD>::from_utc({2026, 1, 1, 0, 0, 0});
+  const auto grid = minute_grid(start, minutes_in_days(state.range(0)));
+  std::vector<qtty::Radian> out(grid.size());
+
+  for (auto _ : state) {
+    (void)_;
+    altitude_at(subj, geo, grid, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(grid.size()));
+  state.counters["days"] = static_cast<double>(state.range(0));
+}
+
+void bench_altitude_grid(benchmark::State &state, Subject subj) {
+  const auto geo = ROQUE_DE_LOS_MUCHACHOS();
+  const auto start = Time<TT, MJD>::from_utc({2026, 1, 1, 0, 0, 0});
+  const std::size_t count = minutes_in_days(state.range(0));
+
+  for (auto _ : state) {
+    (void)_;
+    const auto out = altitude_at(subj, geo, start, qtty::Day(1.0 / kMinutesPerDay), count);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+  state.counters["days"] = static_cast<double>(state.range(0));
+}
+
+void register_altitude_batch_benchmarks() {
+  const struct {
+    const char *label;
+    Subject subj;
+  } subjects[] = {
+      {"sun", Subject::body(Body::Sun)},
+      {"vega", Subject::icrs(spherical::direction::ICRS(279.2348_deg, 38.7836_deg))},
+  };
+
+  for (const auto &s : subjects) {
+    const std::string suffix = std::string("/") + s.label;
+    benchmark::RegisterBenchmark(("altitude_at_loop" + suffix).c_str(), bench_altitude_loop,
+                                 s.subj)
+        ->Arg(1)
+        ->Arg(30)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("altitude_at_span" + suffix).c_str(), bench_altitude_span,
+                                 s.subj)
+        ->Arg(1)
+        ->Arg(30)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("altitude_at_grid" + suffix).c_str(), bench_altitude_grid,
+                                 s.subj)
+        ->Arg(1)
+        ->Arg(30)
+        ->Unit(benchmark::kMillisecond);
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_altitude_batch_benchmarks();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/// Compact-catalog benchmarks: decode throughput of `CompactCatalog` (8 or
+/// 16 bytes per star) against copying plain `spherical::direction::ICRS`
+/// values (16 bytes per star), plus the per-star memory footprint.
+///
+/// Typical usage:
+///   CompactCatalog gaia(epoch);
+///   gaia.decode(first, chunk, now);
+
+#include <benchmark/benchmark.h>
+#include <siderust/siderust.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+using namespace siderust;
+
+namespace {
+
+constexpr std::size_t kChunk = 4096;
+
+std::vector<spherical::direction::ICRS> sample_catalog(std::size_t n) {
+  std::vector<spherical::direction::ICRS> out;
+  out.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    // Golden-angle spiral: roughly uniform coverage of the sphere.
+    const double t = (static_cast<double>(i) + 0.5) / static_cast<double>(n);
+    out.emplace_back(qtty::Degree(std::fmod(137.50776405 * static_cast<double>(i), 360.0)),
+                     qtty::Degree(std::asin(2.0 * t - 1.0) * 180.0 / constants::pi));
+  }
+  return out;
+}
+
+CompactCatalog sample_compact(std::size_t n, bool with_pm) {
+  const auto dirs = sample_catalog(n);
+  CompactCatalog cat(Time<TT, JD>(2457389.0)); // J2016.0
+  cat.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    if (with_pm) {
+      const double mu = 5.0 * std::sin(static_cast<double>(i)); // mas/yr
+      cat.add(dirs[i], ProperMotion{AngularRate{qtty::Degree(mu / 3.6e6), qtty::Day(365.25)},
+                                    AngularRate{qtty::Degree(-mu / 3.6e6), qtty::Day(365.25)},
+                                    RaConvention::MuAlphaStar});
+    } else {
+      cat.add(dirs[i]);
+    }
+  }
+  return cat;
+}
+
+void bench_plain_copy(benchmark::State &state) {
+  const auto dirs = sample_catalog(static_cast<std::size_t>(state.range(0)));
+  std::vector<spherical::direction::ICRS> chunk(kChunk);
+
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t first = 0; first + kChunk <= dirs.size(); first += kChunk) {
+      std::copy_n(dirs.begin() + static_cast<std::ptrdiff_t>(first), kChunk, chunk.begin());
+      benchmark::DoNotOptimize(chunk.data());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes_per_star"] = sizeof(spherical::direction::ICRS);
+}
+
+void bench_compact_decode(benchmark::State &state) {
+  const auto cat = sample_compact(static_cast<std::size_t>(state.range(0)), false);
+  std::vector<spherical::direction::ICRS> chunk(kChunk);
+
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t first = 0; first + kChunk <= cat.size(); first += kChunk) {
+      cat.decode(first, chunk);
+      benchmark::DoNotOptimize(chunk.data());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes_per_star"] =
+      static_cast<double>(cat.memory_bytes()) / static_cast<double>(cat.size());
+}
+
+void bench_compact_propagate(benchmark::State &state) {
+  const auto cat = sample_compact(static_cast<std::size_t>(state.range(0)), true);
+  const Time<TT, JD> now(2461000.5);
+  cartesian::DirectionArray<frames::ICRS> chunk;
+
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t first = 0; first + kChunk <= cat.size(); first += kChunk) {
+      cat.decode(first, kChunk, chunk, now);
+      benchmark::DoNotOptimize(chunk.x().data());
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes_per_star"] =
+      static_cast<double>(cat.memory_bytes()) / static_cast<double>(cat.size());
+}
+
+void register_compact_catalog_benchmarks() {
+  const struct {
+    const char *name;
+    void (*fn)(benchmark::State &);
+  } cases[] = {
+      {"decode/plain", bench_plain_copy},
+      {"decode/compact", bench_compact_decode},
+      {"decode/compact_pm", bench_compact_propagate},
+  };
+
+  for (const auto &c : cases) {
+    benchmark::RegisterBenchmark(c.name, c.fn)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_compact_catalog_benchmarks();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/// Catalog-search benchmarks: a linear `angular_separation` scan versus the
+/// kd-tree in `direction_index.hpp`, plus serial and parallel index builds.
+///
+/// Typical usage:
+///   const DirectionIndex<frames::ICRS> index(stars);
+///   const auto hits = index.cone(center, qtty::Degree(0.5));
+
+#include <benchmark/benchmark.h>
+#include <siderust/siderust.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace siderust;
+
+namespace {
+
+std::vector<spherical::Direction<frames::ICRS>> sample_catalog(std::size_t n) {
+  std::vector<spherical::Direction<frames::ICRS>> out;
+  out.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    // Golden-angle spiral: roughly uniform coverage of the sphere.
+    const double t = (static_cast<double>(i) + 0.5) / static_cast<double>(n);
+    out.emplace_back(qtty::Degree(std::fmod(137.50776405 * static_cast<double>(i), 360.0)),
+                     qtty::Degree(std::asin(2.0 * t - 1.0) * 180.0 / constants::pi));
+  }
+  return out;
+}
+
+const spherical::Direction<frames::ICRS> kVega(qtty::Degree(279.2348), qtty::Degree(38.7836));
+const qtty::Degree kRadius(0.5);
+
+void bench_cone_linear(benchmark::State &state) {
+  const auto cat = sample_catalog(static_cast<std::size_t>(state.range(0)));
+  std::vector<std::size_t> hits;
+
+  for (auto _ : state) {
+    (void)_;
+    hits.clear();
+    for (std::size_t i = 0; i < cat.size(); ++i) {
+      if (cat[i].angular_separation(kVega).value() <= kRadius.value()) {
+        hits.push_back(i);
+      }
+    }
+    benchmark::DoNotOptimize(hits.data());
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void bench_cone_index(benchmark::State &state) {
+  const auto cat = sample_catalog(static_cast<std::size_t>(state.range(0)));
+  const DirectionIndex<frames::ICRS> index(cat);
+  const auto center = kVega.to_cartesian();
+  std::vector<DirectionMatch> hits;
+
+  for (auto _ : state) {
+    (void)_;
+    index.cone(center, kRadius, hits);
+    benchmark::DoNotOptimize(hits.data());
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void bench_build(benchmark::State &state) {
+  const auto cat = sample_catalog(static_cast<std::size_t>(state.range(0)));
+  const auto opts =
+      DirectionIndexOptions{}.with_parallelism(static_cast<std::size_t>(state.range(1)));
+
+  for (auto _ : state) {
+    (void)_;
+    const DirectionIndex<frames::ICRS> index(cat, opts);
+    benchmark::DoNotOptimize(index.size());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_cross_match(benchmark::State &state) {
+  const auto cat = sample_catalog(static_cast<std::size_t>(state.range(0)));
+  const auto queries = sample_catalog(static_cast<std::size_t>(state.range(0)) / 10);
+  const DirectionIndex<frames::ICRS> index(cat);
+  const auto threads = static_cast<std::size_t>(state.range(1));
+
+  for (auto _ : state) {
+    (void)_;
+    const auto pairs = index.cross_match(queries, qtty::Degree(0.05), threads);
+    benchmark::DoNotOptimize(pairs.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(queries.size()));
+}
+
+void register_direction_index_benchmarks() {
+  struct Case {
+    const char *name;
+    void (*fn)(benchmark::State &);
+  };
+
+  const Case queries[] = {{"cone/linear", bench_cone_linear}, {"cone/index", bench_cone_index}};
+  for (const auto &c : queries) {
+    benchmark::RegisterBenchmark(c.name, c.fn)
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMicrosecond);
+  }
+
+  const Case threaded[] = {{"build", bench_build}, {"cross_match", bench_cross_match}};
+  for (const auto &c : threaded) {
+    benchmark::RegisterBenchmark(c.name, c.fn)
+        ->Args({1 << 20, 1})
+        ->Args({1 << 20, 4})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_direction_index_benchmarks();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
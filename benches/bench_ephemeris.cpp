@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/// Ephemeris benchmarks: epochs per second for a 10-year daily VSOP87 /
+/// ELP2000 series, evaluated one epoch per call against the series
+/// overloads (serial and on every core) and an `EphemerisCache` fitted over
+/// the same span.
+///
+/// Typical usage:
+///   cartesian::PositionArray<centers::Heliocentric, frames::EclipticMeanJ2000, AU> mars;
+///   ephemeris::mars_heliocentric(days, mars, 0);
+///   const EphemerisCache cache(bodies, days.front(), days.back());
+
+#include <benchmark/benchmark.h>
+#include <siderust/siderust.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace siderust;
+
+namespace {
+
+constexpr std::size_t kDays = 3653; // 10 years, daily
+
+std::vector<Time<TT, JD>> daily_epochs() {
+  std::vector<Time<TT, JD>> out;
+  out.reserve(kDays);
+  for (std::size_t i = 0; i < kDays; ++i) {
+    out.push_back(Time<TT, JD>(2460676.5 + static_cast<double>(i))); // from 2025-01-01
+  }
+  return out;
+}
+
+template <typename Pos, Pos (*Single)(const Time<TT, JD> &)>
+void bench_per_call(benchmark::State &state) {
+  const auto jd = daily_epochs();
+  std::vector<Pos> out(jd.size());
+
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t i = 0; i < jd.size(); ++i) {
+      out[i] = Single(jd[i]);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(jd.size()));
+}
+
+template <typename Pos, void (*Series)(span<const Time<TT, JD>>, span<Pos>, std::size_t)>
+void bench_series(benchmark::State &state) {
+  const auto jd = daily_epochs();
+  std::vector<Pos> out(jd.size());
+  const auto threads = static_cast<std::size_t>(state.range(0));
+
+  for (auto _ : state) {
+    (void)_;
+    Series(jd, out, threads);
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(jd.size()));
+}
+
+template <Body B> void bench_cache(benchmark::State &state) {
+  const auto jd = daily_epochs();
+  const Body bodies[] = {B};
+  const EphemerisCache cache(bodies, jd.front(), jd.back());
+  std::vector<EphemerisCache::Position> out(jd.size());
+
+  for (auto _ : state) {
+    (void)_;
+    cache.geocentric(B, jd, out);
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(jd.size()));
+  state.counters["bytes_per_year"] = cache.bytes_per_year();
+  state.counters["fit_error_m"] = cache.fit_error(B).value() * 1e3;
+}
+
+template <Body B> void bench_cache_build(benchmark::State &state) {
+  const auto jd = daily_epochs();
+  const Body bodies[] = {B};
+
+  for (auto _ : state) {
+    (void)_;
+    const EphemerisCache cache(bodies, jd.front(), jd.back());
+    benchmark::DoNotOptimize(&cache);
+  }
+}
+
+using Helio = cartesian::position::EclipticMeanJ2000<qtty::AstronomicalUnit>;
+using Bary = cartesian::position::HelioBarycentric<qtty::AstronomicalUnit>;
+using Moon = cartesian::position::MoonGeocentric<qtty::Kilometer>;
+
+void register_ephemeris_benchmarks() {
+  const struct {
+    const char *name;
+    void (*per_call)(benchmark::State &);
+    void (*series)(benchmark::State &);
+  } cases[] = {
+      {"earth_heliocentric", bench_per_call<Helio, ephemeris::earth_heliocentric>,
+       bench_series<Helio, ephemeris::earth_heliocentric>},
+      {"mars_heliocentric", bench_per_call<Helio, ephemeris::mars_heliocentric>,
+       bench_series<Helio, ephemeris::mars_heliocentric>},
+      {"jupiter_barycentric", bench_per_call<Bary, ephemeris::jupiter_barycentric>,
+       bench_series<Bary, ephemeris::jupiter_barycentric>},
+      {"neptune_barycentric", bench_per_call<Bary, ephemeris::neptune_barycentric>,
+       bench_series<Bary, ephemeris::neptune_barycentric>},
+      {"moon_geocentric", bench_per_call<Moon, ephemeris::moon_geocentric>,
+       bench_series<Moon, ephemeris::moon_geocentric>},
+  };
+
+  for (const auto &c : cases) {
+    benchmark::RegisterBenchmark((std::string("per_call/") + c.name).c_str(), c.per_call)
+        ->Unit(benchmark::kMillisecond);
+    // 1 = serial series, 0 = hardware concurrency.
+    benchmark::RegisterBenchmark((std::string("series/") + c.name).c_str(), c.series)
+        ->Arg(1)
+        ->Arg(0)
+        ->Unit(benchmark::kMillisecond);
+  }
+
+  // Geocentric positions from a cache fitted over the same ten years.
+  const struct {
+    const char *name;
+    void (*eval)(benchmark::State &);
+    void (*build)(benchmark::State &);
+  } cached[] = {
+      {"sun", bench_cache<Body::Sun>, bench_cache_build<Body::Sun>},
+      {"mars", bench_cache<Body::Mars>, bench_cache_build<Body::Mars>},
+      {"jupiter", bench_cache<Body::Jupiter>, bench_cache_build<Body::Jupiter>},
+      {"moon", bench_cache<Body::Moon>, bench_cache_build<Body::Moon>},
+  };
+
+  for (const auto &c : cached) {
+    benchmark::RegisterBenchmark((std::string("cache/") + c.name).c_str(), c.eval)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark((std::string("cache_build/") + c.name).c_str(), c.build)
+        ->Unit(benchmark::kMillisecond);
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_ephemeris_benchmarks();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/// Concurrent ephemeris reads: 1–32 threads querying one shared
+/// `RuntimeEphemeris` directly against one `RuntimeEphemeris::Reader` per
+/// thread, each scanning ten years in hourly steps. The `budget` rows query a
+/// shared kernel paged through a 4 MiB record LRU, so every call goes through
+/// the cache lock and misses read the file.
+///
+/// The kernel is taken from `SIDERUST_BSP`; without it a DE440-shaped
+/// synthetic kernel (Sun, EMB, Earth and Moon over 2000–2050, with DE440
+/// record lengths and coefficient counts) is written to the temp directory.
+///
+/// Typical usage:
+///   const RuntimeEphemeris de440(
+///       path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+///   auto reader = de440.reader(); // one per worker thread
+///   const auto moon = reader.moon_geocentric(jd);
+
+#include <benchmark/benchmark.h>
+#include <siderust/siderust.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace siderust;
+
+namespace {
+
+constexpr std::size_t kSteps = 10 * 8766; // 10 years, hourly
+
+struct SyntheticSegment {
+  std::int32_t target;
+  std::int32_t center;
+  double interval_days;
+  std::size_t ncoef;
+};
+
+/// Write a little-endian DAF/SPK with type-2 segments over 2000–2050.
+std::string write_synthetic_kernel() {
+  const SyntheticSegment segs[] = {
+      {spk::naif::Sun, spk::naif::SolarSystemBarycenter, 16.0, 11},
+      {spk::naif::EarthMoonBarycenter, spk::naif::SolarSystemBarycenter, 16.0, 13},
+      {spk::naif::Earth, spk::naif::EarthMoonBarycenter, 4.0, 13},
+      {spk::naif::Moon, spk::naif::EarthMoonBarycenter, 4.0, 13},
+  };
+  const double start = 0.0;              // J2000
+  const double span = 18262.0 * 86400.0; // 50 years
+
+  std::vector<std::uint8_t> buf(3 * 1024, 0);
+  const auto put_i32 = [&](std::size_t off, std::int32_t v) { std::memcpy(&buf[off], &v, 4); };
+  const auto put_f64 = [&](std::size_t off, double v) { std::memcpy(&buf[off], &v, 8); };
+  std::memcpy(buf.data(), "DAF/SPK ", 8);
+  put_i32(8, 2);
+  put_i32(12, 6);
+  put_i32(76, 2);
+  put_i32(80, 2);
+  std::memcpy(buf.data() + 88, "LTL-IEEE", 8);
+  put_f64(1024 + 16, static_cast<double>(std::size(segs)));
+
+  std::size_t i = 0;
+  for (const auto &s : segs) {
+    const double interval = s.interval_days * 86400.0;
+    const auto records = static_cast<std::size_t>(span / interval);
+    const std::size_t rsize = 2 + 3 * s.ncoef;
+    std::vector<double> words;
+    words.reserve(records * rsize + 4);
+    for (std::size_t r = 0; r < records; ++r) {
+      words.push_back(start + (static_cast<double>(r) + 0.5) * interval);
+      words.push_back(0.5 * interval);
+      for (std::size_t c = 0; c < 3; ++c) {
+        for (std::size_t k = 0; k < s.ncoef; ++k)
+          words.push_back(k == 0 ? 1.0e8 * static_cast<double>(c + 1) : 1.0e3 / (k * k + 1.0));
+      }
+    }
+    words.insert(words.end(), {start, interval, static_cast<double>(rsize),
+                               static_cast<double>(records)});
+
+    const std::size_t begin = buf.size() / 8 + 1;
+    const std::size_t off = buf.size();
+    buf.resize(off + words.size() * 8);
+    std::memcpy(&buf[off], words.data(), words.size() * 8);
+
+    const std::size_t sum = 1024 + 24 + i++ * 40;
+    put_f64(sum, start);
+    put_f64(sum + 8, start + interval * static_cast<double>(records));
+    put_i32(sum + 16, s.target);
+    put_i32(sum + 20, s.center);
+    put_i32(sum + 24, spk::frame::J2000);
+    put_i32(sum + 28, 2);
+    put_i32(sum + 32, static_cast<std::int32_t>(begin));
+    put_i32(sum + 36, static_cast<std::int32_t>(begin + words.size() - 1));
+  }
+
+  const auto path = (std::filesystem::temp_directory_path() / "siderust_bench_de.bsp").string();
+  std::ofstream(path, std::ios::binary)
+      .write(reinterpret_cast<const char *>(buf.data()), static_cast<std::streamsize>(buf.size()));
+  return path;
+}
+
+const std::string &kernel_path() {
+  static const std::string path = [] {
+    const char *env = std::getenv("SIDERUST_BSP");
+    return env ? std::string(env) : write_synthetic_kernel();
+  }();
+  return path;
+}
+
+const RuntimeEphemeris &shared_ephemeris() {
+  static const RuntimeEphemeris eph(
+      kernel_path(), RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+  return eph;
+}
+
+const RuntimeEphemeris &budgeted_ephemeris() {
+  static const RuntimeEphemeris eph(kernel_path(),
+                                    RuntimeEphemerisOptions()
+                                        .with_bodies({spk::naif::Earth, spk::naif::Moon})
+                                        .with_memory_budget(std::size_t{4} << 20));
+  return eph;
+}
+
+/// Hourly epochs from 2025-01-01, offset per thread so threads do not
+/// share records in lock step.
+Time<TT, JD> epoch(std::size_t i, int thread) {
+  return Time<TT, JD>(2460676.5 + static_cast<double>(i) / 24.0 + 3.7 * thread);
+}
+
+void scan_shared(benchmark::State &state, const RuntimeEphemeris &eph) {
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t i = 0; i < kSteps; ++i) {
+      const auto t = epoch(i, state.thread_index());
+      auto e = eph.earth_barycentric(t);
+      auto m = eph.moon_geocentric(t);
+      benchmark::DoNotOptimize(e);
+      benchmark::DoNotOptimize(m);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(kSteps));
+}
+
+void bench_shared(benchmark::State &state) { scan_shared(state, shared_ephemeris()); }
+
+void bench_budget(benchmark::State &state) { scan_shared(state, budgeted_ephemeris()); }
+
+void bench_reader(benchmark::State &state) {
+  auto reader = shared_ephemeris().reader();
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t i = 0; i < kSteps; ++i) {
+      const auto t = epoch(i, state.thread_index());
+      auto e = reader.earth_barycentric(t);
+      auto m = reader.moon_geocentric(t);
+      benchmark::DoNotOptimize(e);
+      benchmark::DoNotOptimize(m);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(kSteps));
+  const double lookups = static_cast<double>(reader.hits() + reader.misses());
+  state.counters["hit_rate"] = benchmark::Counter(
+      lookups > 0 ? static_cast<double>(reader.hits()) / lookups : 0.0,
+      benchmark::Counter::kAvgThreads);
+}
+
+void register_ephemeris_threads_benchmarks() {
+  const struct {
+    const char *name;
+    void (*fn)(benchmark::State &);
+  } cases[] = {
+      {"shared", bench_shared},
+      {"reader", bench_reader},
+      {"budget", bench_budget},
+  };
+
+  for (const auto &c : cases) {
+    for (int threads : {1, 2, 4, 8, 16, 32}) {
+      benchmark::RegisterBenchmark(c.name, c.fn)
+          ->Threads(threads)
+          ->UseRealTime()
+          ->Unit(benchmark::kMillisecond);
+    }
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_ephemeris_threads_benchmarks();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/// Frame-transform benchmarks: per-call FFI transforms versus a shared context,
+/// a precomputed `FrameRotation`, a cached `HorizontalProjector` and an
+/// epoch-interpolated rotation along a dense track.
+///
+/// Typical usage:
+///   const siderust::AstroContext ctx(siderust::EarthOrientationModel::Iau2006A);
+///   auto ecl = dir.to_frame_with<siderust::frames::EclipticMeanJ2000>(jd, ctx);
+
+#include <benchmark/benchmark.h>
+#include <siderust/siderust.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+using namespace siderust;
+
+namespace {
+
+constexpr std::size_t kDirections = 1024;
+
+std::vector<cartesian::Direction<frames::ICRS>> sample_directions() {
+  std::vector<cartesian::Direction<frames::ICRS>> dirs;
+  dirs.reserve(kDirections);
+  for (std::size_t i = 0; i < kDirections; ++i) {
+    const double ra = 2.0 * constants::pi * static_cast<double>(i) / kDirections;
+    const double dec = std::asin(2.0 * (static_cast<double>(i) + 0.5) / kDirections - 1.0);
+    dirs.emplace_back(std::cos(dec) * std::cos(ra), std::cos(dec) * std::sin(ra), std::sin(dec));
+  }
+  return dirs;
+}
+
+/// Previous behaviour: one `siderust_context_t` created and freed per call.
+void bench_to_frame_per_call_context(benchmark::State &state) {
+  const auto dirs = sample_directions();
+  const AstroContext ctx(EarthOrientationModel::Iau2006A);
+  const Time<TT, JD> jd(2461041.5);
+
+  for (auto _ : state) {
+    (void)_;
+    for (const auto &d : dirs) {
+      detail::OwnedFfiContext fctx(ctx);
+      siderust_cartesian_pos_t out{};
+      check_status(siderust_cartesian_dir_transform_frame_with_context(
+                       d.x, d.y, d.z, frames::FrameTraits<frames::ICRS>::ffi_id,
+                       frames::FrameTraits<frames::EclipticMeanJ2000>::ffi_id, jd.value(),
+                       fctx.get(), &out),
+                   "bench_to_frame_per_call_context");
+      benchmark::DoNotOptimize(out);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(dirs.size()));
+}
+
+void bench_to_frame_with(benchmark::State &state) {
+  const auto dirs = sample_directions();
+  const AstroContext ctx(EarthOrientationModel::Iau2006A);
+  const Time<TT, JD> jd(2461041.5);
+
+  for (auto _ : state) {
+    (void)_;
+    for (const auto &d : dirs) {
+      auto out = d.to_frame_with<frames::EclipticMeanJ2000>(jd, ctx);
+      benchmark::DoNotOptimize(out);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(dirs.size()));
+}
+
+void bench_to_frame(benchmark::State &state) {
+  const auto dirs = sample_directions();
+  const Time<TT, JD> jd(2461041.5);
+
+  for (auto _ : state) {
+    (void)_;
+    for (const auto &d : dirs) {
+      auto out = d.to_frame<frames::EclipticMeanJ2000>(jd);
+      benchmark::DoNotOptimize(out);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(dirs.size()));
+}
+
+void bench_frame_rotation(benchmark::State &state) {
+  const auto dirs = sample_directions();
+  std::vector<cartesian::Direction<frames::EclipticMeanJ2000>> out(dirs.size());
+  const Time<TT, JD> jd(2461041.5);
+
+  for (auto _ : state) {
+    (void)_;
+    const auto rot = FrameRotation<frames::ICRS, frames::EclipticMeanJ2000>::at(jd);
+    rot.apply(dirs, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(dirs.size()));
+}
+
+std::vector<spherical::Direction<frames::ICRS>> sample_spherical_directions() {
+  const auto sph = to_spherical(cartesian::DirectionArray<frames::ICRS>(sample_directions()));
+  std::vector<spherical::Direction<frames::ICRS>> out;
+  out.reserve(sph.size());
+  for (std::size_t i = 0; i < sph.size(); ++i) {
+    out.push_back(sph[i]);
+  }
+  return out;
+}
+
+void bench_to_horizontal(benchmark::State &state) {
+  const auto dirs = sample_spherical_directions();
+  const Geodetic site(-17.8925, 28.7543, 2396.0);
+  const Time<TT, JD> jd(2461041.5);
+
+  for (auto _ : state) {
+    (void)_;
+    for (const auto &d : dirs) {
+      auto out = d.to_horizontal(jd, site);
+      benchmark::DoNotOptimize(out);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(dirs.size()));
+}
+
+void bench_horizontal_projector(benchmark::State &state) {
+  const auto dirs = sample_spherical_directions();
+  std::vector<spherical::Direction<frames::Horizontal>> out(dirs.size());
+  const Geodetic site(-17.8925, 28.7543, 2396.0);
+  const Time<TT, JD> jd(2461041.5);
+
+  for (auto _ : state) {
+    (void)_;
+    const HorizontalProjector<frames::ICRS> proj(site, jd);
+    proj.project(dirs, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(dirs.size()));
+}
+
+/// Ten minutes of a 10 Hz telescope track, one direction per sample.
+constexpr std::size_t kTrackSamples = 6000;
+constexpr double kTrackStep = 0.1 / 86400.0;
+
+void bench_track_to_frame(benchmark::State &state) {
+  const cartesian::Direction<frames::ICRS> dir(0.36, 0.48, 0.8);
+  const double t0 = 2461041.5;
+
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t i = 0; i < kTrackSamples; ++i) {
+      auto out = dir.to_frame<frames::EquatorialTrueOfDate>(
+          Time<TT, JD>(t0 + kTrackStep * static_cast<double>(i)));
+      benchmark::DoNotOptimize(out);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kTrackSamples));
+}
+
+void bench_track_interpolated(benchmark::State &state) {
+  const cartesian::Direction<frames::ICRS> dir(0.36, 0.48, 0.8);
+  const double t0 = 2461041.5;
+  const Time<TT, JD> t1(t0 + kTrackStep * static_cast<double>(kTrackSamples));
+
+  for (auto _ : state) {
+    (void)_;
+    const auto rot = interpolate_frame_rotation<frames::ICRS, frames::EquatorialTrueOfDate>(
+        Time<TT, JD>(t0), t1);
+    for (std::size_t i = 0; i < kTrackSamples; ++i) {
+      auto out = rot.apply(Time<TT, JD>(t0 + kTrackStep * static_cast<double>(i)), dir);
+      benchmark::DoNotOptimize(out);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kTrackSamples));
+}
+
+void register_frame_context_benchmarks() {
+  benchmark::RegisterBenchmark("to_frame_with/per_call_context", bench_to_frame_per_call_context)
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("to_frame_with/shared_context", bench_to_frame_with)
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("to_frame/default", bench_to_frame)->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("to_frame/frame_rotation", bench_frame_rotation)
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("to_horizontal/per_call", bench_to_horizontal)
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("to_horizontal/projector", bench_horizontal_projector)
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("track/to_frame", bench_track_to_frame)
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("track/interpolated", bench_track_interpolated)
+      ->Unit(benchmark::kMicrosecond);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_frame_context_benchmarks();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/// WGS84 conversion benchmarks: `Geodetic::to_cartesian()` (one FFI call per
+/// point) versus the header-only `geodetic_to_ecef` / `ecef_to_geodetic`
+/// batch kernels in `coordinates/conversions.hpp`.
+///
+/// Typical usage:
+///   geodetic_to_ecef(track, ecef);
+///   ecef_to_geodetic(ecef, track);
+
+#include <benchmark/benchmark.h>
+#include <siderust/siderust.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+using namespace siderust;
+
+namespace {
+
+/// A ground track with altitudes from sea level up to low Earth orbit.
+std::vector<Geodetic> sample_track(std::size_t n) {
+  std::vector<Geodetic> out;
+  out.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double t = static_cast<double>(i) / static_cast<double>(n);
+    out.emplace_back(std::fmod(7200.0 * t, 360.0) - 180.0, 51.6 * std::sin(40.0 * t),
+                     4.0e5 * std::fabs(std::sin(3.0 * t)));
+  }
+  return out;
+}
+
+void bench_forward_per_call(benchmark::State &state) {
+  const auto track = sample_track(static_cast<std::size_t>(state.range(0)));
+  std::vector<cartesian::position::ECEF<qtty::Meter>> out(track.size());
+
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t i = 0; i < track.size(); ++i) {
+      out[i] = track[i].to_cartesian();
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_forward_batch(benchmark::State &state) {
+  const auto track = sample_track(static_cast<std::size_t>(state.range(0)));
+  std::vector<cartesian::position::ECEF<qtty::Meter>> out(track.size());
+
+  for (auto _ : state) {
+    (void)_;
+    geodetic_to_ecef(track, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_inverse_batch(benchmark::State &state) {
+  const auto ecef = geodetic_to_ecef(sample_track(static_cast<std::size_t>(state.range(0))));
+  std::vector<Geodetic> out(ecef.size());
+
+  for (auto _ : state) {
+    (void)_;
+    ecef_to_geodetic(ecef, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void register_geodetic_benchmarks() {
+  const struct {
+    const char *name;
+    void (*fn)(benchmark::State &);
+  } cases[] = {
+      {"geodetic_to_ecef/per_call", bench_forward_per_call},
+      {"geodetic_to_ecef/batch", bench_forward_batch},
+      {"ecef_to_geodetic/batch", bench_inverse_batch},
+  };
+
+  for (const auto &c : cases) {
+    benchmark::RegisterBenchmark(c.name, c.fn)
+        ->Arg(1 << 16)
+        ->Arg(1 << 22)
+        ->Unit(benchmark::kMillisecond);
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_geodetic_benchmarks();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -9,10 +9,15 @@
 ///
 /// Target: a 6-month window completes in under 0.5 s on a typical desktop CPU
 /// (Release build, -O2 or better).
+///
+/// Each case runs with 1, 2, 4 and 8 threads via
+/// `SearchOptions::with_parallelism`; wall-clock time is reported.
 
 #include <benchmark/benchmark.h>
 #include <siderust/siderust.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 using namespace siderust;
@@ -32,66 +37,83 @@ constexpr HorizonCase kHorizons[] = {
     {"astronomical", qtty::Degree(-18.0)},
 };
 
+constexpr int64_t kWindowDays[] = {30, 184, 365};
+constexpr int64_t kThreadCounts[] = {1, 2, 4, 8};
+
 Period<TT, MJD> window_from_days(const Time<TT, MJD> &start, int days) {
   return Period<TT, MJD>(start, start + qtty::Day(static_cast<double>(days)));
 }
 
+SearchOptions options_from_threads(int64_t threads) {
+  SearchOptions opts;
+  opts.with_parallelism(static_cast<std::size_t>(threads));
+  return opts;
+}
+
 void bench_sun_altitude_ranges(benchmark::State &state, qtty::Degree horizon) {
   const auto geo = ROQUE_DE_LOS_MUCHACHOS();
   const auto start = Time<TT, MJD>::from_utc({2026, 1, 1, 0, 0, 0});
   const auto window = window_from_days(start, static_cast<int>(state.range(0)));
+  const auto opts = options_from_threads(state.range(1));
 
   for (auto _ : state) {
     (void)_; // avoid "unused variable" warning
-    const auto nights = sun::altitude_ranges(geo, window, qtty::Degree(-90.0), horizon);
+    const auto nights = sun::altitude_ranges(geo, window, qtty::Degree(-90.0), horizon, opts);
     benchmark::DoNotOptimize(nights.data());
     benchmark::ClobberMemory();
   }
 
   state.SetItemsProcessed(state.iterations());
   state.counters["days"] = static_cast<double>(state.range(0));
+  state.counters["threads"] = static_cast<double>(state.range(1));
 }
 
 void bench_sun_below_threshold(benchmark::State &state, qtty::Degree horizon) {
   const auto geo = ROQUE_DE_LOS_MUCHACHOS();
   const auto start = Time<TT, MJD>::from_utc({2026, 1, 1, 0, 0, 0});
   const auto window = window_from_days(start, static_cast<int>(state.range(0)));
+  const auto opts = options_from_threads(state.range(1));
 
   for (auto _ : state) {
     (void)_; // avoid "unused variable" warning
-    const auto nights = sun::below_threshold(geo, window, horizon);
+    const auto nights = sun::below_threshold(geo, window, horizon, opts);
     benchmark::DoNotOptimize(nights.data());
     benchmark::ClobberMemory();
   }
 
   state.SetItemsProcessed(state.iterations());
   state.counters["days"] = static_cast<double>(state.range(0));
+  state.counters["threads"] = static_cast<double>(state.range(1));
 }
 
 void bench_moon_above_threshold(benchmark::State &state, qtty::Degree horizon) {
   const auto geo = ROQUE_DE_LOS_MUCHACHOS();
   const auto start = Time<TT, MJD>::from_utc({2026, 1, 1, 0, 0, 0});
   const auto window = window_from_days(start, static_cast<int>(state.range(0)));
+  const auto opts = options_from_threads(state.range(1));
 
   for (auto _ : state) {
     (void)_; // avoid "unused variable" warning
-    const auto periods = moon::above_threshold(geo, window, horizon);
+    const auto periods = moon::above_threshold(geo, window, horizon, opts);
     benchmark::DoNotOptimize(periods.data());
     benchmark::ClobberMemory();
   }
 
   state.SetItemsProcessed(state.iterations());
   state.counters["days"] = static_cast<double>(state.range(0));
+  state.counters["threads"] = static_cast<double>(state.range(1));
 }
 
 void register_horizon_benchmarks(const char *api, void (*fn)(benchmark::State &, qtty::Degree)) {
   for (const auto &horizon : kHorizons) {
     const std::string name = std::string(api) + "/" + horizon.label;
-    benchmark::RegisterBenchmark(name.c_str(), fn, horizon.threshold)
-        ->Arg(30)
-        ->Arg(184)
-        ->Arg(365)
-        ->Unit(benchmark::kMillisecond);
+    auto *bench = benchmark::RegisterBenchmark(name.c_str(), fn, horizon.threshold);
+    for (const int64_t days : kWindowDays) {
+      for (const int64_t threads : kThreadCounts) {
+        bench->Args({days, threads});
+      }
+    }
+    bench->Unit(benchmark::kMillisecond)->UseRealTime();
   }
 }
 
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/// Heap-allocation benchmarks: vector-returning searches versus result sinks.
+///
+/// Typical usage:
+///   std::vector<siderust::Period<siderust::TT, siderust::MJD>> buffer;
+///   siderust::above_threshold(subj, geo, window, threshold, buffer);
+///
+/// Global `operator new` is replaced so every C++ heap allocation made while
+/// the timed loop runs is counted; `allocs_per_query` is that count divided by
+/// the number of iterations. Allocations made by the Rust library through its
+/// own allocator are not visible here.
+
+#include <benchmark/benchmark.h>
+#include <siderust/siderust.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+std::atomic<std::size_t> g_allocations{0};
+} // namespace
+
+void *operator new(std::size_t size) {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *p = std::malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+using namespace siderust;
+
+namespace {
+
+Period<TT, MJD> one_day_window() {
+  const auto start = Time<TT, MJD>::from_utc({2026, 1, 1, 0, 0, 0});
+  return Period<TT, MJD>(start, Time<TT, MJD>(start.value() + 1.0));
+}
+
+template <typename Query> void run_counted(benchmark::State &state, Query query) {
+  query(); // warm up buffers and lazily initialised state
+
+  const std::size_t before = g_allocations.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    (void)_;
+    query();
+  }
+  const std::size_t after = g_allocations.load(std::memory_order_relaxed);
+
+  state.counters["allocs_per_query"] =
+      static_cast<double>(after - before) / static_cast<double>(state.iterations());
+}
+
+void bench_above_threshold_vector(benchmark::State &state, Subject subj) {
+  const auto geo = ROQUE_DE_LOS_MUCHACHOS();
+  const auto window = one_day_window();
+  run_counted(state, [&] {
+    auto periods = above_threshold(subj, geo, window, qtty::Degree(0.0));
+    benchmark::DoNotOptimize(periods.data());
+  });
+}
+
+void bench_above_threshold_buffer(benchmark::State &state, Subject subj) {
+  const auto geo = ROQUE_DE_LOS_MUCHACHOS();
+  const auto window = one_day_window();
+  std::vector<Period<TT, MJD>> buffer;
+  run_counted(state, [&] {
+    above_threshold(subj, geo, window, qtty::Degree(0.0), buffer);
+    benchmark::DoNotOptimize(buffer.data());
+  });
+}
+
+void bench_crossings_vector(benchmark::State &state, Subject subj) {
+  const auto geo = ROQUE_DE_LOS_MUCHACHOS();
+  const auto window = one_day_window();
+  run_counted(state, [&] {
+    auto events = crossings(subj, geo, window, qtty::Degree(0.0));
+    benchmark::DoNotOptimize(events.data());
+  });
+}
+
+void bench_crossings_callback(benchmark::State &state, Subject subj) {
+  const auto geo = ROQUE_DE_LOS_MUCHACHOS();
+  const auto window = one_day_window();
+  double last = 0.0;
+  run_counted(state, [&] {
+    crossings(subj, geo, window, qtty::Degree(0.0),
+              [&last](const CrossingEvent &ev) { last = ev.time.value(); });
+    benchmark::DoNotOptimize(last);
+  });
+}
+
+void register_search_allocation_benchmarks() {
+  const struct {
+    const char *label;
+    Subject subj;
+  } subjects[] = {
+      {"sun", Subject::body(Body::Sun)},
+      {"vega", Subject::icrs(spherical::direction::ICRS(qtty::Degree(279.2348),
+                                                        qtty::Degree(38.7836)))},
+  };
+
+  for (const auto &s : subjects) {
+    const std::string suffix = std::string("/") + s.label;
+    benchmark::RegisterBenchmark(("above_threshold_vector" + suffix).c_str(),
+                                 bench_above_threshold_vector, s.subj)
+        ->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark(("above_threshold_buffer" + suffix).c_str(),
+                                 bench_above_threshold_buffer, s.subj)
+        ->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark(("crossings_vector" + suffix).c_str(), bench_crossings_vector,
+                                 s.subj)
+        ->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark(("crossings_callback" + suffix).c_str(),
+                                 bench_crossings_callback, s.subj)
+        ->Unit(benchmark::kMicrosecond);
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_search_allocation_benchmarks();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
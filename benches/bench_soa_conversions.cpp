@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/// Catalog-conversion benchmarks: array-of-structs loops versus the
+/// structure-of-arrays kernels in `coordinates/arrays.hpp`.
+///
+/// Typical usage:
+///   const spherical::DirectionArray<frames::ICRS> catalog(stars);
+///   const auto unit = siderust::to_cartesian(catalog);
+///
+/// The SoA conversion kernels vectorise in a default `Release` build; the AoS
+/// rows are the scalar `std::sin`/`std::atan2` baseline.
+
+#include <benchmark/benchmark.h>
+#include <siderust/siderust.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace siderust;
+
+namespace {
+
+std::vector<spherical::Direction<frames::ICRS>> sample_catalog(std::size_t n) {
+  std::vector<spherical::Direction<frames::ICRS>> out;
+  out.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    // Golden-angle spiral: roughly uniform coverage of the sphere.
+    const double t = (static_cast<double>(i) + 0.5) / static_cast<double>(n);
+    out.emplace_back(qtty::Degree(std::fmod(137.50776405 * static_cast<double>(i), 360.0)),
+                     qtty::Degree(std::asin(2.0 * t - 1.0) * 180.0 / constants::pi));
+  }
+  return out;
+}
+
+void bench_to_cartesian_aos(benchmark::State &state) {
+  const auto aos = sample_catalog(static_cast<std::size_t>(state.range(0)));
+  std::vector<cartesian::Direction<frames::ICRS>> out(aos.size());
+
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t i = 0; i < aos.size(); ++i) {
+      out[i] = aos[i].to_cartesian();
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_to_cartesian_soa(benchmark::State &state) {
+  const spherical::DirectionArray<frames::ICRS> soa(
+      sample_catalog(static_cast<std::size_t>(state.range(0))));
+  cartesian::DirectionArray<frames::ICRS> out;
+
+  for (auto _ : state) {
+    (void)_;
+    to_cartesian(soa, out);
+    benchmark::DoNotOptimize(out.x().data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_to_spherical_aos(benchmark::State &state) {
+  const auto cart = to_cartesian(spherical::DirectionArray<frames::ICRS>(
+      sample_catalog(static_cast<std::size_t>(state.range(0)))));
+  std::vector<cartesian::Direction<frames::ICRS>> aos(cart.size());
+  for (std::size_t i = 0; i < cart.size(); ++i) {
+    aos[i] = cart[i];
+  }
+  std::vector<spherical::Direction<frames::ICRS>> out(aos.size());
+
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t i = 0; i < aos.size(); ++i) {
+      const auto &v = aos[i];
+      const double ra = std::atan2(v.y, v.x) * 180.0 / constants::pi;
+      out[i] = spherical::Direction<frames::ICRS>(
+          qtty::Degree(ra < 0.0 ? ra + 360.0 : ra),
+          qtty::Degree(std::atan2(v.z, std::hypot(v.x, v.y)) * 180.0 / constants::pi));
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_to_spherical_soa(benchmark::State &state) {
+  const auto cart = to_cartesian(spherical::DirectionArray<frames::ICRS>(
+      sample_catalog(static_cast<std::size_t>(state.range(0)))));
+  spherical::DirectionArray<frames::ICRS> out;
+
+  for (auto _ : state) {
+    (void)_;
+    to_spherical(cart, out);
+    benchmark::DoNotOptimize(out.azimuth().data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_separation_aos(benchmark::State &state) {
+  const auto aos = sample_catalog(static_cast<std::size_t>(state.range(0)));
+  const spherical::Direction<frames::ICRS> ref(qtty::Degree(279.2348), qtty::Degree(38.7836));
+  std::vector<qtty::Degree> out(aos.size());
+
+  for (auto _ : state) {
+    (void)_;
+    for (std::size_t i = 0; i < aos.size(); ++i) {
+      out[i] = aos[i].angular_separation(ref);
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bench_separation_soa(benchmark::State &state) {
+  const auto cart = to_cartesian(spherical::DirectionArray<frames::ICRS>(
+      sample_catalog(static_cast<std::size_t>(state.range(0)))));
+  const spherical::Direction<frames::ICRS> ref(qtty::Degree(279.2348), qtty::Degree(38.7836));
+  const auto ref_cart = ref.to_cartesian();
+  std::vector<qtty::Degree> out(cart.size());
+
+  for (auto _ : state) {
+    (void)_;
+    angular_separation(cart, ref_cart, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void register_soa_benchmarks() {
+  const struct {
+    const char *name;
+    void (*fn)(benchmark::State &);
+  } cases[] = {
+      {"to_cartesian/aos", bench_to_cartesian_aos}, {"to_cartesian/soa", bench_to_cartesian_soa},
+      {"to_spherical/aos", bench_to_spherical_aos}, {"to_spherical/soa", bench_to_spherical_soa},
+      {"separation/aos", bench_separation_aos},     {"separation/soa", bench_separation_soa},
+  };
+
+  for (const auto &c : cases) {
+    benchmark::RegisterBenchmark(c.name, c.fn)
+        ->Arg(1 << 16)
+        ->Arg(1 << 21)
+        ->Unit(benchmark::kMillisecond);
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_soa_benchmarks();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+/// SPK loading benchmarks: startup time and resident memory of a JPL kernel
+/// (DE440 / DE441) opened by copy through siderust-ffi against the
+/// memory-mapped C++ reader, a 1990–2050 restricted copy and a 16 MiB
+/// record budget, plus query throughput once loaded.
+///
+/// The kernel path is taken from `SIDERUST_BSP`; without it every benchmark
+/// is skipped.
+///
+/// Typical usage:
+///   const RuntimeEphemeris de441(
+///       path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+///   const auto earth = de441.earth_barycentric(jd);
+
+#include <benchmark/benchmark.h>
+#include <siderust/siderust.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+using namespace siderust;
+
+namespace {
+
+constexpr std::size_t kDays = 3653; // 10 years, daily
+
+const char *kernel_path() { return std::getenv("SIDERUST_BSP"); }
+
+/// Resident set size in MiB, or 0 where `/proc/self/statm` is unavailable.
+double resident_mib() {
+#if defined(__linux__)
+  std::FILE *f = std::fopen("/proc/self/statm", "r");
+  if (f == nullptr)
+    return 0.0;
+  long pages = 0, resident = 0;
+  const int n = std::fscanf(f, "%ld %ld", &pages, &resident);
+  std::fclose(f);
+  if (n != 2)
+    return 0.0;
+  return static_cast<double>(resident) * static_cast<double>(sysconf(_SC_PAGESIZE)) /
+         (1024.0 * 1024.0);
+#else
+  return 0.0;
+#endif
+}
+
+RuntimeEphemerisOptions copy_options() { return RuntimeEphemerisOptions(); }
+
+RuntimeEphemerisOptions mapped_options() {
+  return RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped);
+}
+
+/// 1990–2050 only, copied into memory.
+RuntimeEphemerisOptions period_options() {
+  return RuntimeEphemerisOptions().with_period(
+      {Time<TT, JD>(2447892.5), Time<TT, JD>(2469807.5)});
+}
+
+/// 1990–2050 for the Earth and Moon through a 16 MiB record cache.
+RuntimeEphemerisOptions budget_options() {
+  return period_options()
+      .with_bodies({spk::naif::Earth, spk::naif::Moon})
+      .with_memory_budget(std::size_t{16} << 20);
+}
+
+template <RuntimeEphemerisOptions (*Options)()> RuntimeEphemeris open_kernel() {
+  return RuntimeEphemeris(kernel_path(), Options());
+}
+
+template <RuntimeEphemerisOptions (*Options)()> void bench_open(benchmark::State &state) {
+  if (kernel_path() == nullptr) {
+    state.SkipWithError("SIDERUST_BSP is not set");
+    return;
+  }
+  const double before = resident_mib();
+  double rss = 0.0;
+  {
+    const auto eph = open_kernel<Options>();
+    rss = resident_mib() - before;
+  }
+  for (auto _ : state) {
+    (void)_;
+    auto eph = open_kernel<Options>();
+    benchmark::DoNotOptimize(eph);
+  }
+  state.counters["rss_mib"] = rss;
+}
+
+template <RuntimeEphemerisOptions (*Options)()> void bench_query(benchmark::State &state) {
+  if (kernel_path() == nullptr) {
+    state.SkipWithError("SIDERUST_BSP is not set");
+    return;
+  }
+  const double before = resident_mib();
+  const auto eph = open_kernel<Options>();
+  std::vector<Time<TT, JD>> jd;
+  jd.reserve(kDays);
+  for (std::size_t i = 0; i < kDays; ++i) {
+    jd.push_back(Time<TT, JD>(2460676.5 + static_cast<double>(i))); // from 2025-01-01
+  }
+  for (auto _ : state) {
+    (void)_;
+    for (const auto &t : jd) {
+      auto e = eph.earth_barycentric(t);
+      auto m = eph.moon_geocentric(t);
+      benchmark::DoNotOptimize(e);
+      benchmark::DoNotOptimize(m);
+    }
+  }
+  // After a full pass only the records for the queried decade are resident.
+  state.counters["rss_mib"] = resident_mib() - before;
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(jd.size()));
+}
+
+void register_spk_loading_benchmarks() {
+  const struct {
+    const char *name;
+    void (*open)(benchmark::State &);
+    void (*query)(benchmark::State &);
+  } cases[] = {
+      {"copy", bench_open<copy_options>, bench_query<copy_options>},
+      {"mapped", bench_open<mapped_options>, bench_query<mapped_options>},
+      {"period", bench_open<period_options>, bench_query<period_options>},
+      {"budget", bench_open<budget_options>, bench_query<budget_options>},
+  };
+
+  for (const auto &c : cases) {
+    benchmark::RegisterBenchmark((std::string("open/") + c.name).c_str(), c.open)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark((std::string("query/") + c.name).c_str(), c.query)
+        ->Unit(benchmark::kMillisecond);
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_spk_loading_benchmarks();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
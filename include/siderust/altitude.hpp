@@ -11,9 +11,18 @@
 
 #include "bodies.hpp"
 #include "coordinates.hpp"
+#include "detail/parallel.hpp"
+#include "ffi_array.hpp"
 #include "ffi_core.hpp"
+#include "span.hpp"
 #include "time.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace siderust {
@@ -48,6 +57,12 @@ struct CulminationEvent {
   }
 };
 
+/// Crossing events returned by an FFI search, owned without copying.
+using CrossingList = FfiArray<CrossingEvent, siderust_crossing_event_t>;
+
+/// Culmination events returned by an FFI search, owned without copying.
+using CulminationList = FfiArray<CulminationEvent, siderust_culmination_event_t>;
+
 // ============================================================================
 // SearchOptions
 // ============================================================================
@@ -58,6 +73,16 @@ struct CulminationEvent {
 struct SearchOptions {
   qtty::Day time_tolerance = qtty::Day(1e-9);
 
+  /**
+   * @brief Number of worker threads used to search a window.
+   *
+   * `1` (default) runs the whole window as one FFI search on the calling
+   * thread. Any other value cuts the window into day-long blocks (at most
+   * 64), searches them on that many threads and stitches the results (see
+   * `with_parallelism`). `0` selects `std::thread::hardware_concurrency()`.
+   */
+  std::size_t parallelism = 1;
+
   SearchOptions() = default;
 
   /// Set time tolerance.
@@ -66,6 +91,23 @@ struct SearchOptions {
     return *this;
   }
 
+  /**
+   * @brief Search long windows on `threads` worker threads.
+   *
+   * Periods touching a block boundary are merged and events found twice in
+   * the overlap between neighbouring blocks are emitted once, so the result
+   * has the same shape as the serial search.
+   *
+   * The blocks depend only on the window, never on the thread count, and
+   * the serial search (`threads == 1`) walks the same blocks in order, so
+   * every thread count returns bit-identical results. Windows shorter than
+   * two days are searched as a single block.
+   */
+  SearchOptions &with_parallelism(std::size_t threads) {
+    parallelism = threads;
+    return *this;
+  }
+
   siderust_search_opts_t to_c() const { return {time_tolerance.value()}; }
 };
 
@@ -74,36 +116,412 @@ struct SearchOptions {
 // ============================================================================
 namespace detail {
 
-inline std::vector<Period<TT, MJD>> periods_from_c(tempoch_period_mjd_t *ptr, uintptr_t count) {
-  std::vector<Period<TT, MJD>> result;
-  result.reserve(count);
-  for (uintptr_t i = 0; i < count; ++i) {
-    result.push_back(Period<TT, MJD>::from_c(ptr[i]));
+/**
+ * @brief Evaluate `siderust_altitude_at` over `count` instants.
+ *
+ * The subject and observer are converted to their C representation once and
+ * reused for every instant; `mjd_at(i)` yields the i-th TT MJD value. `Out`
+ * is the angle type written to `out` (`qtty::Radian` or `qtty::Degree`).
+ */
+template <typename MjdAt, typename Out>
+inline void altitude_series(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                            std::size_t count, MjdAt mjd_at, Out *out, const char *operation) {
+  double alt = 0.0;
+  for (std::size_t i = 0; i < count; ++i) {
+    check_status(siderust_altitude_at(subj, obs, mjd_at(i), &alt), operation);
+    out[i] = qtty::Radian(alt).to<Out>();
   }
-  siderust_periods_free(ptr, count);
-  return result;
 }
 
-inline std::vector<CrossingEvent> crossings_from_c(siderust_crossing_event_t *ptr,
-                                                   uintptr_t count) {
-  std::vector<CrossingEvent> result;
-  result.reserve(count);
-  for (uintptr_t i = 0; i < count; ++i) {
-    result.push_back(CrossingEvent::from_c(ptr[i]));
+/// `altitude_series` over a span of instants, after checking `out` matches.
+template <typename Out>
+inline void altitude_batch(const siderust_subject_t &subj, const Geodetic &obs,
+                           span<const Time<TT, MJD>> mjds, span<Out> out, const char *operation) {
+  check_batch_size(mjds.size(), out.size(), operation);
+  altitude_series(
+      subj, obs.to_c(), mjds.size(), [&](std::size_t i) { return mjds[i].value(); }, out.data(),
+      operation);
+}
+
+/// Vector-returning form of `altitude_batch`, in radians.
+inline std::vector<qtty::Radian> altitude_batch(const siderust_subject_t &subj,
+                                                const Geodetic &obs,
+                                                span<const Time<TT, MJD>> mjds,
+                                                const char *operation) {
+  std::vector<qtty::Radian> out(mjds.size());
+  altitude_batch(subj, obs, mjds, span<qtty::Radian>(out), operation);
+  return out;
+}
+
+// ── Parallel window splitting ───────────────────────────────────────────────
+
+/// Shortest block a window search is cut into.
+constexpr double kMinParallelChunkDays = 1.0;
+
+/// Upper bound on the number of blocks a window is cut into.
+constexpr std::size_t kMaxParallelBlocks = 64;
+
+/// Overlap added around each event-search block so that events close to a
+/// boundary are bracketed by at least one block (1 minute).
+constexpr double kChunkOverlapDays = 1.0 / 1440.0;
+
+/**
+ * @brief Number of blocks a window search is cut into.
+ *
+ * Depends only on the window, never on the thread count, so every
+ * `parallelism` (serial included) searches the same sub-windows and returns
+ * the same result bit for bit.
+ */
+inline std::size_t parallel_blocks(const Period<TT, MJD> &window) {
+  const double days = window.end().value() - window.start().value();
+  const double blocks = std::floor(std::max(1.0, days / kMinParallelChunkDays));
+  return std::min(static_cast<std::size_t>(blocks), kMaxParallelBlocks);
+}
+
+/// Worker threads used for `blocks` blocks under the given options (`1`
+/// walks the blocks in order on the calling thread).
+inline std::size_t parallel_threads(std::size_t blocks, const SearchOptions &opts) {
+  if (opts.parallelism == 1)
+    return 1;
+  return std::min(resolve_threads(opts.parallelism), blocks);
+}
+
+/// Boundary `i` of a window split into `n` equal blocks (exact at both ends).
+inline double chunk_boundary(const Period<TT, MJD> &window, std::size_t i, std::size_t n) {
+  if (i == n)
+    return window.end().value();
+  const double t0 = window.start().value();
+  return t0 + (window.end().value() - t0) * static_cast<double>(i) / static_cast<double>(n);
+}
+
+/**
+ * @brief Run `search(b, out)` for every block `b < blocks` on `threads`
+ *        workers, each taking a contiguous run of blocks.
+ *
+ * Returns the per-block results in block order, so the outcome does not
+ * depend on how blocks were assigned to threads.
+ */
+template <typename T, typename Search>
+inline std::vector<std::vector<T>> search_blocks(std::size_t blocks, std::size_t threads,
+                                                 Search search) {
+  std::vector<std::vector<T>> results(blocks);
+  run_parallel(threads, [&](std::size_t c) {
+    for (std::size_t b = c * blocks / threads; b < (c + 1) * blocks / threads; ++b)
+      search(b, results[b]);
+  });
+  return results;
+}
+
+// ── Result sinks ────────────────────────────────────────────────────────────
+
+/// Appends results to a `std::vector`; `reserve(n)` lets `emit_from_c` size
+/// it from the FFI result count before copying.
+template <typename T> struct VectorSink {
+  std::vector<T> &out;
+
+  void reserve(std::size_t n) { out.reserve(out.size() + n); }
+  void operator()(const T &item) { out.push_back(item); }
+};
+
+/// True when `Sink` exposes `reserve(std::size_t)`.
+template <typename Sink, typename = void> struct has_reserve : std::false_type {};
+template <typename Sink>
+struct has_reserve<Sink, std::void_t<decltype(std::declval<Sink &>().reserve(std::size_t{}))>>
+    : std::true_type {};
+
+/**
+ * @brief Feed every element of an FFI-allocated array to `sink`, then release
+ *        the array.
+ *
+ * The array is owned by an `FfiArray` for the duration of the call, so it is
+ * released even if the sink throws. Sinks with a `reserve(n)` member (the
+ * vector sinks) are sized from the result count first.
+ */
+template <typename Item, typename CItem, typename Sink>
+inline void emit_from_c(CItem *ptr, uintptr_t count, Sink &sink) {
+  const FfiArray<Item, CItem> items(ptr, count);
+  if constexpr (has_reserve<Sink>::value)
+    sink.reserve(static_cast<std::size_t>(count));
+  for (const Item item : items) {
+    sink(item);
   }
-  siderust_crossings_free(ptr, count);
-  return result;
 }
 
-inline std::vector<CulminationEvent> culminations_from_c(siderust_culmination_event_t *ptr,
-                                                         uintptr_t count) {
-  std::vector<CulminationEvent> result;
-  result.reserve(count);
-  for (uintptr_t i = 0; i < count; ++i) {
-    result.push_back(CulminationEvent::from_c(ptr[i]));
+/// Enabled when `Sink` is a callable taking `const T &` or a `std::vector<T>`.
+template <typename T, typename Sink>
+using enable_if_sink_t =
+    std::enable_if_t<std::is_invocable_v<Sink &, const T &> ||
+                     std::is_same_v<std::remove_cv_t<std::remove_reference_t<Sink>>,
+                                    std::vector<T>>>;
+
+/**
+ * @brief Adapt a user-facing sink to a `void(const T &)` callable.
+ *
+ * A `std::vector<T>` is cleared and appended to through a `VectorSink`, so
+ * its capacity is reused across queries; any other sink is forwarded as-is.
+ */
+template <typename T, typename Sink> inline auto make_sink(Sink &sink) {
+  if constexpr (std::is_same_v<std::remove_cv_t<Sink>, std::vector<T>>) {
+    sink.clear();
+    return VectorSink<T>{sink};
+  } else {
+    return [&sink](const T &item) { sink(item); };
+  }
+}
+
+// ── Window search drivers ───────────────────────────────────────────────────
+
+/**
+ * @brief Search for periods, optionally splitting the window across threads.
+ *
+ * `query(chunk, sink)` runs the FFI search over a `tempoch_period_mjd_t`
+ * window and feeds each period to `sink`. A single-block window feeds the
+ * caller's sink straight from the FFI buffer. Otherwise the window is cut
+ * into `parallel_blocks(window)` blocks (searched on up to
+ * `opts.parallelism` threads), block results are concatenated in order, and
+ * periods that touch at a block boundary are merged back into one before
+ * being emitted.
+ */
+template <typename Query, typename Sink>
+inline void search_periods(const Period<TT, MJD> &window, const SearchOptions &opts, Query query,
+                           Sink &sink) {
+  const std::size_t n = parallel_blocks(window);
+  if (n <= 1) {
+    query(window.c_inner(), sink);
+    return;
+  }
+  const std::size_t threads = parallel_threads(n, opts);
+
+  auto blocks = search_blocks<Period<TT, MJD>>(n, threads, [&](std::size_t i, auto &out) {
+    VectorSink<Period<TT, MJD>> collect{out};
+    query(tempoch_period_mjd_t{chunk_boundary(window, i, n), chunk_boundary(window, i + 1, n)},
+          collect);
+  });
+
+  bool pending = false;
+  double start = 0.0;
+  double end = 0.0;
+  for (const auto &block : blocks) {
+    for (const auto &p : block) {
+      if (pending && p.start().value() <= end) {
+        end = std::max(end, p.end().value());
+        continue;
+      }
+      if (pending)
+        sink(Period<TT, MJD>(Time<TT, MJD>(start), Time<TT, MJD>(end)));
+      start = p.start().value();
+      end = p.end().value();
+      pending = true;
+    }
+  }
+  if (pending)
+    sink(Period<TT, MJD>(Time<TT, MJD>(start), Time<TT, MJD>(end)));
+}
+
+/**
+ * @brief Search for discrete events, optionally splitting the window across
+ *        threads.
+ *
+ * The window is cut into `parallel_blocks(window)` blocks (searched on up
+ * to `opts.parallelism` threads), each widened by `kChunkOverlapDays` on
+ * both sides (clamped to the window) so an event near a boundary is always
+ * bracketed. Events are then merged in
+ * time order and an event of the same kind (`same_kind(a, b)`) within the
+ * overlap of its predecessor is treated as a duplicate.
+ */
+template <typename Event, typename Query, typename SameKind, typename Sink>
+inline void search_events(const Period<TT, MJD> &window, const SearchOptions &opts, Query query,
+                          SameKind same_kind, Sink &sink) {
+  const std::size_t n = parallel_blocks(window);
+  if (n <= 1) {
+    query(window.c_inner(), sink);
+    return;
+  }
+  const std::size_t threads = parallel_threads(n, opts);
+
+  const double t0 = window.start().value();
+  const double t1 = window.end().value();
+  auto blocks = search_blocks<Event>(n, threads, [&](std::size_t i, auto &out) {
+    const double a = std::max(t0, chunk_boundary(window, i, n) - kChunkOverlapDays);
+    const double b = std::min(t1, chunk_boundary(window, i + 1, n) + kChunkOverlapDays);
+    VectorSink<Event> collect{out};
+    query(tempoch_period_mjd_t{a, b}, collect);
+  });
+
+  std::vector<Event> merged;
+  for (auto &block : blocks)
+    merged.insert(merged.end(), block.begin(), block.end());
+  std::stable_sort(merged.begin(), merged.end(), [](const Event &x, const Event &y) {
+    return x.time.value() < y.time.value();
+  });
+
+  const Event *last = nullptr;
+  for (const auto &ev : merged) {
+    if (last && same_kind(*last, ev) && ev.time.value() - last->time.value() < kChunkOverlapDays)
+      continue;
+    sink(ev);
+    last = &ev;
+  }
+}
+
+/// Collect the results of a sink-based search into a vector.
+template <typename T, typename Search> inline std::vector<T> collect(Search search) {
+  std::vector<T> out;
+  search(VectorSink<T>{out});
+  return out;
+}
+
+// ── Subject-level altitude searches ─────────────────────────────────────────
+
+template <typename Sink>
+inline void above_threshold_periods(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                                    const Period<TT, MJD> &window, qtty::Degree threshold,
+                                    const SearchOptions &opts, const char *operation, Sink &&sink) {
+  search_periods(
+      window, opts,
+      [&](const tempoch_period_mjd_t &w, auto &out) {
+        tempoch_period_mjd_t *ptr = nullptr;
+        uintptr_t count = 0;
+        check_status(siderust_above_threshold(subj, obs, w, threshold.value(), opts.to_c(), &ptr,
+                                              &count),
+                     operation);
+        emit_from_c<Period<TT, MJD>>(ptr, count, out);
+      },
+      sink);
+}
+
+inline std::vector<Period<TT, MJD>>
+above_threshold_periods(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                        const Period<TT, MJD> &window, qtty::Degree threshold,
+                        const SearchOptions &opts, const char *operation) {
+  return collect<Period<TT, MJD>>([&](auto &&sink) {
+    above_threshold_periods(subj, obs, window, threshold, opts, operation, sink);
+  });
+}
+
+template <typename Sink>
+inline void below_threshold_periods(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                                    const Period<TT, MJD> &window, qtty::Degree threshold,
+                                    const SearchOptions &opts, const char *operation, Sink &&sink) {
+  search_periods(
+      window, opts,
+      [&](const tempoch_period_mjd_t &w, auto &out) {
+        tempoch_period_mjd_t *ptr = nullptr;
+        uintptr_t count = 0;
+        check_status(siderust_below_threshold(subj, obs, w, threshold.value(), opts.to_c(), &ptr,
+                                              &count),
+                     operation);
+        emit_from_c<Period<TT, MJD>>(ptr, count, out);
+      },
+      sink);
+}
+
+inline std::vector<Period<TT, MJD>>
+below_threshold_periods(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                        const Period<TT, MJD> &window, qtty::Degree threshold,
+                        const SearchOptions &opts, const char *operation) {
+  return collect<Period<TT, MJD>>([&](auto &&sink) {
+    below_threshold_periods(subj, obs, window, threshold, opts, operation, sink);
+  });
+}
+
+template <typename Sink>
+inline void altitude_range_periods(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                                   const Period<TT, MJD> &window, qtty::Degree min_alt,
+                                   qtty::Degree max_alt, const SearchOptions &opts,
+                                   const char *operation, Sink &&sink) {
+  search_periods(
+      window, opts,
+      [&](const tempoch_period_mjd_t &w, auto &out) {
+        tempoch_period_mjd_t *ptr = nullptr;
+        uintptr_t count = 0;
+        check_status(siderust_altitude_ranges(subj, obs, w, min_alt.value(), max_alt.value(),
+                                              opts.to_c(), &ptr, &count),
+                     operation);
+        emit_from_c<Period<TT, MJD>>(ptr, count, out);
+      },
+      sink);
+}
+
+inline std::vector<Period<TT, MJD>>
+altitude_range_periods(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                       const Period<TT, MJD> &window, qtty::Degree min_alt, qtty::Degree max_alt,
+                       const SearchOptions &opts, const char *operation) {
+  return collect<Period<TT, MJD>>([&](auto &&sink) {
+    altitude_range_periods(subj, obs, window, min_alt, max_alt, opts, operation, sink);
+  });
+}
+
+template <typename Sink>
+inline void crossing_events(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                            const Period<TT, MJD> &window, qtty::Degree threshold,
+                            const SearchOptions &opts, const char *operation, Sink &&sink) {
+  search_events<CrossingEvent>(
+      window, opts,
+      [&](const tempoch_period_mjd_t &w, auto &out) {
+        siderust_crossing_event_t *ptr = nullptr;
+        uintptr_t count = 0;
+        check_status(
+            siderust_crossings(subj, obs, w, threshold.value(), opts.to_c(), &ptr, &count),
+            operation);
+        emit_from_c<CrossingEvent>(ptr, count, out);
+      },
+      [](const CrossingEvent &a, const CrossingEvent &b) { return a.direction == b.direction; },
+      sink);
+}
+
+inline std::vector<CrossingEvent>
+crossing_events(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                const Period<TT, MJD> &window, qtty::Degree threshold, const SearchOptions &opts,
+                const char *operation) {
+  return collect<CrossingEvent>([&](auto &&sink) {
+    crossing_events(subj, obs, window, threshold, opts, operation, sink);
+  });
+}
+
+template <typename Sink>
+inline void culmination_events(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                               const Period<TT, MJD> &window, const SearchOptions &opts,
+                               const char *operation, Sink &&sink) {
+  search_events<CulminationEvent>(
+      window, opts,
+      [&](const tempoch_period_mjd_t &w, auto &out) {
+        siderust_culmination_event_t *ptr = nullptr;
+        uintptr_t count = 0;
+        check_status(siderust_culminations(subj, obs, w, opts.to_c(), &ptr, &count), operation);
+        emit_from_c<CulminationEvent>(ptr, count, out);
+      },
+      [](const CulminationEvent &a, const CulminationEvent &b) { return a.kind == b.kind; }, sink);
+}
+
+inline std::vector<CulminationEvent>
+culmination_events(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                   const Period<TT, MJD> &window, const SearchOptions &opts,
+                   const char *operation) {
+  return collect<CulminationEvent>(
+      [&](auto &&sink) { culmination_events(subj, obs, window, opts, operation, sink); });
+}
+
+/**
+ * @brief Run a single-observer query for every site of a station network.
+ *
+ * Returns one result per observer, in the same order as `observers`.
+ *
+ * Callers build the C subject once and reuse it for every site, but each
+ * site is still a full, independent FFI query: siderust-ffi has no network
+ * entry point, so the site-independent work (ephemeris, precession-nutation,
+ * aberration) is repeated per observer. The network overloads are a
+ * convenience API, not a speed-up over a loop of single-site calls.
+ */
+template <typename Query>
+inline auto per_site(span<const Geodetic> observers, Query query)
+    -> std::vector<decltype(query(std::declval<const Geodetic &>()))> {
+  std::vector<decltype(query(std::declval<const Geodetic &>()))> results;
+  results.reserve(observers.size());
+  for (const Geodetic &obs : observers) {
+    results.push_back(query(obs));
   }
-  siderust_culminations_free(ptr, count);
-  return result;
+  return results;
 }
 
 } // namespace detail
@@ -125,6 +543,28 @@ inline qtty::Radian altitude_at(const Geodetic &obs, const Time<TT, MJD> &mjd) {
   return qtty::Radian(out);
 }
 
+/**
+ * @brief The Sun's altitude (radians) at every instant of `mjds`.
+ *
+ * The subject and observer are marshalled once for the whole series.
+ *
+ * @throws InvalidDimensionError if `out.size() != mjds.size()`.
+ */
+inline void altitude_at(const Geodetic &obs, span<const Time<TT, MJD>> mjds,
+                        span<qtty::Radian> out) {
+  detail::altitude_batch(detail::make_body_subject(SIDERUST_BODY_SUN), obs, mjds, out,
+                         "sun::altitude_at(span)");
+}
+
+/**
+ * @brief The Sun's altitude (radians) at every instant of `mjds`.
+ */
+inline std::vector<qtty::Radian> altitude_at(const Geodetic &obs,
+                                             span<const Time<TT, MJD>> mjds) {
+  return detail::altitude_batch(detail::make_body_subject(SIDERUST_BODY_SUN), obs, mjds,
+                                "sun::altitude_at(span)");
+}
+
 /**
  * @brief Find periods when the Sun is above a threshold altitude.
  */
@@ -132,13 +572,8 @@ inline std::vector<Period<TT, MJD>> above_threshold(const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_above_threshold(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
-                                        window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                        &count),
-               "sun::above_threshold");
-  return detail::periods_from_c(ptr, count);
+  return detail::above_threshold_periods(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
+                                         window, threshold, opts, "sun::above_threshold");
 }
 
 /**
@@ -148,13 +583,31 @@ inline std::vector<Period<TT, MJD>> below_threshold(const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_below_threshold(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
-                                        window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                        &count),
-               "sun::below_threshold");
-  return detail::periods_from_c(ptr, count);
+  return detail::below_threshold_periods(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
+                                         window, threshold, opts, "sun::below_threshold");
+}
+
+/**
+ * @brief Periods when the Sun is below a threshold altitude, for every site
+ *        of a station network.
+ *
+ * `result[i]` holds the periods for `observers[i]`; with a negative
+ * threshold (e.g. −18° for astronomical night) this yields the night windows
+ * of the whole network in one call.
+ *
+ * @code
+ * std::vector<Geodetic> network = {ROQUE_DE_LOS_MUCHACHOS(), EL_PARANAL(), MAUNA_KEA()};
+ * auto nights = sun::below_threshold(network, window, qtty::Degree(-18.0));
+ * @endcode
+ */
+inline std::vector<std::vector<Period<TT, MJD>>>
+below_threshold(span<const Geodetic> observers, const Period<TT, MJD> &window,
+                qtty::Degree threshold, const SearchOptions &opts = {}) {
+  const siderust_subject_t subj = detail::make_body_subject(SIDERUST_BODY_SUN);
+  return detail::per_site(observers, [&](const Geodetic &obs) {
+    return detail::below_threshold_periods(subj, obs.to_c(), window, threshold, opts,
+                                           "sun::below_threshold(observers)");
+  });
 }
 
 /**
@@ -163,12 +616,8 @@ inline std::vector<Period<TT, MJD>> below_threshold(const Geodetic &obs,
 inline std::vector<CrossingEvent> crossings(const Geodetic &obs, const Period<TT, MJD> &window,
                                             qtty::Degree threshold,
                                             const SearchOptions &opts = {}) {
-  siderust_crossing_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_crossings(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
-                                  window.c_inner(), threshold.value(), opts.to_c(), &ptr, &count),
-               "sun::crossings");
-  return detail::crossings_from_c(ptr, count);
+  return detail::crossing_events(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(), window,
+                                 threshold, opts, "sun::crossings");
 }
 
 /**
@@ -176,12 +625,8 @@ inline std::vector<CrossingEvent> crossings(const Geodetic &obs, const Period<TT
  */
 inline std::vector<CulminationEvent>
 culminations(const Geodetic &obs, const Period<TT, MJD> &window, const SearchOptions &opts = {}) {
-  siderust_culmination_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_culminations(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
-                                     window.c_inner(), opts.to_c(), &ptr, &count),
-               "sun::culminations");
-  return detail::culminations_from_c(ptr, count);
+  return detail::culmination_events(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
+                                    window, opts, "sun::culminations");
 }
 
 /**
@@ -191,13 +636,8 @@ inline std::vector<Period<TT, MJD>> altitude_ranges(const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree min_alt, qtty::Degree max_alt,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_altitude_ranges(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
-                                        window.c_inner(), min_alt.value(), max_alt.value(),
-                                        opts.to_c(), &ptr, &count),
-               "sun::altitude_ranges");
-  return detail::periods_from_c(ptr, count);
+  return detail::altitude_range_periods(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
+                                        window, min_alt, max_alt, opts, "sun::altitude_ranges");
 }
 
 } // namespace sun
@@ -219,6 +659,28 @@ inline qtty::Radian altitude_at(const Geodetic &obs, const Time<TT, MJD> &mjd) {
   return qtty::Radian(out);
 }
 
+/**
+ * @brief The Moon's altitude (radians) at every instant of `mjds`.
+ *
+ * The subject and observer are marshalled once for the whole series.
+ *
+ * @throws InvalidDimensionError if `out.size() != mjds.size()`.
+ */
+inline void altitude_at(const Geodetic &obs, span<const Time<TT, MJD>> mjds,
+                        span<qtty::Radian> out) {
+  detail::altitude_batch(detail::make_body_subject(SIDERUST_BODY_MOON), obs, mjds, out,
+                         "moon::altitude_at(span)");
+}
+
+/**
+ * @brief The Moon's altitude (radians) at every instant of `mjds`.
+ */
+inline std::vector<qtty::Radian> altitude_at(const Geodetic &obs,
+                                             span<const Time<TT, MJD>> mjds) {
+  return detail::altitude_batch(detail::make_body_subject(SIDERUST_BODY_MOON), obs, mjds,
+                                "moon::altitude_at(span)");
+}
+
 /**
  * @brief Find periods when the Moon is above a threshold altitude.
  */
@@ -226,13 +688,8 @@ inline std::vector<Period<TT, MJD>> above_threshold(const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_above_threshold(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
-                                        window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                        &count),
-               "moon::above_threshold");
-  return detail::periods_from_c(ptr, count);
+  return detail::above_threshold_periods(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
+                                         window, threshold, opts, "moon::above_threshold");
 }
 
 /**
@@ -242,13 +699,8 @@ inline std::vector<Period<TT, MJD>> below_threshold(const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_below_threshold(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
-                                        window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                        &count),
-               "moon::below_threshold");
-  return detail::periods_from_c(ptr, count);
+  return detail::below_threshold_periods(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
+                                         window, threshold, opts, "moon::below_threshold");
 }
 
 /**
@@ -257,12 +709,8 @@ inline std::vector<Period<TT, MJD>> below_threshold(const Geodetic &obs,
 inline std::vector<CrossingEvent> crossings(const Geodetic &obs, const Period<TT, MJD> &window,
                                             qtty::Degree threshold,
                                             const SearchOptions &opts = {}) {
-  siderust_crossing_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_crossings(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
-                                  window.c_inner(), threshold.value(), opts.to_c(), &ptr, &count),
-               "moon::crossings");
-  return detail::crossings_from_c(ptr, count);
+  return detail::crossing_events(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(), window,
+                                 threshold, opts, "moon::crossings");
 }
 
 /**
@@ -270,12 +718,8 @@ inline std::vector<CrossingEvent> crossings(const Geodetic &obs, const Period<TT
  */
 inline std::vector<CulminationEvent>
 culminations(const Geodetic &obs, const Period<TT, MJD> &window, const SearchOptions &opts = {}) {
-  siderust_culmination_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_culminations(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
-                                     window.c_inner(), opts.to_c(), &ptr, &count),
-               "moon::culminations");
-  return detail::culminations_from_c(ptr, count);
+  return detail::culmination_events(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
+                                    window, opts, "moon::culminations");
 }
 
 /**
@@ -285,13 +729,8 @@ inline std::vector<Period<TT, MJD>> altitude_ranges(const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree min_alt, qtty::Degree max_alt,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_altitude_ranges(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
-                                        window.c_inner(), min_alt.value(), max_alt.value(),
-                                        opts.to_c(), &ptr, &count),
-               "moon::altitude_ranges");
-  return detail::periods_from_c(ptr, count);
+  return detail::altitude_range_periods(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
+                                        window, min_alt, max_alt, opts, "moon::altitude_ranges");
 }
 
 } // namespace moon
@@ -313,6 +752,28 @@ inline qtty::Radian altitude_at(const Star &s, const Geodetic &obs, const Time<T
   return qtty::Radian(out);
 }
 
+/**
+ * @brief A star's altitude (radians) at every instant of `mjds`.
+ *
+ * The subject and observer are marshalled once for the whole series.
+ *
+ * @throws InvalidDimensionError if `out.size() != mjds.size()`.
+ */
+inline void altitude_at(const Star &s, const Geodetic &obs, span<const Time<TT, MJD>> mjds,
+                        span<qtty::Radian> out) {
+  detail::altitude_batch(detail::make_star_subject(s.c_handle()), obs, mjds, out,
+                         "star_altitude::altitude_at(span)");
+}
+
+/**
+ * @brief A star's altitude (radians) at every instant of `mjds`.
+ */
+inline std::vector<qtty::Radian> altitude_at(const Star &s, const Geodetic &obs,
+                                             span<const Time<TT, MJD>> mjds) {
+  return detail::altitude_batch(detail::make_star_subject(s.c_handle()), obs, mjds,
+                                "star_altitude::altitude_at(span)");
+}
+
 /**
  * @brief Find periods when a star is above a threshold altitude.
  */
@@ -320,13 +781,8 @@ inline std::vector<Period<TT, MJD>> above_threshold(const Star &s, const Geodeti
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_above_threshold(detail::make_star_subject(s.c_handle()), obs.to_c(),
-                                        window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                        &count),
-               "star_altitude::above_threshold");
-  return detail::periods_from_c(ptr, count);
+  return detail::above_threshold_periods(detail::make_star_subject(s.c_handle()), obs.to_c(),
+                                         window, threshold, opts, "star_altitude::above_threshold");
 }
 
 /**
@@ -336,13 +792,8 @@ inline std::vector<Period<TT, MJD>> below_threshold(const Star &s, const Geodeti
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_below_threshold(detail::make_star_subject(s.c_handle()), obs.to_c(),
-                                        window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                        &count),
-               "star_altitude::below_threshold");
-  return detail::periods_from_c(ptr, count);
+  return detail::below_threshold_periods(detail::make_star_subject(s.c_handle()), obs.to_c(),
+                                         window, threshold, opts, "star_altitude::below_threshold");
 }
 
 /**
@@ -351,12 +802,8 @@ inline std::vector<Period<TT, MJD>> below_threshold(const Star &s, const Geodeti
 inline std::vector<CrossingEvent> crossings(const Star &s, const Geodetic &obs,
                                             const Period<TT, MJD> &window, qtty::Degree threshold,
                                             const SearchOptions &opts = {}) {
-  siderust_crossing_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_crossings(detail::make_star_subject(s.c_handle()), obs.to_c(),
-                                  window.c_inner(), threshold.value(), opts.to_c(), &ptr, &count),
-               "star_altitude::crossings");
-  return detail::crossings_from_c(ptr, count);
+  return detail::crossing_events(detail::make_star_subject(s.c_handle()), obs.to_c(), window,
+                                 threshold, opts, "star_altitude::crossings");
 }
 
 /**
@@ -365,12 +812,8 @@ inline std::vector<CrossingEvent> crossings(const Star &s, const Geodetic &obs,
 inline std::vector<CulminationEvent> culminations(const Star &s, const Geodetic &obs,
                                                   const Period<TT, MJD> &window,
                                                   const SearchOptions &opts = {}) {
-  siderust_culmination_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_culminations(detail::make_star_subject(s.c_handle()), obs.to_c(),
-                                     window.c_inner(), opts.to_c(), &ptr, &count),
-               "star_altitude::culminations");
-  return detail::culminations_from_c(ptr, count);
+  return detail::culmination_events(detail::make_star_subject(s.c_handle()), obs.to_c(), window,
+                                    opts, "star_altitude::culminations");
 }
 
 } // namespace star_altitude
@@ -393,6 +836,29 @@ inline qtty::Radian altitude_at(const spherical::direction::ICRS &dir, const Geo
   return qtty::Radian(out);
 }
 
+/**
+ * @brief A fixed ICRS direction's altitude (radians) at every instant of `mjds`.
+ *
+ * The subject and observer are marshalled once for the whole series.
+ *
+ * @throws InvalidDimensionError if `out.size() != mjds.size()`.
+ */
+inline void altitude_at(const spherical::direction::ICRS &dir, const Geodetic &obs,
+                        span<const Time<TT, MJD>> mjds, span<qtty::Radian> out) {
+  detail::altitude_batch(detail::make_icrs_subject(dir.to_c()), obs, mjds, out,
+                         "icrs_altitude::altitude_at(span)");
+}
+
+/**
+ * @brief A fixed ICRS direction's altitude (radians) at every instant of `mjds`.
+ */
+inline std::vector<qtty::Radian> altitude_at(const spherical::direction::ICRS &dir,
+                                             const Geodetic &obs,
+                                             span<const Time<TT, MJD>> mjds) {
+  return detail::altitude_batch(detail::make_icrs_subject(dir.to_c()), obs, mjds,
+                                "icrs_altitude::altitude_at(span)");
+}
+
 /**
  * @brief Backward-compatible RA/Dec overload.
  */
@@ -409,13 +875,8 @@ inline std::vector<Period<TT, MJD>> above_threshold(const spherical::direction::
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_above_threshold(detail::make_icrs_subject(dir.to_c()), obs.to_c(),
-                                        window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                        &count),
-               "icrs_altitude::above_threshold");
-  return detail::periods_from_c(ptr, count);
+  return detail::above_threshold_periods(detail::make_icrs_subject(dir.to_c()), obs.to_c(), window,
+                                         threshold, opts, "icrs_altitude::above_threshold");
 }
 
 /**
@@ -426,13 +887,8 @@ inline std::vector<Period<TT, MJD>> below_threshold(const spherical::direction::
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_below_threshold(detail::make_icrs_subject(dir.to_c()), obs.to_c(),
-                                        window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                        &count),
-               "icrs_altitude::below_threshold");
-  return detail::periods_from_c(ptr, count);
+  return detail::below_threshold_periods(detail::make_icrs_subject(dir.to_c()), obs.to_c(), window,
+                                         threshold, opts, "icrs_altitude::below_threshold");
 }
 
 /**
@@ -443,13 +899,8 @@ inline std::vector<Period<TT, MJD>> altitude_ranges(const spherical::direction::
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree min_alt, qtty::Degree max_alt,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_altitude_ranges(detail::make_icrs_subject(dir.to_c()), obs.to_c(),
-                                        window.c_inner(), min_alt.value(), max_alt.value(),
-                                        opts.to_c(), &ptr, &count),
-               "icrs_altitude::altitude_ranges");
-  return detail::periods_from_c(ptr, count);
+  return detail::altitude_range_periods(detail::make_icrs_subject(dir.to_c()), obs.to_c(), window,
+                                        min_alt, max_alt, opts, "icrs_altitude::altitude_ranges");
 }
 
 } // namespace icrs_altitude
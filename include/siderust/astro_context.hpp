@@ -2,9 +2,11 @@
 
 /**
  * @file astro_context.hpp
- * @brief Thin C++ context for selecting Earth-orientation / nutation models.
+ * @brief Thin C++ context for selecting Earth-orientation / nutation models
+ *        and the ephemeris used by altitude searches.
  */
 
+#include "ephemeris_provider.hpp"
 #include "ffi_core.hpp"
 
 namespace siderust {
@@ -27,6 +29,7 @@ struct Iau2006A {
 
 class AstroContext {
   EarthOrientationModel model_ = EarthOrientationModel::Iau2006A;
+  EphemerisProvider ephemeris_{};
 
 public:
   constexpr AstroContext() = default;
@@ -34,8 +37,25 @@ public:
 
   constexpr EarthOrientationModel model() const { return model_; }
 
+  /// Ephemeris used by searches given this context (built-in by default).
+  constexpr const EphemerisProvider &ephemeris() const { return ephemeris_; }
+
   template <typename ModelTag> constexpr AstroContext with_model() const {
-    return AstroContext(ModelTag::model_id);
+    AstroContext out = *this;
+    out.model_ = ModelTag::model_id;
+    return out;
+  }
+
+  /**
+   * @brief Copy of this context whose altitude searches read body
+   *        positions from `eph` (a `RuntimeEphemeris` or `EphemerisCache`).
+   *
+   * The ephemeris is borrowed and must outlive the context's uses.
+   */
+  constexpr AstroContext with_ephemeris(const EphemerisProvider &eph) const {
+    AstroContext out = *this;
+    out.ephemeris_ = eph;
+    return out;
   }
 
   /// Create an `AstroContext` reflecting the Rust library's built-in default.
@@ -48,6 +68,24 @@ public:
     check_status(st, "AstroContext::from_default_ffi::get_model");
     return AstroContext(static_cast<EarthOrientationModel>(model_out));
   }
+
+  /**
+   * @brief Borrow the process-wide FFI context for this model.
+   *
+   * One `siderust_context_t` per Earth-orientation model is created on first
+   * use and kept alive until program exit; the `_with` transform methods use
+   * it instead of creating a context per call.
+   *
+   * Creation is thread-safe (function-local static). After that the handle
+   * is only passed to the FFI as a `const` pointer, and sharing it between
+   * threads relies on the `_with_context` entry points reading the context
+   * without mutating it. The FFI documents no stronger guarantee; the
+   * `AstroContext.FfiHandleSharedAcrossThreads` test checks the concurrent
+   * transforms against serial results.
+   *
+   * @throws InvalidArgumentError if `model()` is not a known model.
+   */
+  const siderust_context_t *ffi_handle() const;
 };
 
 namespace detail {
@@ -91,6 +129,28 @@ private:
   siderust_context_t *handle_ = nullptr;
 };
 
+template <EarthOrientationModel Model> inline const siderust_context_t *shared_ffi_context() {
+  static const OwnedFfiContext ctx(Model);
+  return ctx.get();
+}
+
 } // namespace detail
 
+inline EphemerisProvider::EphemerisProvider(const AstroContext &ctx)
+    : EphemerisProvider(ctx.ephemeris().with_model(ctx.model())) {}
+
+inline const siderust_context_t *AstroContext::ffi_handle() const {
+  switch (model_) {
+  case EarthOrientationModel::Iau2000A:
+    return detail::shared_ffi_context<EarthOrientationModel::Iau2000A>();
+  case EarthOrientationModel::Iau2000B:
+    return detail::shared_ffi_context<EarthOrientationModel::Iau2000B>();
+  case EarthOrientationModel::Iau2006:
+    return detail::shared_ffi_context<EarthOrientationModel::Iau2006>();
+  case EarthOrientationModel::Iau2006A:
+    return detail::shared_ffi_context<EarthOrientationModel::Iau2006A>();
+  }
+  throw InvalidArgumentError("AstroContext::ffi_handle: unknown Earth-orientation model");
+}
+
 } // namespace siderust
@@ -66,31 +66,128 @@ struct AzimuthExtremum {
   }
 };
 
+/// Azimuth crossing events returned by an FFI search, owned without copying.
+using AzimuthCrossingList = FfiArray<AzimuthCrossingEvent, siderust_azimuth_crossing_event_t>;
+
+/// Azimuth extrema returned by an FFI search, owned without copying.
+using AzimuthExtremumList = FfiArray<AzimuthExtremum, siderust_azimuth_extremum_t>;
+
 // ============================================================================
 // Internal helpers
 // ============================================================================
 namespace detail {
 
-inline std::vector<AzimuthCrossingEvent> az_crossings_from_c(siderust_azimuth_crossing_event_t *ptr,
-                                                             uintptr_t count) {
-  std::vector<AzimuthCrossingEvent> result;
-  result.reserve(count);
-  for (uintptr_t i = 0; i < count; ++i) {
-    result.push_back(AzimuthCrossingEvent::from_c(ptr[i]));
-  }
-  siderust_azimuth_crossings_free(ptr, count);
-  return result;
+// ── Subject-level azimuth searches ──────────────────────────────────────────
+
+template <typename Sink>
+inline void azimuth_crossing_events(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                                    const Period<TT, MJD> &window, qtty::Degree bearing,
+                                    const SearchOptions &opts, const char *operation, Sink &&sink) {
+  search_events<AzimuthCrossingEvent>(
+      window, opts,
+      [&](const tempoch_period_mjd_t &w, auto &out) {
+        siderust_azimuth_crossing_event_t *ptr = nullptr;
+        uintptr_t count = 0;
+        check_status(siderust_azimuth_crossings(subj, obs, w, bearing.value(), opts.to_c(), &ptr,
+                                                &count),
+                     operation);
+        emit_from_c<AzimuthCrossingEvent>(ptr, count, out);
+      },
+      [](const AzimuthCrossingEvent &a, const AzimuthCrossingEvent &b) {
+        return a.direction == b.direction;
+      },
+      sink);
 }
 
-inline std::vector<AzimuthExtremum> az_extrema_from_c(siderust_azimuth_extremum_t *ptr,
-                                                      uintptr_t count) {
-  std::vector<AzimuthExtremum> result;
-  result.reserve(count);
-  for (uintptr_t i = 0; i < count; ++i) {
-    result.push_back(AzimuthExtremum::from_c(ptr[i]));
-  }
-  siderust_azimuth_extrema_free(ptr, count);
-  return result;
+inline std::vector<AzimuthCrossingEvent>
+azimuth_crossing_events(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                        const Period<TT, MJD> &window, qtty::Degree bearing,
+                        const SearchOptions &opts, const char *operation) {
+  return collect<AzimuthCrossingEvent>([&](auto &&sink) {
+    azimuth_crossing_events(subj, obs, window, bearing, opts, operation, sink);
+  });
+}
+
+template <typename Sink>
+inline void azimuth_extremum_events(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                                    const Period<TT, MJD> &window, const SearchOptions &opts,
+                                    const char *operation, Sink &&sink) {
+  search_events<AzimuthExtremum>(
+      window, opts,
+      [&](const tempoch_period_mjd_t &w, auto &out) {
+        siderust_azimuth_extremum_t *ptr = nullptr;
+        uintptr_t count = 0;
+        check_status(siderust_azimuth_extrema(subj, obs, w, opts.to_c(), &ptr, &count), operation);
+        emit_from_c<AzimuthExtremum>(ptr, count, out);
+      },
+      [](const AzimuthExtremum &a, const AzimuthExtremum &b) { return a.kind == b.kind; }, sink);
+}
+
+inline std::vector<AzimuthExtremum>
+azimuth_extremum_events(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                        const Period<TT, MJD> &window, const SearchOptions &opts,
+                        const char *operation) {
+  return collect<AzimuthExtremum>(
+      [&](auto &&sink) { azimuth_extremum_events(subj, obs, window, opts, operation, sink); });
+}
+
+template <typename Sink>
+inline void in_azimuth_range_periods(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                                     const Period<TT, MJD> &window, qtty::Degree min_bearing,
+                                     qtty::Degree max_bearing, const SearchOptions &opts,
+                                     const char *operation, Sink &&sink) {
+  search_periods(
+      window, opts,
+      [&](const tempoch_period_mjd_t &w, auto &out) {
+        tempoch_period_mjd_t *ptr = nullptr;
+        uintptr_t count = 0;
+        check_status(siderust_in_azimuth_range(subj, obs, w, min_bearing.value(),
+                                               max_bearing.value(), opts.to_c(), &ptr, &count),
+                     operation);
+        emit_from_c<Period<TT, MJD>>(ptr, count, out);
+      },
+      sink);
+}
+
+inline std::vector<Period<TT, MJD>>
+in_azimuth_range_periods(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                         const Period<TT, MJD> &window, qtty::Degree min_bearing,
+                         qtty::Degree max_bearing, const SearchOptions &opts,
+                         const char *operation) {
+  return collect<Period<TT, MJD>>([&](auto &&sink) {
+    in_azimuth_range_periods(subj, obs, window, min_bearing, max_bearing, opts, operation, sink);
+  });
+}
+
+template <typename Sink>
+inline void outside_azimuth_range_periods(const siderust_subject_t &subj,
+                                          const siderust_geodetic_t &obs,
+                                          const Period<TT, MJD> &window, qtty::Degree min_bearing,
+                                          qtty::Degree max_bearing, const SearchOptions &opts,
+                                          const char *operation, Sink &&sink) {
+  search_periods(
+      window, opts,
+      [&](const tempoch_period_mjd_t &w, auto &out) {
+        tempoch_period_mjd_t *ptr = nullptr;
+        uintptr_t count = 0;
+        check_status(siderust_outside_azimuth_range(subj, obs, w, min_bearing.value(),
+                                                    max_bearing.value(), opts.to_c(), &ptr,
+                                                    &count),
+                     operation);
+        emit_from_c<Period<TT, MJD>>(ptr, count, out);
+      },
+      sink);
+}
+
+inline std::vector<Period<TT, MJD>>
+outside_azimuth_range_periods(const siderust_subject_t &subj, const siderust_geodetic_t &obs,
+                              const Period<TT, MJD> &window, qtty::Degree min_bearing,
+                              qtty::Degree max_bearing, const SearchOptions &opts,
+                              const char *operation) {
+  return collect<Period<TT, MJD>>([&](auto &&sink) {
+    outside_azimuth_range_periods(subj, obs, window, min_bearing, max_bearing, opts, operation,
+                                  sink);
+  });
 }
 
 } // namespace detail
@@ -120,13 +217,8 @@ inline std::vector<AzimuthCrossingEvent> azimuth_crossings(const Geodetic &obs,
                                                            const Period<TT, MJD> &window,
                                                            qtty::Degree bearing,
                                                            const SearchOptions &opts = {}) {
-  siderust_azimuth_crossing_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_azimuth_crossings(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
-                                          window.c_inner(), bearing.value(), opts.to_c(), &ptr,
-                                          &count),
-               "sun::azimuth_crossings");
-  return detail::az_crossings_from_c(ptr, count);
+  return detail::azimuth_crossing_events(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
+                                         window, bearing, opts, "sun::azimuth_crossings");
 }
 
 /**
@@ -135,12 +227,8 @@ inline std::vector<AzimuthCrossingEvent> azimuth_crossings(const Geodetic &obs,
 inline std::vector<AzimuthExtremum> azimuth_extrema(const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     const SearchOptions &opts = {}) {
-  siderust_azimuth_extremum_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_azimuth_extrema(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
-                                        window.c_inner(), opts.to_c(), &ptr, &count),
-               "sun::azimuth_extrema");
-  return detail::az_extrema_from_c(ptr, count);
+  return detail::azimuth_extremum_events(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
+                                         window, opts, "sun::azimuth_extrema");
 }
 
 /**
@@ -150,13 +238,9 @@ inline std::vector<AzimuthExtremum> azimuth_extrema(const Geodetic &obs,
 inline std::vector<Period<TT, MJD>>
 in_azimuth_range(const Geodetic &obs, const Period<TT, MJD> &window, qtty::Degree min_bearing,
                  qtty::Degree max_bearing, const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_in_azimuth_range(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
-                                         window.c_inner(), min_bearing.value(), max_bearing.value(),
-                                         opts.to_c(), &ptr, &count),
-               "sun::in_azimuth_range");
-  return detail::periods_from_c(ptr, count);
+  return detail::in_azimuth_range_periods(detail::make_body_subject(SIDERUST_BODY_SUN), obs.to_c(),
+                                          window, min_bearing, max_bearing, opts,
+                                          "sun::in_azimuth_range");
 }
 
 /**
@@ -166,13 +250,9 @@ in_azimuth_range(const Geodetic &obs, const Period<TT, MJD> &window, qtty::Degre
 inline std::vector<Period<TT, MJD>>
 outside_azimuth_range(const Geodetic &obs, const Period<TT, MJD> &window, qtty::Degree min_bearing,
                       qtty::Degree max_bearing, const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_outside_azimuth_range(detail::make_body_subject(SIDERUST_BODY_SUN),
-                                              obs.to_c(), window.c_inner(), min_bearing.value(),
-                                              max_bearing.value(), opts.to_c(), &ptr, &count),
-               "sun::outside_azimuth_range");
-  return detail::periods_from_c(ptr, count);
+  return detail::outside_azimuth_range_periods(detail::make_body_subject(SIDERUST_BODY_SUN),
+                                               obs.to_c(), window, min_bearing, max_bearing, opts,
+                                               "sun::outside_azimuth_range");
 }
 
 } // namespace sun
@@ -202,13 +282,8 @@ inline std::vector<AzimuthCrossingEvent> azimuth_crossings(const Geodetic &obs,
                                                            const Period<TT, MJD> &window,
                                                            qtty::Degree bearing,
                                                            const SearchOptions &opts = {}) {
-  siderust_azimuth_crossing_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_azimuth_crossings(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
-                                          window.c_inner(), bearing.value(), opts.to_c(), &ptr,
-                                          &count),
-               "moon::azimuth_crossings");
-  return detail::az_crossings_from_c(ptr, count);
+  return detail::azimuth_crossing_events(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
+                                         window, bearing, opts, "moon::azimuth_crossings");
 }
 
 /**
@@ -217,12 +292,8 @@ inline std::vector<AzimuthCrossingEvent> azimuth_crossings(const Geodetic &obs,
 inline std::vector<AzimuthExtremum> azimuth_extrema(const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     const SearchOptions &opts = {}) {
-  siderust_azimuth_extremum_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_azimuth_extrema(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
-                                        window.c_inner(), opts.to_c(), &ptr, &count),
-               "moon::azimuth_extrema");
-  return detail::az_extrema_from_c(ptr, count);
+  return detail::azimuth_extremum_events(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
+                                         window, opts, "moon::azimuth_extrema");
 }
 
 /**
@@ -232,13 +303,9 @@ inline std::vector<AzimuthExtremum> azimuth_extrema(const Geodetic &obs,
 inline std::vector<Period<TT, MJD>>
 in_azimuth_range(const Geodetic &obs, const Period<TT, MJD> &window, qtty::Degree min_bearing,
                  qtty::Degree max_bearing, const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_in_azimuth_range(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
-                                         window.c_inner(), min_bearing.value(), max_bearing.value(),
-                                         opts.to_c(), &ptr, &count),
-               "moon::in_azimuth_range");
-  return detail::periods_from_c(ptr, count);
+  return detail::in_azimuth_range_periods(detail::make_body_subject(SIDERUST_BODY_MOON), obs.to_c(),
+                                          window, min_bearing, max_bearing, opts,
+                                          "moon::in_azimuth_range");
 }
 
 /**
@@ -248,13 +315,9 @@ in_azimuth_range(const Geodetic &obs, const Period<TT, MJD> &window, qtty::Degre
 inline std::vector<Period<TT, MJD>>
 outside_azimuth_range(const Geodetic &obs, const Period<TT, MJD> &window, qtty::Degree min_bearing,
                       qtty::Degree max_bearing, const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_outside_azimuth_range(detail::make_body_subject(SIDERUST_BODY_MOON),
-                                              obs.to_c(), window.c_inner(), min_bearing.value(),
-                                              max_bearing.value(), opts.to_c(), &ptr, &count),
-               "moon::outside_azimuth_range");
-  return detail::periods_from_c(ptr, count);
+  return detail::outside_azimuth_range_periods(detail::make_body_subject(SIDERUST_BODY_MOON),
+                                               obs.to_c(), window, min_bearing, max_bearing, opts,
+                                               "moon::outside_azimuth_range");
 }
 
 } // namespace moon
@@ -284,13 +347,8 @@ inline std::vector<AzimuthCrossingEvent> azimuth_crossings(const Star &s, const
                                                            const Period<TT, MJD> &window,
                                                            qtty::Degree bearing,
                                                            const SearchOptions &opts = {}) {
-  siderust_azimuth_crossing_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_azimuth_crossings(detail::make_star_subject(s.c_handle()), obs.to_c(),
-                                          window.c_inner(), bearing.value(), opts.to_c(), &ptr,
-                                          &count),
-               "star_altitude::azimuth_crossings");
-  return detail::az_crossings_from_c(ptr, count);
+  return detail::azimuth_crossing_events(detail::make_star_subject(s.c_handle()), obs.to_c(),
+                                         window, bearing, opts, "star_altitude::azimuth_crossings");
 }
 
 /**
@@ -301,13 +359,9 @@ inline std::vector<Period<TT, MJD>> in_azimuth_range(const Star &s, const Geodet
                                                      qtty::Degree min_bearing,
                                                      qtty::Degree max_bearing,
                                                      const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_in_azimuth_range(detail::make_star_subject(s.c_handle()), obs.to_c(),
-                                         window.c_inner(), min_bearing.value(), max_bearing.value(),
-                                         opts.to_c(), &ptr, &count),
-               "star_altitude::in_azimuth_range");
-  return detail::periods_from_c(ptr, count);
+  return detail::in_azimuth_range_periods(detail::make_star_subject(s.c_handle()), obs.to_c(),
+                                          window, min_bearing, max_bearing, opts,
+                                          "star_altitude::in_azimuth_range");
 }
 
 /**
@@ -318,13 +372,9 @@ inline std::vector<Period<TT, MJD>> outside_azimuth_range(const Star &s, const G
                                                           qtty::Degree min_bearing,
                                                           qtty::Degree max_bearing,
                                                           const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_outside_azimuth_range(detail::make_star_subject(s.c_handle()), obs.to_c(),
-                                              window.c_inner(), min_bearing.value(),
-                                              max_bearing.value(), opts.to_c(), &ptr, &count),
-               "star_altitude::outside_azimuth_range");
-  return detail::periods_from_c(ptr, count);
+  return detail::outside_azimuth_range_periods(detail::make_star_subject(s.c_handle()), obs.to_c(),
+                                               window, min_bearing, max_bearing, opts,
+                                               "star_altitude::outside_azimuth_range");
 }
 
 } // namespace star_altitude
@@ -363,13 +413,8 @@ inline std::vector<AzimuthCrossingEvent> azimuth_crossings(const spherical::dire
                                                            const Period<TT, MJD> &window,
                                                            qtty::Degree bearing,
                                                            const SearchOptions &opts = {}) {
-  siderust_azimuth_crossing_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_azimuth_crossings(detail::make_icrs_subject(dir.to_c()), obs.to_c(),
-                                          window.c_inner(), bearing.value(), opts.to_c(), &ptr,
-                                          &count),
-               "icrs_altitude::azimuth_crossings");
-  return detail::az_crossings_from_c(ptr, count);
+  return detail::azimuth_crossing_events(detail::make_icrs_subject(dir.to_c()), obs.to_c(), window,
+                                         bearing, opts, "icrs_altitude::azimuth_crossings");
 }
 
 /**
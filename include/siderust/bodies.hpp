@@ -175,6 +175,7 @@ inline Planet neptune() { return NEPTUNE(); }
  */
 class Star {
   SiderustStar *m_handle = nullptr;
+  std::optional<spherical::direction::ICRS> m_fixed_position;
 
   explicit Star(SiderustStar *h) : m_handle(h) {}
 
@@ -186,12 +187,15 @@ public:
   }
 
   // Move-only
-  Star(Star &&o) noexcept : m_handle(o.m_handle) { o.m_handle = nullptr; }
+  Star(Star &&o) noexcept : m_handle(o.m_handle), m_fixed_position(o.m_fixed_position) {
+    o.m_handle = nullptr;
+  }
   Star &operator=(Star &&o) noexcept {
     if (this != &o) {
       if (m_handle)
         siderust_star_free(m_handle);
       m_handle = o.m_handle;
+      m_fixed_position = o.m_fixed_position;
       o.m_handle = nullptr;
     }
     return *this;
@@ -243,7 +247,10 @@ public:
                                       properties.luminosity.value, position.ra().value(),
                                       position.dec().value(), epoch.value(), pm_ptr, &h),
                  "Star::create");
-    return Star(h);
+    Star star(h);
+    if (!pm.has_value())
+      star.m_fixed_position = position;
+    return star;
   }
 
   // -- Accessors --
@@ -255,6 +262,12 @@ public:
     return std::string(buf, written);
   }
 
+  /// ICRS direction of a star created without proper motion; `nullopt`
+  /// for catalog stars and stars with proper motion.
+  const std::optional<spherical::direction::ICRS> &fixed_position() const {
+    return m_fixed_position;
+  }
+
   double distance_ly() const { return siderust_star_distance_ly(m_handle); }
   double mass_solar() const { return siderust_star_mass_solar(m_handle); }
   double radius_solar() const { return siderust_star_radius_solar(m_handle); }
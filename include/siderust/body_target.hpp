@@ -29,6 +29,7 @@
 
 #include "altitude.hpp"
 #include "azimuth.hpp"
+#include "ephemeris_provider.hpp"
 #include "ffi_core.hpp"
 #include "trackable.hpp"
 #include <string>
@@ -73,6 +74,28 @@ inline qtty::Radian altitude_at(Body b, const Geodetic &obs, const Time<TT, MJD>
   return qtty::Radian(out);
 }
 
+/**
+ * @brief A body's altitude (radians) at every instant of `mjds`.
+ *
+ * The subject and observer are marshalled once for the whole series.
+ *
+ * @throws InvalidDimensionError if `out.size() != mjds.size()`.
+ */
+inline void altitude_at(Body b, const Geodetic &obs, span<const Time<TT, MJD>> mjds,
+                        span<qtty::Radian> out) {
+  detail::altitude_batch(detail::make_body_subject(static_cast<SiderustBody>(b)), obs, mjds, out,
+                         "body::altitude_at(span)");
+}
+
+/**
+ * @brief A body's altitude (radians) at every instant of `mjds`.
+ */
+inline std::vector<qtty::Radian> altitude_at(Body b, const Geodetic &obs,
+                                             span<const Time<TT, MJD>> mjds) {
+  return detail::altitude_batch(detail::make_body_subject(static_cast<SiderustBody>(b)), obs,
+                                mjds, "body::altitude_at(span)");
+}
+
 /**
  * @brief Find periods when a body is above a threshold altitude.
  */
@@ -80,13 +103,9 @@ inline std::vector<Period<TT, MJD>> above_threshold(Body b, const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_above_threshold(detail::make_body_subject(static_cast<SiderustBody>(b)),
-                                        obs.to_c(), window.c_inner(), threshold.value(),
-                                        opts.to_c(), &ptr, &count),
-               "body::above_threshold");
-  return detail::periods_from_c(ptr, count);
+  return detail::above_threshold_periods(detail::make_body_subject(static_cast<SiderustBody>(b)),
+                                         obs.to_c(), window, threshold, opts,
+                                         "body::above_threshold");
 }
 
 /**
@@ -96,13 +115,9 @@ inline std::vector<Period<TT, MJD>> below_threshold(Body b, const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_below_threshold(detail::make_body_subject(static_cast<SiderustBody>(b)),
-                                        obs.to_c(), window.c_inner(), threshold.value(),
-                                        opts.to_c(), &ptr, &count),
-               "body::below_threshold");
-  return detail::periods_from_c(ptr, count);
+  return detail::below_threshold_periods(detail::make_body_subject(static_cast<SiderustBody>(b)),
+                                         obs.to_c(), window, threshold, opts,
+                                         "body::below_threshold");
 }
 
 /**
@@ -111,13 +126,8 @@ inline std::vector<Period<TT, MJD>> below_threshold(Body b, const Geodetic &obs,
 inline std::vector<CrossingEvent> crossings(Body b, const Geodetic &obs,
                                             const Period<TT, MJD> &window, qtty::Degree threshold,
                                             const SearchOptions &opts = {}) {
-  siderust_crossing_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_crossings(detail::make_body_subject(static_cast<SiderustBody>(b)),
-                                  obs.to_c(), window.c_inner(), threshold.value(), opts.to_c(),
-                                  &ptr, &count),
-               "body::crossings");
-  return detail::crossings_from_c(ptr, count);
+  return detail::crossing_events(detail::make_body_subject(static_cast<SiderustBody>(b)),
+                                 obs.to_c(), window, threshold, opts, "body::crossings");
 }
 
 /**
@@ -126,12 +136,8 @@ inline std::vector<CrossingEvent> crossings(Body b, const Geodetic &obs,
 inline std::vector<CulminationEvent> culminations(Body b, const Geodetic &obs,
                                                   const Period<TT, MJD> &window,
                                                   const SearchOptions &opts = {}) {
-  siderust_culmination_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_culminations(detail::make_body_subject(static_cast<SiderustBody>(b)),
-                                     obs.to_c(), window.c_inner(), opts.to_c(), &ptr, &count),
-               "body::culminations");
-  return detail::culminations_from_c(ptr, count);
+  return detail::culmination_events(detail::make_body_subject(static_cast<SiderustBody>(b)),
+                                    obs.to_c(), window, opts, "body::culminations");
 }
 
 /**
@@ -141,13 +147,9 @@ inline std::vector<Period<TT, MJD>> altitude_ranges(Body b, const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree min_alt, qtty::Degree max_alt,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_altitude_ranges(detail::make_body_subject(static_cast<SiderustBody>(b)),
-                                        obs.to_c(), window.c_inner(), min_alt.value(),
-                                        max_alt.value(), opts.to_c(), &ptr, &count),
-               "body::altitude_ranges");
-  return detail::periods_from_c(ptr, count);
+  return detail::altitude_range_periods(detail::make_body_subject(static_cast<SiderustBody>(b)),
+                                        obs.to_c(), window, min_alt, max_alt, opts,
+                                        "body::altitude_ranges");
 }
 
 } // namespace body
@@ -174,13 +176,9 @@ inline std::vector<AzimuthCrossingEvent> azimuth_crossings(Body b, const Geodeti
                                                            const Period<TT, MJD> &window,
                                                            qtty::Degree bearing,
                                                            const SearchOptions &opts = {}) {
-  siderust_azimuth_crossing_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_azimuth_crossings(detail::make_body_subject(static_cast<SiderustBody>(b)),
-                                          obs.to_c(), window.c_inner(), bearing.value(),
-                                          opts.to_c(), &ptr, &count),
-               "body::azimuth_crossings");
-  return detail::az_crossings_from_c(ptr, count);
+  return detail::azimuth_crossing_events(detail::make_body_subject(static_cast<SiderustBody>(b)),
+                                         obs.to_c(), window, bearing, opts,
+                                         "body::azimuth_crossings");
 }
 
 /**
@@ -189,12 +187,8 @@ inline std::vector<AzimuthCrossingEvent> azimuth_crossings(Body b, const Geodeti
 inline std::vector<AzimuthExtremum> azimuth_extrema(Body b, const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     const SearchOptions &opts = {}) {
-  siderust_azimuth_extremum_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_azimuth_extrema(detail::make_body_subject(static_cast<SiderustBody>(b)),
-                                        obs.to_c(), window.c_inner(), opts.to_c(), &ptr, &count),
-               "body::azimuth_extrema");
-  return detail::az_extrema_from_c(ptr, count);
+  return detail::azimuth_extremum_events(detail::make_body_subject(static_cast<SiderustBody>(b)),
+                                         obs.to_c(), window, opts, "body::azimuth_extrema");
 }
 
 /**
@@ -204,13 +198,9 @@ inline std::vector<Period<TT, MJD>> in_azimuth_range(Body b, const Geodetic &obs
                                                      const Period<TT, MJD> &window,
                                                      qtty::Degree min, qtty::Degree max,
                                                      const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_in_azimuth_range(detail::make_body_subject(static_cast<SiderustBody>(b)),
-                                         obs.to_c(), window.c_inner(), min.value(), max.value(),
-                                         opts.to_c(), &ptr, &count),
-               "body::in_azimuth_range");
-  return detail::periods_from_c(ptr, count);
+  return detail::in_azimuth_range_periods(detail::make_body_subject(static_cast<SiderustBody>(b)),
+                                          obs.to_c(), window, min, max, opts,
+                                          "body::in_azimuth_range");
 }
 
 } // namespace body
@@ -278,6 +268,12 @@ public:
     return qtty::Degree(rad.value() * 180.0 / 3.14159265358979323846);
   }
 
+  void altitude_at(const Geodetic &obs, span<const Time<TT, MJD>> mjds,
+                   span<qtty::Degree> out) const override {
+    detail::altitude_batch(detail::make_body_subject(static_cast<SiderustBody>(body_)), obs, mjds,
+                           out, "BodyTarget::altitude_at(span)");
+  }
+
   std::vector<Period<TT, MJD>> above_threshold(const Geodetic &obs, const Period<TT, MJD> &window,
                                                qtty::Degree threshold,
                                                const SearchOptions &opts = {}) const override {
@@ -316,6 +312,40 @@ public:
     return body::azimuth_crossings(body_, obs, window, bearing, opts);
   }
 
+  // ------------------------------------------------------------------
+  // Queries against a chosen ephemeris (defined in ephemeris_search.hpp)
+  // ------------------------------------------------------------------
+
+  qtty::Degree altitude_at(const Geodetic &obs, const Time<TT, MJD> &mjd,
+                           const EphemerisProvider &eph) const;
+
+  std::vector<Period<TT, MJD>> above_threshold(const Geodetic &obs, const Period<TT, MJD> &window,
+                                               qtty::Degree threshold,
+                                               const EphemerisProvider &eph,
+                                               const SearchOptions &opts = {}) const;
+
+  std::vector<Period<TT, MJD>> below_threshold(const Geodetic &obs, const Period<TT, MJD> &window,
+                                               qtty::Degree threshold,
+                                               const EphemerisProvider &eph,
+                                               const SearchOptions &opts = {}) const;
+
+  std::vector<CrossingEvent> crossings(const Geodetic &obs, const Period<TT, MJD> &window,
+                                       qtty::Degree threshold, const EphemerisProvider &eph,
+                                       const SearchOptions &opts = {}) const;
+
+  std::vector<CulminationEvent> culminations(const Geodetic &obs, const Period<TT, MJD> &window,
+                                             const EphemerisProvider &eph,
+                                             const SearchOptions &opts = {}) const;
+
+  qtty::Degree azimuth_at(const Geodetic &obs, const Time<TT, MJD> &mjd,
+                          const EphemerisProvider &eph) const;
+
+  std::vector<AzimuthCrossingEvent> azimuth_crossings(const Geodetic &obs,
+                                                      const Period<TT, MJD> &window,
+                                                      qtty::Degree bearing,
+                                                      const EphemerisProvider &eph,
+                                                      const SearchOptions &opts = {}) const;
+
   /// Access the underlying Body enum value.
   Body body() const { return body_; }
 
@@ -0,0 +1,397 @@
+#pragma once
+
+/**
+ * @file compact_catalog.hpp
+ * @brief Memory-compact ICRS star catalog.
+ *
+ * A `spherical::direction::ICRS` costs 16 bytes and an `ICRSTarget` well over
+ * 100 (FFI handle, label string, original and ICRS copies), which rules out
+ * holding survey-sized catalogs in RAM. `CompactCatalog` stores per star:
+ *
+ * | Field                     | Encoding                          | Bytes |
+ * |---------------------------|-----------------------------------|-------|
+ * | Direction                 | octahedral unit vector, 2 × int32 | 8     |
+ * | Proper motion (optional)  | μα*, μδ in mas/yr, 2 × float32    | 8     |
+ * | Label (optional)          | interned string id, uint32        | 4     |
+ *
+ * so the per-star columns of 100 M sources take 0.8–2 GB. Optional columns
+ * cost nothing until the first star that uses them is added. Each
+ * *distinct* label costs another ~80 bytes on 64-bit targets (string object,
+ * hash-index node and bucket), plus its text when longer than the
+ * small-string buffer. Labels are therefore cheap when shared or sparse.
+ * Unique names for all 100 M stars would add ~8 GB or more;
+ * `memory_bytes()` reports the total.
+ *
+ * **Precision.** The octahedral map sends the sphere onto a square without
+ * trigonometry; with 31-bit coordinates a decoded direction lies within
+ * `kMaxErrorMas` (0.21 mas, ≈1.0e-9 rad) of the input everywhere on the
+ * sphere. Proper motions are kept to float32 precision (~1e-7 relative).
+ *
+ * @code
+ * CompactCatalog gaia(Time<TT, JD>(2457389.0));          // J2016.0
+ * gaia.reserve(n);
+ * for (const auto &row : rows) gaia.add(row.dir, row.pm);
+ * std::vector<spherical::direction::ICRS> chunk(4096);
+ * gaia.decode(first, chunk, now);                       // → horizontal_at, ...
+ * @endcode
+ */
+
+#include "bodies.hpp"
+#include "coordinates/arrays.hpp"
+#include "coordinates/cartesian.hpp"
+#include "coordinates/spherical.hpp"
+#include "ffi_core.hpp"
+#include "span.hpp"
+#include "target.hpp"
+#include "time.hpp"
+
+#include <qtty/qtty.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace siderust {
+
+/**
+ * @brief Compact, append-only catalog of ICRS directions with optional proper
+ *        motions and labels.
+ *
+ * Stars are addressed by insertion index. Proper motions use the Gaia
+ * convention (`RaConvention::MuAlphaStar`, mas/yr) and are propagated from
+ * `epoch()` as uniform rectilinear motion with zero radial velocity and no
+ * parallax — the same first-order space motion as a catalog without RV.
+ */
+class CompactCatalog {
+public:
+  /// Upper bound on the angular error of a stored direction, in mas.
+  static constexpr double kMaxErrorMas = 0.21;
+
+  /// Catalog whose positions and proper motions refer to `epoch`.
+  explicit CompactCatalog(const Time<TT, JD> &epoch = Time<TT, JD>::J2000()) : epoch_(epoch) {
+    labels_.emplace_back(); // id 0: no label
+  }
+
+  /// Catalog of `dirs` (no proper motion, no labels) at `epoch`.
+  explicit CompactCatalog(span<const spherical::direction::ICRS> dirs,
+                          const Time<TT, JD> &epoch = Time<TT, JD>::J2000())
+      : CompactCatalog(epoch) {
+    reserve(dirs.size());
+    for (const auto &d : dirs) {
+      add(d);
+    }
+  }
+
+  CompactCatalog(const CompactCatalog &other)
+      : epoch_(other.epoch_), dirs_(other.dirs_), pm_(other.pm_), label_ids_(other.label_ids_),
+        labels_(other.labels_) {
+    reindex_labels();
+  }
+
+  CompactCatalog &operator=(const CompactCatalog &other) {
+    if (this != &other) {
+      CompactCatalog copy(other);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  CompactCatalog(CompactCatalog &&) noexcept = default;
+  CompactCatalog &operator=(CompactCatalog &&) noexcept = default;
+
+  // -- Building -------------------------------------------------------------
+
+  /// Reserve room for `n` stars in every column currently in use.
+  void reserve(std::size_t n) {
+    dirs_.reserve(2 * n);
+    if (!pm_.empty()) {
+      pm_.reserve(2 * n);
+    }
+    if (!label_ids_.empty()) {
+      label_ids_.reserve(n);
+    }
+  }
+
+  /// Append a star; returns its index.
+  std::size_t add(const spherical::direction::ICRS &dir) {
+    const auto v = dir.to_cartesian();
+    std::int32_t u, w;
+    encode(v.x, v.y, v.z, u, w);
+    dirs_.push_back(u);
+    dirs_.push_back(w);
+    if (!pm_.empty()) {
+      pm_.push_back(0.0f);
+      pm_.push_back(0.0f);
+    }
+    if (!label_ids_.empty()) {
+      label_ids_.push_back(0);
+    }
+    return size() - 1;
+  }
+
+  /// Append a star with proper motion.
+  std::size_t add(const spherical::direction::ICRS &dir, const ProperMotion &pm) {
+    const std::size_t i = add(dir);
+    if (pm_.empty()) {
+      pm_.assign(2 * size(), 0.0f);
+    }
+    const double mas_per_yr = 365.25 * 3.6e6;
+    double ra = pm.ra.deg_per_day() * mas_per_yr;
+    if (pm.convention == RaConvention::MuAlpha) {
+      ra *= std::cos(dir.dec().value() * kDeg2Rad);
+    }
+    pm_[2 * i] = static_cast<float>(ra);
+    pm_[2 * i + 1] = static_cast<float>(pm.dec.deg_per_day() * mas_per_yr);
+    return i;
+  }
+
+  /// Append a labelled star; equal labels share one stored string.
+  std::size_t add(const spherical::direction::ICRS &dir, std::string_view label) {
+    return set_label(add(dir), label);
+  }
+
+  /// Append a labelled star with proper motion.
+  std::size_t add(const spherical::direction::ICRS &dir, const ProperMotion &pm,
+                  std::string_view label) {
+    return set_label(add(dir, pm), label);
+  }
+
+  // -- Accessors ------------------------------------------------------------
+
+  std::size_t size() const noexcept { return dirs_.size() / 2; }
+  bool empty() const noexcept { return dirs_.empty(); }
+  const Time<TT, JD> &epoch() const noexcept { return epoch_; }
+  bool has_proper_motion() const noexcept { return !pm_.empty(); }
+
+  /// Number of distinct labels stored.
+  std::size_t label_count() const noexcept { return labels_.size() - 1; }
+
+  /**
+   * @brief Heap bytes held by the per-star columns and the label table.
+   *
+   * Exact for the columns. The label table is estimated from its layout:
+   * one `std::string` per interned label, plus its buffer when the text
+   * outgrows the small-string storage, and one bucket pointer and one node
+   * (next pointer, key, id and cached hash) per `label_index_` entry.
+   * Allocator headers and the deque's block map are not counted.
+   */
+  std::size_t memory_bytes() const noexcept {
+    std::size_t bytes = dirs_.capacity() * sizeof(std::int32_t) +
+                        pm_.capacity() * sizeof(float) +
+                        label_ids_.capacity() * sizeof(std::uint32_t);
+
+    const std::size_t sso_capacity = std::string().capacity();
+    bytes += labels_.size() * sizeof(std::string);
+    for (const auto &l : labels_) {
+      if (l.capacity() > sso_capacity) {
+        bytes += l.capacity() + 1;
+      }
+    }
+
+    using IndexEntry = decltype(label_index_)::value_type;
+    bytes += label_index_.bucket_count() * sizeof(void *);
+    bytes += label_index_.size() * (sizeof(void *) + sizeof(IndexEntry) + sizeof(std::size_t));
+    return bytes;
+  }
+
+  /// Unit vector of star `i` at `epoch()`. `i` must be `< size()`.
+  cartesian::Direction<frames::ICRS> unit_vector(std::size_t i) const {
+    double x, y, z;
+    decode_unit(dirs_[2 * i], dirs_[2 * i + 1], x, y, z);
+    return cartesian::Direction<frames::ICRS>(x, y, z);
+  }
+
+  /// Direction of star `i` at `epoch()`. `i` must be `< size()`.
+  spherical::direction::ICRS direction(std::size_t i) const {
+    return to_icrs(unit_vector(i));
+  }
+
+  /// Direction of star `i` propagated to `jd` by its proper motion.
+  spherical::direction::ICRS direction(std::size_t i, const Time<TT, JD> &jd) const {
+    return to_icrs(propagated(i, years_since_epoch(jd)));
+  }
+
+  /// Proper motion of star `i` (zero when the catalog has none).
+  ProperMotion proper_motion(std::size_t i) const {
+    const double ra = pm_.empty() ? 0.0 : pm_[2 * i];
+    const double dec = pm_.empty() ? 0.0 : pm_[2 * i + 1];
+    const qtty::Day year(365.25);
+    return ProperMotion{AngularRate{qtty::Degree(ra / 3.6e6), year},
+                        AngularRate{qtty::Degree(dec / 3.6e6), year}, RaConvention::MuAlphaStar};
+  }
+
+  /// Label of star `i`; empty when it has none.
+  std::string_view label(std::size_t i) const {
+    return label_ids_.empty() ? std::string_view() : std::string_view(labels_[label_ids_[i]]);
+  }
+
+  // -- Bulk decoding --------------------------------------------------------
+
+  /**
+   * @brief Decode stars `[first, first + out.size())` at `epoch()`.
+   *
+   * @throws OutOfRangeError if the range runs past `size()`.
+   */
+  void decode(std::size_t first, span<spherical::direction::ICRS> out) const {
+    check_range(first, out.size(), "CompactCatalog::decode");
+    for (std::size_t k = 0; k < out.size(); ++k) {
+      out[k] = direction(first + k);
+    }
+  }
+
+  /// Decode a range propagated to `jd`.
+  void decode(std::size_t first, span<spherical::direction::ICRS> out,
+              const Time<TT, JD> &jd) const {
+    check_range(first, out.size(), "CompactCatalog::decode");
+    const double years = years_since_epoch(jd);
+    for (std::size_t k = 0; k < out.size(); ++k) {
+      out[k] = to_icrs(propagated(first + k, years));
+    }
+  }
+
+  /// Decode `count` stars from `first` into a SoA unit-vector array at `jd`;
+  /// `out` is resized to `count`.
+  void decode(std::size_t first, std::size_t count, cartesian::DirectionArray<frames::ICRS> &out,
+              const Time<TT, JD> &jd) const {
+    check_range(first, count, "CompactCatalog::decode");
+    out.resize(count);
+    const double years = years_since_epoch(jd);
+    for (std::size_t k = 0; k < count; ++k) {
+      const auto v = propagated(first + k, years);
+      out.x()[k] = v.x;
+      out.y()[k] = v.y;
+      out.z()[k] = v.z;
+    }
+  }
+
+  // -- Targets --------------------------------------------------------------
+
+  /// Materialise star `i` as an FFI-backed target for the altitude APIs.
+  ICRSTarget target(std::size_t i) const {
+    check_range(i, 1, "CompactCatalog::target");
+    return ICRSTarget(direction(i), epoch_, std::string(label(i)));
+  }
+
+  /// Materialise star `i` with its proper motion.
+  ProperMotionTarget proper_motion_target(std::size_t i) const {
+    check_range(i, 1, "CompactCatalog::proper_motion_target");
+    return ProperMotionTarget(direction(i), epoch_, proper_motion(i), std::string(label(i)));
+  }
+
+private:
+  static constexpr double kScale = 2147483647.0;
+  static constexpr double kDeg2Rad = constants::pi / 180.0;
+  static constexpr double kMasPerYrToRadPerYr = kDeg2Rad / 3.6e6;
+
+  static double sign(double a) { return a < 0.0 ? -1.0 : 1.0; }
+
+  static spherical::direction::ICRS to_icrs(const cartesian::Direction<frames::ICRS> &v) {
+    double lon, lat;
+    detail::soa_cartesian_to_spherical(&v.x, &v.y, &v.z, 1, &lon, &lat, nullptr);
+    return spherical::direction::ICRS(qtty::Degree(lon), qtty::Degree(lat));
+  }
+
+  /// Octahedral encoding: project onto |x|+|y|+|z| = 1, fold the southern
+  /// hemisphere over the diagonals, quantise to 31 bits.
+  static void encode(double x, double y, double z, std::int32_t &u, std::int32_t &w) {
+    const double s = std::fabs(x) + std::fabs(y) + std::fabs(z);
+    double a = x / s;
+    double b = y / s;
+    if (z < 0.0) {
+      const double fa = (1.0 - std::fabs(b)) * sign(a);
+      b = (1.0 - std::fabs(a)) * sign(b);
+      a = fa;
+    }
+    u = static_cast<std::int32_t>(std::lround(a * kScale));
+    w = static_cast<std::int32_t>(std::lround(b * kScale));
+  }
+
+  static void decode_unit(std::int32_t u, std::int32_t w, double &x, double &y, double &z) {
+    double a = u / kScale;
+    double b = w / kScale;
+    const double c = 1.0 - std::fabs(a) - std::fabs(b);
+    if (c < 0.0) {
+      const double fa = (1.0 - std::fabs(b)) * sign(a);
+      b = (1.0 - std::fabs(a)) * sign(b);
+      a = fa;
+    }
+    const double inv = 1.0 / std::sqrt(a * a + b * b + c * c);
+    x = a * inv;
+    y = b * inv;
+    z = c * inv;
+  }
+
+  double years_since_epoch(const Time<TT, JD> &jd) const {
+    return (jd.value() - epoch_.value()) / 365.25;
+  }
+
+  /// Unit vector after `years` of proper motion along the local east and
+  /// north axes, renormalised.
+  cartesian::Direction<frames::ICRS> propagated(std::size_t i, double years) const {
+    auto p = unit_vector(i);
+    if (pm_.empty() || years == 0.0) {
+      return p;
+    }
+    const double rho = std::sqrt(p.x * p.x + p.y * p.y);
+    if (rho == 0.0) {
+      return p; // exactly at a pole the east/north basis is undefined
+    }
+    const double e = pm_[2 * i] * kMasPerYrToRadPerYr * years;     // east
+    const double n = pm_[2 * i + 1] * kMasPerYrToRadPerYr * years; // north
+    const double x = p.x + e * (-p.y / rho) + n * (-p.z * p.x / rho);
+    const double y = p.y + e * (p.x / rho) + n * (-p.z * p.y / rho);
+    const double z = p.z + n * rho;
+    const double inv = 1.0 / std::sqrt(x * x + y * y + z * z);
+    return cartesian::Direction<frames::ICRS>(x * inv, y * inv, z * inv);
+  }
+
+  std::size_t set_label(std::size_t i, std::string_view label) {
+    if (label.empty()) {
+      return i;
+    }
+    if (label_ids_.empty()) {
+      label_ids_.assign(size(), 0);
+    }
+    auto it = label_index_.find(label);
+    if (it == label_index_.end()) {
+      labels_.emplace_back(label);
+      it = label_index_
+               .emplace(std::string_view(labels_.back()),
+                        static_cast<std::uint32_t>(labels_.size() - 1))
+               .first;
+    }
+    label_ids_[i] = it->second;
+    return i;
+  }
+
+  /// `label_index_` keys view into `labels_`, so copies re-point them.
+  void reindex_labels() {
+    label_index_.clear();
+    for (std::size_t id = 1; id < labels_.size(); ++id) {
+      label_index_.emplace(std::string_view(labels_[id]), static_cast<std::uint32_t>(id));
+    }
+  }
+
+  void check_range(std::size_t first, std::size_t count, const char *operation) const {
+    if (first > size() || count > size() - first) {
+      throw OutOfRangeError(std::string(operation) + ": range [" + std::to_string(first) + ", " +
+                            std::to_string(first + count) + ") exceeds catalog size " +
+                            std::to_string(size()));
+    }
+  }
+
+  Time<TT, JD> epoch_;
+  std::vector<std::int32_t> dirs_;       ///< Interleaved octahedral (u, w).
+  std::vector<float> pm_;                ///< Interleaved (μα*, μδ) in mas/yr, or empty.
+  std::vector<std::uint32_t> label_ids_; ///< Index into `labels_`, or empty.
+  std::deque<std::string> labels_;       ///< Interned labels; `labels_[0]` is "".
+  std::unordered_map<std::string_view, std::uint32_t> label_index_;
+};
+
+} // namespace siderust
@@ -22,7 +22,12 @@
  * This umbrella header includes:
  * - `coordinates/geodetic.hpp`
  * - `coordinates/spherical.hpp`
+ * - `coordinates/arrays.hpp`
  * - `coordinates/cartesian.hpp`
+ * - `coordinates/center_shift.hpp`
+ * - `coordinates/frame_rotation.hpp`
+ * - `coordinates/horizontal_projector.hpp`
+ * - `coordinates/interpolated_rotation.hpp`
  * - `coordinates/types.hpp`
  * - `coordinates/conversions.hpp`
  *
@@ -49,9 +54,14 @@
  *  @ingroup coordinates
  */
 
+#include "coordinates/arrays.hpp"
 #include "coordinates/cartesian.hpp"
+#include "coordinates/center_shift.hpp"
 #include "coordinates/conversions.hpp"
+#include "coordinates/frame_rotation.hpp"
 #include "coordinates/geodetic.hpp"
+#include "coordinates/horizontal_projector.hpp"
+#include "coordinates/interpolated_rotation.hpp"
 #include "coordinates/pos_conversions.hpp"
 #include "coordinates/spherical.hpp"
 #include "coordinates/types.hpp"
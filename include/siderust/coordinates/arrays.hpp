@@ -0,0 +1,502 @@
+#pragma once
+
+/**
+ * @file arrays.hpp
+ * @ingroup coordinates
+ * @brief Structure-of-arrays coordinate containers and bulk kernels.
+ *
+ * `cartesian::Position`, `spherical::Direction` and friends are single-value
+ * structs, so a catalog stored as `std::vector<Direction<F>>` interleaves its
+ * components and every conversion runs one scalar `sin`/`cos`/`atan2` at a
+ * time. The containers here keep each component in its own contiguous
+ * `double` array while preserving the frame/center/unit tags at compile time:
+ *
+ * | Container                            | Components                   |
+ * |--------------------------------------|------------------------------|
+ * | `cartesian::DirectionArray<F>`       | `x`, `y`, `z` (unitless)     |
+ * | `cartesian::PositionArray<C, F, U>`  | `x`, `y`, `z` (in `U`)       |
+ * | `spherical::DirectionArray<F>`       | `azimuth`, `polar` (degrees) |
+ * | `spherical::PositionArray<C, F, U>`  | `azimuth`, `polar`, `distance` |
+ *
+ * The free functions `to_cartesian` and `to_spherical` (and the fused
+ * spherical rotation in `FrameRotation`) evaluate `sin`/`cos`/`atan2` with the
+ * branch-free polynomial kernels of `detail/vector_math.hpp`, so GCC and Clang
+ * vectorise them at `-O3` without `-ffast-math`: SSE2 by default, AVX2 or
+ * AVX-512 under `-march=native`. Results agree with the scalar `std::` path
+ * to a few ulp. `angular_separation` keeps `std::atan2`.
+ */
+
+#include "../constants.hpp"
+#include "../ffi_core.hpp"
+#include "../span.hpp"
+#include "../detail/vector_math.hpp"
+#include "cartesian.hpp"
+#include "spherical.hpp"
+
+#include <qtty/qtty.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace siderust {
+
+namespace detail {
+
+constexpr double kSoaRad2Deg = 180.0 / constants::pi;
+
+/// `(lon, lat)` in degrees (and optional radius) → Cartesian components.
+///
+/// One loop per radius case keeps the `r` test out of the vectorised body.
+inline void soa_spherical_to_cartesian(const double *SIDERUST_RESTRICT lon,
+                                       const double *SIDERUST_RESTRICT lat,
+                                       const double *SIDERUST_RESTRICT r, std::size_t n,
+                                       double *SIDERUST_RESTRICT x, double *SIDERUST_RESTRICT y,
+                                       double *SIDERUST_RESTRICT z) {
+  if (r) {
+    for (std::size_t i = 0; i < n; ++i) {
+      double sa, ca, sp, cp;
+      vsincos_deg(lon[i], sa, ca);
+      vsincos_deg(lat[i], sp, cp);
+      x[i] = r[i] * cp * ca;
+      y[i] = r[i] * cp * sa;
+      z[i] = r[i] * sp;
+    }
+    return;
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    double sa, ca, sp, cp;
+    vsincos_deg(lon[i], sa, ca);
+    vsincos_deg(lat[i], sp, cp);
+    x[i] = cp * ca;
+    y[i] = cp * sa;
+    z[i] = sp;
+  }
+}
+
+/// Cartesian components → `(lon, lat)` in degrees (and optional radius).
+///
+/// One loop per radius case keeps the `r` test out of the vectorised body.
+inline void soa_cartesian_to_spherical(const double *SIDERUST_RESTRICT x,
+                                       const double *SIDERUST_RESTRICT y,
+                                       const double *SIDERUST_RESTRICT z, std::size_t n,
+                                       double *SIDERUST_RESTRICT lon,
+                                       double *SIDERUST_RESTRICT lat,
+                                       double *SIDERUST_RESTRICT r) {
+  if (r) {
+    for (std::size_t i = 0; i < n; ++i) {
+      const double rho2 = x[i] * x[i] + y[i] * y[i];
+      const double l = vatan2_deg(y[i], x[i]);
+      lon[i] = l + (l < 0.0 ? 360.0 : 0.0);
+      lat[i] = vatan2_deg(z[i], vsqrt(rho2));
+      r[i] = vsqrt(rho2 + z[i] * z[i]);
+    }
+    return;
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    const double l = vatan2_deg(y[i], x[i]);
+    lon[i] = l + (l < 0.0 ? 360.0 : 0.0);
+    lat[i] = vatan2_deg(z[i], vsqrt(x[i] * x[i] + y[i] * y[i]));
+  }
+}
+
+/// Angle (degrees) between unit vectors `(x, y, z)[i]` and `(rx, ry, rz)`.
+///
+/// Uses `atan2(|a × b|, a · b)`, which is as well-conditioned as the Vincenty
+/// form used by `Direction::angular_separation` near 0° and 180°.
+inline void soa_separation(const double *x, const double *y, const double *z, double rx,
+                           double ry, double rz, std::size_t n, qtty::Degree *out) {
+  for (std::size_t i = 0; i < n; ++i) {
+    const double cx = y[i] * rz - z[i] * ry;
+    const double cy = z[i] * rx - x[i] * rz;
+    const double cz = x[i] * ry - y[i] * rx;
+    const double dot = x[i] * rx + y[i] * ry + z[i] * rz;
+    out[i] = qtty::Degree(std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), dot) * kSoaRad2Deg);
+  }
+}
+
+/// Row-major 3×3 rotation `m` applied to unit vectors `(x, y, z)[i]`.
+///
+/// All three inputs are read before any output is written, so `o*` may alias
+/// the inputs element-for-element.
+inline void soa_rotate(const std::array<std::array<double, 3>, 3> &m, const double *x,
+                       const double *y, const double *z, std::size_t n, double *ox, double *oy,
+                       double *oz) {
+  const double m00 = m[0][0], m01 = m[0][1], m02 = m[0][2];
+  const double m10 = m[1][0], m11 = m[1][1], m12 = m[1][2];
+  const double m20 = m[2][0], m21 = m[2][1], m22 = m[2][2];
+  for (std::size_t i = 0; i < n; ++i) {
+    const double vx = x[i], vy = y[i], vz = z[i];
+    ox[i] = m00 * vx + m01 * vy + m02 * vz;
+    oy[i] = m10 * vx + m11 * vy + m12 * vz;
+    oz[i] = m20 * vx + m21 * vy + m22 * vz;
+  }
+}
+
+/// Rotation `m` applied to `(lon, lat)[i]` in degrees, fused into one pass.
+inline void soa_rotate_spherical(const std::array<std::array<double, 3>, 3> &m,
+                                 const double *lon, const double *lat, std::size_t n,
+                                 double *olon, double *olat) {
+  const double m00 = m[0][0], m01 = m[0][1], m02 = m[0][2];
+  const double m10 = m[1][0], m11 = m[1][1], m12 = m[1][2];
+  const double m20 = m[2][0], m21 = m[2][1], m22 = m[2][2];
+  for (std::size_t i = 0; i < n; ++i) {
+    double sa, ca, sp, cp;
+    vsincos_deg(lon[i], sa, ca);
+    vsincos_deg(lat[i], sp, cp);
+    const double vx = cp * ca, vy = cp * sa, vz = sp;
+    const double x = m00 * vx + m01 * vy + m02 * vz;
+    const double y = m10 * vx + m11 * vy + m12 * vz;
+    const double z = m20 * vx + m21 * vy + m22 * vz;
+    const double l = vatan2_deg(y, x);
+    olon[i] = l + (l < 0.0 ? 360.0 : 0.0);
+    olat[i] = vatan2_deg(z, vsqrt(x * x + y * y));
+  }
+}
+
+/// Three parallel component arrays sharing one length.
+class Soa3 {
+public:
+  Soa3() = default;
+  explicit Soa3(std::size_t n) : a_(n), b_(n), c_(n) {}
+
+  std::size_t size() const noexcept { return a_.size(); }
+  bool empty() const noexcept { return a_.empty(); }
+
+  void reserve(std::size_t n) {
+    a_.reserve(n);
+    b_.reserve(n);
+    c_.reserve(n);
+  }
+  void resize(std::size_t n) {
+    a_.resize(n);
+    b_.resize(n);
+    c_.resize(n);
+  }
+  void clear() noexcept {
+    a_.clear();
+    b_.clear();
+    c_.clear();
+  }
+
+protected:
+  void push(double a, double b, double c) {
+    a_.push_back(a);
+    b_.push_back(b);
+    c_.push_back(c);
+  }
+  void put(std::size_t i, double a, double b, double c) {
+    a_[i] = a;
+    b_[i] = b;
+    c_[i] = c;
+  }
+
+  std::vector<double> a_, b_, c_;
+};
+
+} // namespace detail
+
+namespace cartesian {
+
+/**
+ * @brief Structure-of-arrays storage for `cartesian::Direction<F>`.
+ *
+ * @ingroup coordinates_cartesian
+ */
+template <typename F> class DirectionArray : public siderust::detail::Soa3 {
+  static_assert(frames::is_frame_v<F>, "F must be a valid frame tag");
+
+public:
+  using value_type = Direction<F>;
+
+  DirectionArray() = default;
+  explicit DirectionArray(std::size_t n) : Soa3(n) {}
+
+  /// Gather an array-of-structs range into component arrays.
+  explicit DirectionArray(span<const Direction<F>> dirs) : Soa3(dirs.size()) {
+    for (std::size_t i = 0; i < dirs.size(); ++i) {
+      set(i, dirs[i]);
+    }
+  }
+
+  void push_back(const Direction<F> &d) { push(d.x, d.y, d.z); }
+  void set(std::size_t i, const Direction<F> &d) { put(i, d.x, d.y, d.z); }
+  Direction<F> operator[](std::size_t i) const { return Direction<F>(a_[i], b_[i], c_[i]); }
+
+  span<double> x() noexcept { return a_; }
+  span<double> y() noexcept { return b_; }
+  span<double> z() noexcept { return c_; }
+  span<const double> x() const noexcept { return a_; }
+  span<const double> y() const noexcept { return b_; }
+  span<const double> z() const noexcept { return c_; }
+};
+
+/**
+ * @brief Structure-of-arrays storage for `cartesian::Position<C, F, U>`.
+ *
+ * Components are stored as raw values in unit `U`.
+ *
+ * @ingroup coordinates_cartesian
+ */
+template <typename C, typename F, typename U> class PositionArray : public siderust::detail::Soa3 {
+  static_assert(frames::is_frame_v<F>, "F must be a valid frame tag");
+  static_assert(centers::is_center_v<C>, "C must be a valid center tag");
+
+public:
+  using value_type = Position<C, F, U>;
+
+  PositionArray() = default;
+  explicit PositionArray(std::size_t n) : Soa3(n) {}
+
+  /// Gather an array-of-structs range into component arrays.
+  explicit PositionArray(span<const Position<C, F, U>> pos) : Soa3(pos.size()) {
+    for (std::size_t i = 0; i < pos.size(); ++i) {
+      set(i, pos[i]);
+    }
+  }
+
+  void push_back(const Position<C, F, U> &p) {
+    push(p.comp_x.value(), p.comp_y.value(), p.comp_z.value());
+  }
+  void set(std::size_t i, const Position<C, F, U> &p) {
+    put(i, p.comp_x.value(), p.comp_y.value(), p.comp_z.value());
+  }
+  Position<C, F, U> operator[](std::size_t i) const {
+    return Position<C, F, U>(a_[i], b_[i], c_[i]);
+  }
+
+  span<double> x() noexcept { return a_; }
+  span<double> y() noexcept { return b_; }
+  span<double> z() noexcept { return c_; }
+  span<const double> x() const noexcept { return a_; }
+  span<const double> y() const noexcept { return b_; }
+  span<const double> z() const noexcept { return c_; }
+};
+
+} // namespace cartesian
+
+namespace spherical {
+
+/**
+ * @brief Structure-of-arrays storage for `spherical::Direction<F>`.
+ *
+ * Angles are stored in degrees.
+ *
+ * @ingroup coordinates_spherical
+ */
+template <typename F> class DirectionArray {
+  static_assert(frames::is_frame_v<F>, "F must be a valid frame tag");
+
+public:
+  using value_type = Direction<F>;
+
+  DirectionArray() = default;
+  explicit DirectionArray(std::size_t n) : az_(n), po_(n) {}
+
+  /// Gather an array-of-structs range into component arrays.
+  explicit DirectionArray(span<const Direction<F>> dirs) : az_(dirs.size()), po_(dirs.size()) {
+    for (std::size_t i = 0; i < dirs.size(); ++i) {
+      set(i, dirs[i]);
+    }
+  }
+
+  std::size_t size() const noexcept { return az_.size(); }
+  bool empty() const noexcept { return az_.empty(); }
+  void reserve(std::size_t n) {
+    az_.reserve(n);
+    po_.reserve(n);
+  }
+  void resize(std::size_t n) {
+    az_.resize(n);
+    po_.resize(n);
+  }
+  void clear() noexcept {
+    az_.clear();
+    po_.clear();
+  }
+
+  void push_back(const Direction<F> &d) {
+    az_.push_back(d.azimuth().value());
+    po_.push_back(d.polar().value());
+  }
+  void set(std::size_t i, const Direction<F> &d) {
+    az_[i] = d.azimuth().value();
+    po_[i] = d.polar().value();
+  }
+  Direction<F> operator[](std::size_t i) const {
+    return Direction<F>(qtty::Degree(az_[i]), qtty::Degree(po_[i]));
+  }
+
+  /// Azimuthal component (RA / longitude / azimuth) in degrees.
+  span<double> azimuth() noexcept { return az_; }
+  span<const double> azimuth() const noexcept { return az_; }
+  /// Polar component (Dec / latitude / altitude) in degrees.
+  span<double> polar() noexcept { return po_; }
+  span<const double> polar() const noexcept { return po_; }
+
+private:
+  std::vector<double> az_, po_;
+};
+
+/**
+ * @brief Structure-of-arrays storage for `spherical::Position<C, F, U>`.
+ *
+ * Angles are stored in degrees and distances as raw values in unit `U`.
+ *
+ * @ingroup coordinates_spherical
+ */
+template <typename C, typename F, typename U> class PositionArray : public siderust::detail::Soa3 {
+  static_assert(frames::is_frame_v<F>, "F must be a valid frame tag");
+  static_assert(centers::is_center_v<C>, "C must be a valid center tag");
+
+public:
+  using value_type = Position<C, F, U>;
+
+  PositionArray() = default;
+  explicit PositionArray(std::size_t n) : Soa3(n) {}
+
+  /// Gather an array-of-structs range into component arrays.
+  explicit PositionArray(span<const Position<C, F, U>> pos) : Soa3(pos.size()) {
+    for (std::size_t i = 0; i < pos.size(); ++i) {
+      set(i, pos[i]);
+    }
+  }
+
+  void push_back(const Position<C, F, U> &p) {
+    push(p.direction().azimuth().value(), p.direction().polar().value(), p.distance().value());
+  }
+  void set(std::size_t i, const Position<C, F, U> &p) {
+    put(i, p.direction().azimuth().value(), p.direction().polar().value(), p.distance().value());
+  }
+  Position<C, F, U> operator[](std::size_t i) const {
+    return Position<C, F, U>(qtty::Degree(a_[i]), qtty::Degree(b_[i]), U(c_[i]));
+  }
+
+  span<double> azimuth() noexcept { return a_; }
+  span<const double> azimuth() const noexcept { return a_; }
+  span<double> polar() noexcept { return b_; }
+  span<const double> polar() const noexcept { return b_; }
+  span<double> distance() noexcept { return c_; }
+  span<const double> distance() const noexcept { return c_; }
+};
+
+} // namespace spherical
+
+// ============================================================================
+// Bulk kernels
+// ============================================================================
+
+/// Unit vectors for every direction; `out` is resized to match.
+template <typename F>
+inline void to_cartesian(const spherical::DirectionArray<F> &in,
+                         cartesian::DirectionArray<F> &out) {
+  out.resize(in.size());
+  detail::soa_spherical_to_cartesian(in.azimuth().data(), in.polar().data(), nullptr, in.size(),
+                                     out.x().data(), out.y().data(), out.z().data());
+}
+
+template <typename F>
+inline cartesian::DirectionArray<F> to_cartesian(const spherical::DirectionArray<F> &in) {
+  cartesian::DirectionArray<F> out;
+  to_cartesian(in, out);
+  return out;
+}
+
+/// Cartesian positions for every spherical position; `out` is resized.
+template <typename C, typename F, typename U>
+inline void to_cartesian(const spherical::PositionArray<C, F, U> &in,
+                         cartesian::PositionArray<C, F, U> &out) {
+  out.resize(in.size());
+  detail::soa_spherical_to_cartesian(in.azimuth().data(), in.polar().data(),
+                                     in.distance().data(), in.size(), out.x().data(),
+                                     out.y().data(), out.z().data());
+}
+
+template <typename C, typename F, typename U>
+inline cartesian::PositionArray<C, F, U> to_cartesian(const spherical::PositionArray<C, F, U> &in) {
+  cartesian::PositionArray<C, F, U> out;
+  to_cartesian(in, out);
+  return out;
+}
+
+/// Longitude/latitude (degrees, longitude in `[0, 360)`) for every vector.
+template <typename F>
+inline void to_spherical(const cartesian::DirectionArray<F> &in,
+                         spherical::DirectionArray<F> &out) {
+  out.resize(in.size());
+  detail::soa_cartesian_to_spherical(in.x().data(), in.y().data(), in.z().data(), in.size(),
+                                     out.azimuth().data(), out.polar().data(), nullptr);
+}
+
+template <typename F>
+inline spherical::DirectionArray<F> to_spherical(const cartesian::DirectionArray<F> &in) {
+  spherical::DirectionArray<F> out;
+  to_spherical(in, out);
+  return out;
+}
+
+/// Spherical positions for every Cartesian position; `out` is resized.
+template <typename C, typename F, typename U>
+inline void to_spherical(const cartesian::PositionArray<C, F, U> &in,
+                         spherical::PositionArray<C, F, U> &out) {
+  out.resize(in.size());
+  detail::soa_cartesian_to_spherical(in.x().data(), in.y().data(), in.z().data(), in.size(),
+                                     out.azimuth().data(), out.polar().data(),
+                                     out.distance().data());
+}
+
+template <typename C, typename F, typename U>
+inline spherical::PositionArray<C, F, U> to_spherical(const cartesian::PositionArray<C, F, U> &in) {
+  spherical::PositionArray<C, F, U> out;
+  to_spherical(in, out);
+  return out;
+}
+
+/**
+ * @brief Angular separation between every unit vector and `ref`.
+ *
+ * @throws InvalidDimensionError if `out.size() != dirs.size()`.
+ */
+template <typename F>
+inline void angular_separation(const cartesian::DirectionArray<F> &dirs,
+                               const cartesian::Direction<F> &ref, span<qtty::Degree> out) {
+  detail::check_batch_size(dirs.size(), out.size(), "angular_separation(DirectionArray)");
+  detail::soa_separation(dirs.x().data(), dirs.y().data(), dirs.z().data(), ref.x, ref.y, ref.z,
+                         dirs.size(), out.data());
+}
+
+/**
+ * @brief Angular separation between every direction and `ref`.
+ *
+ * Matches `spherical::Direction::angular_separation` per element. The
+ * directions are converted to unit vectors in a scratch buffer first; keep a
+ * `cartesian::DirectionArray` around to skip that step for repeated queries.
+ *
+ * @throws InvalidDimensionError if `out.size() != dirs.size()`.
+ */
+template <typename F>
+inline void angular_separation(const spherical::DirectionArray<F> &dirs,
+                               const spherical::Direction<F> &ref, span<qtty::Degree> out) {
+  detail::check_batch_size(dirs.size(), out.size(), "angular_separation(DirectionArray)");
+  const auto r = ref.to_cartesian();
+  angular_separation(to_cartesian(dirs), r, out);
+}
+
+template <typename F>
+inline std::vector<qtty::Degree> angular_separation(const cartesian::DirectionArray<F> &dirs,
+                                                    const cartesian::Direction<F> &ref) {
+  std::vector<qtty::Degree> out(dirs.size());
+  angular_separation(dirs, ref, span<qtty::Degree>(out));
+  return out;
+}
+
+template <typename F>
+inline std::vector<qtty::Degree> angular_separation(const spherical::DirectionArray<F> &dirs,
+                                                    const spherical::Direction<F> &ref) {
+  std::vector<qtty::Degree> out(dirs.size());
+  angular_separation(dirs, ref, span<qtty::Degree>(out));
+  return out;
+}
+
+} // namespace siderust
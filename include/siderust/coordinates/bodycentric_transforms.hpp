@@ -10,6 +10,8 @@
  *   orbiting body described by `params`.
  * - `BodycentricPos<F,U>::to_geocentric(jd)` — inverse transform back to
  *   geocentric.
+ * - Batched `to_bodycentric` / `to_geocentric` over a trajectory (spans of
+ *   positions and epochs) and their in-place `_xyz` forms.
  *
  * The transform algorithm (mirroring Rust):
  * 1. Propagate the body's Keplerian orbit to JD → position in the orbit's
@@ -44,12 +46,19 @@
  * ```
  */
 
+#include "../constants.hpp"
 #include "../ffi_core.hpp"
 #include "../orbital_center.hpp"
+#include "../span.hpp"
 #include "../time.hpp"
 #include "cartesian.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <vector>
 
 namespace siderust {
 
@@ -165,4 +174,254 @@ BodycentricPos<F, U>::to_geocentric(const Time<TT, JD> &jd) const {
   return cartesian::Position<centers::Geocentric, F, U>(U(c_out.x), U(c_out.y), U(c_out.z));
 }
 
+// ============================================================================
+// Batched transforms over trajectories
+// ============================================================================
+
+namespace detail {
+
+/// Chebyshev nodes per interpolated stretch of the body offset (degree 11).
+constexpr std::size_t kBodyOffsetNodes = 12;
+
+/// Interpolation tolerance on the body offset, relative to its size over the
+/// stretch (≈0.15 m on a 1 AU heliocentric shift).
+constexpr double kBodyOffsetTolerance = 1e-12;
+
+/**
+ * @brief Body offset at every sorted, distinct epoch `t[lo..hi)`, into `d`.
+ *
+ * Stretches with enough epochs are interpolated through `kBodyOffsetNodes`
+ * exact offsets at Chebyshev nodes (barycentric form, on the node epochs as
+ * actually rounded to `double`). The interpolant is kept when it reproduces
+ * the exact offsets at both ends of the stretch — where the error peaks —
+ * and at its middle epoch; otherwise the stretch is split there. The three
+ * check epochs belong to the trajectory, so a rejected stretch only wastes
+ * its nodes, and short stretches are evaluated epoch by epoch.
+ */
+template <typename Offset>
+inline void fit_body_offsets(const std::vector<double> &t, std::size_t lo, std::size_t hi,
+                             const Offset &offset, std::vector<double> &d,
+                             std::vector<char> &known) {
+  constexpr std::size_t n = kBodyOffsetNodes;
+  const auto exact = [&](std::size_t j) {
+    if (!known[j]) {
+      offset(t[j], &d[3 * j]);
+      known[j] = 1;
+    }
+  };
+  if (hi - lo <= 2 * (n + 3)) {
+    for (std::size_t j = lo; j < hi; ++j)
+      exact(j);
+    return;
+  }
+
+  const double mid = 0.5 * (t[lo] + t[hi - 1]), half = 0.5 * (t[hi - 1] - t[lo]);
+  double x[n], w[n], v[n][3];
+  double scale = 0.0;
+  for (std::size_t j = 0; j < n; ++j) {
+    const double tj =
+        mid + half * std::cos(constants::pi * (static_cast<double>(j) + 0.5) /
+                              static_cast<double>(n));
+    x[j] = (tj - mid) / half;
+    offset(tj, v[j]);
+    scale = std::max(scale, std::sqrt(v[j][0] * v[j][0] + v[j][1] * v[j][1] + v[j][2] * v[j][2]));
+  }
+  for (std::size_t j = 0; j < n; ++j) {
+    w[j] = 1.0;
+    for (std::size_t m = 0; m < n; ++m)
+      w[j] = m == j ? w[j] : w[j] / (x[j] - x[m]);
+  }
+  const auto interpolate = [&](double t_j, double *out) {
+    const double xj = (t_j - mid) / half;
+    double num[3] = {0.0, 0.0, 0.0}, den = 0.0;
+    for (std::size_t m = 0; m < n; ++m) {
+      if (xj == x[m]) {
+        out[0] = v[m][0], out[1] = v[m][1], out[2] = v[m][2];
+        return;
+      }
+      const double q = w[m] / (xj - x[m]);
+      den += q;
+      for (std::size_t k = 0; k < 3; ++k)
+        num[k] += q * v[m][k];
+    }
+    for (std::size_t k = 0; k < 3; ++k)
+      out[k] = num[k] / den;
+  };
+
+  const std::size_t split = lo + (hi - lo) / 2;
+  const double tolerance = kBodyOffsetTolerance * scale;
+  bool ok = true;
+  for (std::size_t j : {lo, split, hi - 1}) {
+    exact(j);
+    double p[3];
+    interpolate(t[j], p);
+    for (std::size_t k = 0; k < 3; ++k)
+      ok = ok && std::fabs(p[k] - d[3 * j + k]) <= tolerance;
+  }
+  if (!ok) {
+    fit_body_offsets(t, lo, split + 1, offset, d, known);
+    fit_body_offsets(t, split, hi, offset, d, known);
+    return;
+  }
+  for (std::size_t j = lo + 1; j + 1 < hi; ++j) {
+    if (!known[j]) {
+      interpolate(t[j], &d[3 * j]);
+      known[j] = 1;
+    }
+  }
+}
+
+/**
+ * @brief Shift every element of a trajectory by the body offset at its epoch.
+ *
+ * Both transforms subtract (or add back) the body's position in the source
+ * center, so at a given epoch they are a pure translation: the FFI is asked
+ * for the image of the origin and every point sharing that epoch is shifted
+ * in C++. A run of equal epochs costs one propagation; `jd` may also hold a
+ * single epoch for the whole batch.
+ *
+ * Dense trajectories go through the prepared path instead: the distinct
+ * epochs are sorted and the offset is interpolated across the span with
+ * `fit_body_offsets`, so a time series with a new epoch per point costs a
+ * dozen propagations per fitted stretch rather than one per point.
+ *
+ * @tparam C  Center tag of the input (selects the FFI's center handling).
+ * @param shift  Called as `shift(i, dx, dy, dz)` for every element.
+ */
+template <typename C, typename F, typename U, typename Shift>
+inline void for_each_bodycentric_shift(std::size_t count, const BodycentricParams &params,
+                                       span<const Time<TT, JD>> jd, bool forward,
+                                       const char *operation, Shift shift) {
+  check_epoch_count(count, jd.size(), operation);
+  const siderust_cartesian_pos_t origin = cartesian::Position<C, F, U>(0.0, 0.0, 0.0).to_c();
+  const SiderustBodycentricParams c_params = params.to_c();
+  const auto offset = [&](double t, double *out) {
+    siderust_cartesian_pos_t d{};
+    check_status(forward ? siderust_to_bodycentric(origin, c_params, t, &d)
+                         : siderust_from_bodycentric(origin, c_params, t, &d),
+                 operation);
+    out[0] = d.x;
+    out[1] = d.y;
+    out[2] = d.z;
+  };
+
+  std::size_t runs = 0;
+  for (std::size_t i = 0; i < jd.size(); ++i)
+    runs += i == 0 || !(jd[i].value() == jd[i - 1].value());
+  if (runs <= 2 * (kBodyOffsetNodes + 3)) {
+    double d[3] = {0.0, 0.0, 0.0};
+    double last = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t i = 0; i < count; ++i) {
+      const double t = jd[jd.size() == 1 ? 0 : i].value();
+      if (!(t == last)) {
+        offset(t, d);
+        last = t;
+      }
+      shift(i, d[0], d[1], d[2]);
+    }
+    return;
+  }
+
+  std::vector<double> epochs(jd.size());
+  for (std::size_t i = 0; i < jd.size(); ++i)
+    epochs[i] = jd[i].value();
+  std::sort(epochs.begin(), epochs.end());
+  epochs.erase(std::unique(epochs.begin(), epochs.end()), epochs.end());
+  std::vector<double> d(3 * epochs.size());
+  std::vector<char> known(epochs.size(), 0);
+  fit_body_offsets(epochs, 0, epochs.size(), offset, d, known);
+  for (std::size_t i = 0; i < count; ++i) {
+    const std::size_t j = static_cast<std::size_t>(
+        std::lower_bound(epochs.begin(), epochs.end(), jd[i].value()) - epochs.begin());
+    shift(i, d[3 * j], d[3 * j + 1], d[3 * j + 2]);
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Transform a trajectory to body-centric coordinates.
+ *
+ * Equivalent to `to_bodycentric(pos[i], params, jd[i]).pos` for every `i`,
+ * but the body's orbit is propagated once per run of equal epochs (e.g.
+ * several targets per instant) instead of once per point. Time series with
+ * many distinct epochs interpolate the body offset across the span from a
+ * dozen propagations per stretch, within 1e-12 of the offset's size. Pass
+ * `jd` with a single element to use one epoch for the whole batch.
+ *
+ * Pass `pos` as an explicit `span` so `C`, `F` and `U` deduce; `jd` and
+ * `out` accept containers directly.
+ *
+ * @throws InvalidDimensionError if `out` or `jd` does not match `pos`.
+ * @throws InvalidCenterError if the source center is not supported.
+ */
+template <typename C, typename F, typename U>
+inline void
+to_bodycentric(span<const cartesian::Position<C, F, U>> pos, const BodycentricParams &params,
+               span<const Time<TT, JD>> jd,
+               span<detail::non_deduced_t<cartesian::Position<centers::Bodycentric, F, U>>> out) {
+  static_assert(centers::is_center_v<C>, "C must be a valid center tag");
+  detail::check_batch_size(pos.size(), out.size(), "to_bodycentric");
+  detail::for_each_bodycentric_shift<C, F, U>(
+      pos.size(), params, jd, true, "to_bodycentric",
+      [&](std::size_t i, double dx, double dy, double dz) {
+        out[i] = cartesian::Position<centers::Bodycentric, F, U>(
+            pos[i].x().value() + dx, pos[i].y().value() + dy, pos[i].z().value() + dz);
+      });
+}
+
+/**
+ * @brief Transform a body-centric trajectory back to geocentric.
+ *
+ * Batched inverse of `to_bodycentric`, with the same per-epoch reuse.
+ *
+ * @throws InvalidDimensionError if `out` or `jd` does not match `pos`.
+ */
+template <typename F, typename U>
+inline void
+to_geocentric(span<const cartesian::Position<centers::Bodycentric, F, U>> pos,
+              const BodycentricParams &params, span<const Time<TT, JD>> jd,
+              span<detail::non_deduced_t<cartesian::Position<centers::Geocentric, F, U>>> out) {
+  detail::check_batch_size(pos.size(), out.size(), "to_geocentric");
+  detail::for_each_bodycentric_shift<centers::Bodycentric, F, U>(
+      pos.size(), params, jd, false, "from_bodycentric",
+      [&](std::size_t i, double dx, double dy, double dz) {
+        out[i] = cartesian::Position<centers::Geocentric, F, U>(
+            pos[i].x().value() + dx, pos[i].y().value() + dy, pos[i].z().value() + dz);
+      });
+}
+
+/**
+ * @brief `to_bodycentric` over `count` packed `xyz` triples (`in[3*i + k]`).
+ *
+ * Raw-buffer form for trajectories kept in flat `double` arrays, in units of
+ * `U`. `in` and `out` may be the same buffer, which transforms in place.
+ * Spell out the tags, e.g.
+ * `to_bodycentric_xyz<Geocentric, EclipticMeanJ2000, AstronomicalUnit>(...)`.
+ */
+template <typename C, typename F, typename U>
+inline void to_bodycentric_xyz(const double *in, double *out, std::size_t count,
+                               const BodycentricParams &params, span<const Time<TT, JD>> jd) {
+  detail::for_each_bodycentric_shift<C, F, U>(
+      count, params, jd, true, "to_bodycentric",
+      [&](std::size_t i, double dx, double dy, double dz) {
+        out[3 * i] = in[3 * i] + dx;
+        out[3 * i + 1] = in[3 * i + 1] + dy;
+        out[3 * i + 2] = in[3 * i + 2] + dz;
+      });
+}
+
+/// In-place capable `to_geocentric` over packed body-centric `xyz` triples.
+template <typename F, typename U>
+inline void to_geocentric_xyz(const double *in, double *out, std::size_t count,
+                              const BodycentricParams &params, span<const Time<TT, JD>> jd) {
+  detail::for_each_bodycentric_shift<centers::Bodycentric, F, U>(
+      count, params, jd, false, "from_bodycentric",
+      [&](std::size_t i, double dx, double dy, double dz) {
+        out[3 * i] = in[3 * i] + dx;
+        out[3 * i + 1] = in[3 * i + 1] + dy;
+        out[3 * i + 2] = in[3 * i + 2] + dz;
+      });
+}
+
 } // namespace siderust
@@ -20,11 +20,12 @@
 #include <ostream>
 #include <type_traits>
 
-// Forward-declare spherical Position to avoid circular include.
+// Forward-declare spherical Position and InterpolatedRotation to avoid circular includes.
 namespace siderust {
 namespace spherical {
 template <typename C, typename F, typename U> struct Position;
 }
+template <typename From, typename To> class InterpolatedRotation;
 } // namespace siderust
 
 namespace siderust {
@@ -111,15 +112,41 @@ template <typename F> struct Direction {
       return Direction<Target>(x, y, z);
     } else {
       siderust_cartesian_pos_t out{};
-      detail::OwnedFfiContext fctx(ctx);
       check_status(siderust_cartesian_dir_transform_frame_with_context(
                        x, y, z, frames::FrameTraits<F>::ffi_id, frames::FrameTraits<Target>::ffi_id,
-                       jd.value(), fctx.get(), &out),
+                       jd.value(), ctx.ffi_handle(), &out),
                    "cartesian::Direction::to_frame_with");
       return Direction<Target>(out.x, out.y, out.z);
     }
   }
 
+  /**
+   * @brief Transform along a composite frame path (e.g. Galactic → of-date).
+   *
+   * Enabled for pairs without a direct FFI rotation that are reachable
+   * through the ICRS hub. Defined in `frame_rotation.hpp`, which fuses the
+   * path into a single `FrameRotation`.
+   */
+  template <typename Target>
+  std::enable_if_t<frames::is_composite_path_v<F, Target>, Direction<Target>>
+  to_frame(const Time<TT, JD> &jd) const;
+
+  template <typename Target>
+  std::enable_if_t<frames::is_composite_path_v<F, Target>, Direction<Target>>
+  to_frame_with(const Time<TT, JD> &jd, const AstroContext &ctx) const;
+
+  /**
+   * @brief Transform with a pre-fitted `InterpolatedRotation`, skipping the
+   *        FFI call for dense time sequences.
+   *
+   * `Target` is deduced from `rot`. Defined in `interpolated_rotation.hpp`.
+   *
+   * @throws OutOfRangeError if `jd` lies outside the span `rot` was fitted on.
+   */
+  template <typename Target>
+  Direction<Target> to_frame(const Time<TT, JD> &jd,
+                             const InterpolatedRotation<F, Target> &rot) const;
+
   /**
    * @brief Shorthand: `.to<Target>(jd)` (calls `to_frame`).
    */
@@ -245,15 +272,29 @@ template <typename F, typename U> struct Displacement {
       return Displacement<Target, U>(comp_x, comp_y, comp_z);
     } else {
       siderust_cartesian_pos_t out{};
-      detail::OwnedFfiContext fctx(ctx);
       check_status(siderust_cartesian_dir_transform_frame_with_context(
                        comp_x.value(), comp_y.value(), comp_z.value(),
                        frames::FrameTraits<F>::ffi_id, frames::FrameTraits<Target>::ffi_id,
-                       jd.value(), fctx.get(), &out),
+                       jd.value(), ctx.ffi_handle(), &out),
                    "cartesian::Displacement::to_frame_with");
       return Displacement<Target, U>(out.x, out.y, out.z);
     }
   }
+
+  /**
+   * @brief Transform along a composite frame path (e.g. Galactic → of-date).
+   *
+   * Enabled for pairs without a direct FFI rotation that are reachable
+   * through the ICRS hub. Defined in `frame_rotation.hpp`, which fuses the
+   * path into a single `FrameRotation`.
+   */
+  template <typename Target>
+  std::enable_if_t<frames::is_composite_path_v<F, Target>, Displacement<Target, U>>
+  to_frame(const Time<TT, JD> &jd) const;
+
+  template <typename Target>
+  std::enable_if_t<frames::is_composite_path_v<F, Target>, Displacement<Target, U>>
+  to_frame_with(const Time<TT, JD> &jd, const AstroContext &ctx) const;
 };
 
 /**
@@ -368,14 +409,29 @@ template <typename C, typename F, typename U> struct Position {
       return *this;
     } else {
       siderust_cartesian_pos_t out{};
-      detail::OwnedFfiContext fctx(ctx);
       check_status(siderust_cartesian_pos_transform_frame_with_context(
-                       to_c(), frames::FrameTraits<Target>::ffi_id, jd.value(), fctx.get(), &out),
+                       to_c(), frames::FrameTraits<Target>::ffi_id, jd.value(), ctx.ffi_handle(),
+                       &out),
                    "cartesian::Position::to_frame_with");
       return Position<C, Target, U>(out.x, out.y, out.z);
     }
   }
 
+  /**
+   * @brief Transform along a composite frame path (e.g. Galactic → of-date).
+   *
+   * Enabled for pairs without a direct FFI rotation that are reachable
+   * through the ICRS hub. Defined in `frame_rotation.hpp`, which fuses the
+   * path into a single `FrameRotation`.
+   */
+  template <typename Target>
+  std::enable_if_t<frames::is_composite_path_v<F, Target>, Position<C, Target, U>>
+  to_frame(const Time<TT, JD> &jd) const;
+
+  template <typename Target>
+  std::enable_if_t<frames::is_composite_path_v<F, Target>, Position<C, Target, U>>
+  to_frame_with(const Time<TT, JD> &jd, const AstroContext &ctx) const;
+
   /**
    * @brief Shorthand: `.to<Target>(jd)` (calls `to_frame`).
    */
@@ -0,0 +1,183 @@
+#pragma once
+
+/**
+ * @file center_shift.hpp
+ * @ingroup coordinates_cartesian
+ * @brief Batched center shifts with per-epoch offset reuse.
+ *
+ * `Position::to_center<TargetC>(jd)` evaluates the VSOP87 Earth/Sun vectors
+ * (and, off the ecliptic, two frame rotations) for every position. At a fixed
+ * epoch a center change is a pure translation, so the helpers here evaluate
+ * it once — as the image of the origin — and add it to every position that
+ * shares the epoch:
+ *
+ * - `to_center<TargetC>(positions, epochs, out)` reuses the offset across
+ *   each run of equal epochs: one evaluation for a catalog snapshot, one per
+ *   distinct instant for a sorted time series.
+ * - `CenterShift<From, To, F, U>` additionally memoises offsets by epoch, for
+ *   pipelines that revisit the same instants across calls.
+ *
+ * @code
+ * CenterShift<Heliocentric, Geocentric, EclipticMeanJ2000> shift;
+ * shift.apply(helio_snapshot, jd, geo_snapshot); // one VSOP87 evaluation
+ * @endcode
+ */
+
+#include "../centers.hpp"
+#include "../ffi_core.hpp"
+#include "../span.hpp"
+#include "../time.hpp"
+#include "arrays.hpp"
+#include "cartesian.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <unordered_map>
+
+namespace siderust {
+
+namespace detail {
+
+/// Offset added by `to_center<To>(jd)` to any `Position<From, F, U>`.
+template <typename From, typename To, typename F, typename U>
+inline std::array<double, 3> center_offset(const Time<TT, JD> &jd) {
+  const auto o = cartesian::Position<From, F, U>(0.0, 0.0, 0.0).template to_center<To>(jd);
+  return {o.x().value(), o.y().value(), o.z().value()};
+}
+
+/// Walk `count` inputs, calling `offset(jd)` only when the epoch changes and
+/// `shift(i, d)` for every input.
+template <typename Offset, typename Shift>
+inline void for_each_epoch_offset(std::size_t count, span<const Time<TT, JD>> jd,
+                                  const char *operation, Offset offset, Shift shift) {
+  check_epoch_count(count, jd.size(), operation);
+  std::array<double, 3> d{};
+  double last = std::numeric_limits<double>::quiet_NaN();
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto &t = jd[jd.size() == 1 ? 0 : i];
+    if (!(t.value() == last)) {
+      d = offset(t);
+      last = t.value();
+    }
+    shift(i, d);
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Shift a batch of positions to center `TargetC`.
+ *
+ * Equivalent to `pos[i].to_center<TargetC>(jd[i])` for every `i`, with the
+ * ephemeris evaluated once per run of equal epochs. Pass `jd` with a single
+ * element for a snapshot. Pass `pos` as an explicit `span` so `C`, `F` and
+ * `U` deduce; `jd` and `out` accept containers directly.
+ *
+ * @throws InvalidDimensionError if `out` or `jd` does not match `pos`.
+ * @ingroup coordinates_cartesian
+ */
+template <typename TargetC, typename C, typename F, typename U>
+inline std::enable_if_t<centers::has_center_transform_v<C, TargetC>>
+to_center(span<const cartesian::Position<C, F, U>> pos, span<const Time<TT, JD>> jd,
+          span<detail::non_deduced_t<cartesian::Position<TargetC, F, U>>> out) {
+  detail::check_batch_size(pos.size(), out.size(), "to_center");
+  detail::for_each_epoch_offset(
+      pos.size(), jd, "to_center",
+      [](const Time<TT, JD> &t) { return detail::center_offset<C, TargetC, F, U>(t); },
+      [&](std::size_t i, const std::array<double, 3> &d) {
+        out[i] = cartesian::Position<TargetC, F, U>(
+            pos[i].x().value() + d[0], pos[i].y().value() + d[1], pos[i].z().value() + d[2]);
+      });
+}
+
+/**
+ * @brief Center shift `From` → `To` in frame `F` with an epoch-keyed memo.
+ *
+ * Each distinct epoch costs one `to_center` evaluation for the lifetime of
+ * the object (or until the memo reaches `capacity` entries, at which point
+ * it is cleared). Not thread-safe: use one instance per thread.
+ *
+ * @ingroup coordinates_cartesian
+ */
+template <typename From, typename To, typename F, typename U = qtty::AstronomicalUnit>
+class CenterShift {
+  static_assert(centers::has_center_transform_v<From, To>,
+                "CenterShift requires a supported center pair");
+
+public:
+  using Input = cartesian::Position<From, F, U>;
+  using Output = cartesian::Position<To, F, U>;
+
+  static constexpr std::size_t kDefaultCapacity = 1u << 16;
+
+  explicit CenterShift(std::size_t capacity = kDefaultCapacity) : capacity_(capacity) {}
+
+  /// The translation applied at `jd` (memoised).
+  cartesian::Displacement<F, U> offset(const Time<TT, JD> &jd) {
+    const auto &d = lookup(jd);
+    return cartesian::Displacement<F, U>(U(d[0]), U(d[1]), U(d[2]));
+  }
+
+  Output apply(const Input &pos, const Time<TT, JD> &jd) {
+    const auto &d = lookup(jd);
+    return Output(pos.x().value() + d[0], pos.y().value() + d[1], pos.z().value() + d[2]);
+  }
+
+  /**
+   * @brief Shift `in[i]` at `jd[i]` (or at `jd[0]` for all) into `out[i]`.
+   *
+   * @throws InvalidDimensionError if `out` or `jd` does not match `in`.
+   */
+  void apply(span<const Input> in, span<const Time<TT, JD>> jd, span<Output> out) {
+    detail::check_batch_size(in.size(), out.size(), "CenterShift::apply");
+    detail::for_each_epoch_offset(
+        in.size(), jd, "CenterShift::apply",
+        [&](const Time<TT, JD> &t) { return lookup(t); },
+        [&](std::size_t i, const std::array<double, 3> &d) {
+          out[i] = Output(in[i].x().value() + d[0], in[i].y().value() + d[1],
+                          in[i].z().value() + d[2]);
+        });
+  }
+
+  /// Shift a SoA snapshot taken at one epoch; `out` is resized to match.
+  void apply(const cartesian::PositionArray<From, F, U> &in, const Time<TT, JD> &jd,
+             cartesian::PositionArray<To, F, U> &out) {
+    const auto d = lookup(jd);
+    const std::size_t n = in.size();
+    out.resize(n);
+    const double *x = in.x().data();
+    const double *y = in.y().data();
+    const double *z = in.z().data();
+    double *ox = out.x().data();
+    double *oy = out.y().data();
+    double *oz = out.z().data();
+    for (std::size_t i = 0; i < n; ++i) {
+      ox[i] = x[i] + d[0];
+      oy[i] = y[i] + d[1];
+      oz[i] = z[i] + d[2];
+    }
+  }
+
+  /// Number of memoised epochs.
+  std::size_t cached() const noexcept { return memo_.size(); }
+
+  void clear() noexcept { memo_.clear(); }
+
+private:
+  const std::array<double, 3> &lookup(const Time<TT, JD> &jd) {
+    const auto it = memo_.find(jd.value());
+    if (it != memo_.end()) {
+      return it->second;
+    }
+    if (memo_.size() >= capacity_) {
+      memo_.clear();
+    }
+    return memo_.emplace(jd.value(), detail::center_offset<From, To, F, U>(jd)).first->second;
+  }
+
+  std::unordered_map<double, std::array<double, 3>> memo_;
+  std::size_t capacity_;
+};
+
+} // namespace siderust
@@ -0,0 +1,477 @@
+#pragma once
+
+/**
+ * @file frame_rotation.hpp
+ * @ingroup coordinates_cartesian
+ * @brief Precomputed frame rotations applied in C++.
+ *
+ * `to_frame<Target>(jd)` crosses the FFI and rebuilds the
+ * precession/nutation rotation on every call. A `FrameRotation<From, To>`
+ * fetches the 3×3 matrix once for an epoch and then applies it to any number
+ * of directions, displacements or positions as plain inline arithmetic.
+ *
+ * @code
+ * const auto rot = FrameRotation<frames::ICRS, frames::EquatorialTrueOfDate>::at(jd);
+ * rot.apply(catalog_icrs, catalog_tod);    // one FFI round-trip in total
+ * @endcode
+ *
+ * `at` resolves the frame path at compile time (see
+ * `frames::has_frame_path_v`): fixed hops such as ICRS ↔ Galactic are
+ * `constexpr` matrices, dated hops such as EquatorialMeanOfDate ↔
+ * EclipticOfDate are evaluated in C++, and a path through the ICRS hub is
+ * fused into one matrix, so `FrameRotation<frames::Galactic,
+ * frames::EquatorialTrueOfDate>` costs the same as its ICRS counterpart.
+ */
+
+#include "../astro_context.hpp"
+#include "../constants.hpp"
+#include "../ffi_core.hpp"
+#include "../frames.hpp"
+#include "../span.hpp"
+#include "../time.hpp"
+#include "arrays.hpp"
+#include "cartesian.hpp"
+#include "pos_conversions.hpp"
+#include "spherical.hpp"
+
+#include <qtty/qtty.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace siderust {
+
+namespace frames {
+
+/// Row-major 3×3 rotation matrix used by `FrameRotation`.
+using RotationMatrix = std::array<std::array<double, 3>, 3>;
+
+/**
+ * @brief Compile-time matrix of a fixed (epoch-independent) frame rotation.
+ *
+ * Defined for every pair with `has_fixed_rotation_v<From, To>`.
+ */
+template <typename From, typename To> struct FixedRotation;
+
+/**
+ * ICRS → Galactic: the IAU 1958 galactic system transferred to the ICRS as
+ * adopted for Hipparcos (ESA 1997, Vol. 1, §1.5.3). Rows are the galactic
+ * X (centre), Y (l = 90°) and Z (north pole) axes in ICRS.
+ */
+template <> struct FixedRotation<ICRS, Galactic> {
+  static constexpr RotationMatrix matrix{{
+      {-0.0548755604162154, -0.8734370902348850, -0.4838350155487132},
+      {+0.4941094278755837, -0.4448296299600112, +0.7469822444972189},
+      {-0.8676661490190047, -0.1980763734312015, +0.4559837761750669},
+  }};
+};
+
+template <> struct FixedRotation<Galactic, ICRS> {
+  static constexpr RotationMatrix matrix{{
+      {-0.0548755604162154, +0.4941094278755837, -0.8676661490190047},
+      {-0.8734370902348850, -0.4448296299600112, -0.1980763734312015},
+      {-0.4838350155487132, +0.7469822444972189, +0.4559837761750669},
+  }};
+};
+
+/// ICRF ≡ ICRS.
+template <> struct FixedRotation<ICRS, ICRF> {
+  static constexpr RotationMatrix matrix{{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}};
+};
+
+template <> struct FixedRotation<ICRF, ICRS> {
+  static constexpr RotationMatrix matrix{{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}};
+};
+
+/**
+ * @brief Matrix of an epoch-dependent frame rotation evaluated in C++.
+ *
+ * Defined for every pair with `has_dated_rotation_v<From, To>`.
+ */
+template <typename From, typename To> struct DatedRotation;
+
+/**
+ * EquatorialMeanOfDate → EclipticOfDate: a rotation about the equinox by the
+ * IAU 2006 mean obliquity of the ecliptic (Hilton et al. 2006, eq. 39).
+ */
+template <> struct DatedRotation<EquatorialMeanOfDate, EclipticOfDate> {
+  /// Mean obliquity of the ecliptic at `jd` [rad].
+  static double obliquity(const Time<TT, JD> &jd) {
+    const double t = (jd.value() - 2451545.0) / 36525.0;
+    const double arcsec =
+        84381.406 +
+        t * (-46.836769 +
+             t * (-0.0001831 + t * (0.00200340 + t * (-0.000000576 + t * -0.0000000434))));
+    return arcsec * (constants::pi / 648000.0);
+  }
+
+  static RotationMatrix matrix(const Time<TT, JD> &jd) {
+    const double eps = obliquity(jd);
+    const double c = std::cos(eps);
+    const double s = std::sin(eps);
+    return RotationMatrix{{{1.0, 0.0, 0.0}, {0.0, c, s}, {0.0, -s, c}}};
+  }
+};
+
+template <> struct DatedRotation<EclipticOfDate, EquatorialMeanOfDate> {
+  static RotationMatrix matrix(const Time<TT, JD> &jd) {
+    const double eps = DatedRotation<EquatorialMeanOfDate, EclipticOfDate>::obliquity(jd);
+    const double c = std::cos(eps);
+    const double s = std::sin(eps);
+    return RotationMatrix{{{1.0, 0.0, 0.0}, {0.0, c, -s}, {0.0, s, c}}};
+  }
+};
+
+} // namespace frames
+
+/**
+ * @brief A rotation from frame `From` to frame `To` at a fixed epoch.
+ *
+ * The matrix is obtained by transforming the three unit basis vectors of
+ * `From` through siderust-ffi, so it is exactly the rotation `to_frame` would
+ * apply at that epoch (to rounding). Frame rotations preserve the reference
+ * center, so the same matrix applies to directions, displacements and
+ * positions.
+ *
+ * @ingroup coordinates_cartesian
+ * @tparam From  Source frame tag.
+ * @tparam To    Destination frame tag.
+ */
+template <typename From, typename To> class FrameRotation {
+  static_assert(frames::is_frame_v<From> && frames::is_frame_v<To>,
+                "From and To must be valid frame tags");
+
+public:
+  /// Row-major 3×3 matrix: `out = m * in`.
+  using Matrix = frames::RotationMatrix;
+
+  /// Rotation from an explicit row-major matrix (not validated).
+  constexpr explicit FrameRotation(const Matrix &m) : m_(m) {}
+
+  /// The identity rotation (only for `From == To`).
+  template <typename F_ = From, typename = std::enable_if_t<std::is_same_v<F_, To>>>
+  static constexpr FrameRotation identity() {
+    return FrameRotation(Matrix{{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}});
+  }
+
+  /**
+   * @brief The rotation of an epoch-independent path, built at compile time.
+   *
+   * Available when every hop is a fixed rotation (`frames::is_fixed_path_v`),
+   * e.g. ICRS → Galactic or Galactic → ICRF.
+   */
+  template <typename F_ = From, typename = std::enable_if_t<frames::is_fixed_path_v<F_, To>>>
+  static constexpr FrameRotation fixed() {
+    if constexpr (std::is_same_v<From, To>) {
+      return FrameRotation(Matrix{{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}});
+    } else if constexpr (frames::has_fixed_rotation_v<From, To>) {
+      return FrameRotation(frames::FixedRotation<From, To>::matrix);
+    } else {
+      return FrameRotation<From, frames::ICRS>::fixed().then(
+          FrameRotation<frames::ICRS, To>::fixed());
+    }
+  }
+
+  /**
+   * @brief Fetch the rotation at `jd` using the library's default model.
+   *
+   * Fixed and dated hops are evaluated in C++; at most one hop crosses the
+   * FFI.
+   *
+   * @param jd  Julian Date (TT); ignored by epoch-independent rotations.
+   */
+  template <typename F_ = From, typename = std::enable_if_t<frames::has_frame_path_v<F_, To>>>
+  static FrameRotation at(const Time<TT, JD> &jd) {
+    return resolve(jd, nullptr, [&](double x, double y, double z, siderust_cartesian_pos_t *out) {
+      check_status(siderust_cartesian_dir_transform_frame(
+                       x, y, z, frames::FrameTraits<From>::ffi_id, frames::FrameTraits<To>::ffi_id,
+                       jd.value(), out),
+                   "FrameRotation::at");
+    });
+  }
+
+  /**
+   * @brief Fetch the rotation at `jd` under an explicit astronomical context.
+   */
+  template <typename F_ = From, typename = std::enable_if_t<frames::has_frame_path_v<F_, To>>>
+  static FrameRotation at(const Time<TT, JD> &jd, const AstroContext &ctx) {
+    return resolve(jd, &ctx, [&](double x, double y, double z, siderust_cartesian_pos_t *out) {
+      check_status(siderust_cartesian_dir_transform_frame_with_context(
+                       x, y, z, frames::FrameTraits<From>::ffi_id, frames::FrameTraits<To>::ffi_id,
+                       jd.value(), ctx.ffi_handle(), out),
+                   "FrameRotation::at");
+    });
+  }
+
+  constexpr const Matrix &matrix() const { return m_; }
+
+  /// The reverse rotation (the transpose).
+  constexpr FrameRotation<To, From> inverse() const {
+    return FrameRotation<To, From>(typename FrameRotation<To, From>::Matrix{
+        {{m_[0][0], m_[1][0], m_[2][0]},
+         {m_[0][1], m_[1][1], m_[2][1]},
+         {m_[0][2], m_[1][2], m_[2][2]}}});
+  }
+
+  /// Compose with a following rotation: `(next ∘ this)` maps `From` to `Next`.
+  template <typename Next>
+  constexpr FrameRotation<From, Next> then(const FrameRotation<To, Next> &next) const {
+    const auto &n = next.matrix();
+    typename FrameRotation<From, Next>::Matrix out{};
+    for (std::size_t i = 0; i < 3; ++i) {
+      for (std::size_t j = 0; j < 3; ++j) {
+        out[i][j] = n[i][0] * m_[0][j] + n[i][1] * m_[1][j] + n[i][2] * m_[2][j];
+      }
+    }
+    return FrameRotation<From, Next>(out);
+  }
+
+  // -- Single values --------------------------------------------------------
+
+  cartesian::Direction<To> apply(const cartesian::Direction<From> &d) const {
+    double x, y, z;
+    rotate(d.x, d.y, d.z, x, y, z);
+    return cartesian::Direction<To>(x, y, z);
+  }
+
+  template <typename U>
+  cartesian::Displacement<To, U> apply(const cartesian::Displacement<From, U> &d) const {
+    double x, y, z;
+    rotate(d.comp_x.value(), d.comp_y.value(), d.comp_z.value(), x, y, z);
+    return cartesian::Displacement<To, U>(x, y, z);
+  }
+
+  template <typename C, typename U>
+  cartesian::Position<C, To, U> apply(const cartesian::Position<C, From, U> &p) const {
+    double x, y, z;
+    rotate(p.comp_x.value(), p.comp_y.value(), p.comp_z.value(), x, y, z);
+    return cartesian::Position<C, To, U>(x, y, z);
+  }
+
+  spherical::Direction<To> apply(const spherical::Direction<From> &d) const {
+    const auto c = d.to_cartesian();
+    double x, y, z;
+    rotate(c.x, c.y, c.z, x, y, z);
+    constexpr double RAD2DEG = 180.0 / constants::pi;
+    double lon = std::atan2(y, x) * RAD2DEG;
+    if (lon < 0.0)
+      lon += 360.0;
+    const double lat = std::atan2(z, std::sqrt(x * x + y * y)) * RAD2DEG;
+    return spherical::Direction<To>(qtty::Degree(lon), qtty::Degree(lat));
+  }
+
+  // -- Bulk application -----------------------------------------------------
+
+  /**
+   * @brief Rotate `in[i]` into `out[i]` for every element.
+   *
+   * The matrix is hoisted into locals and the loop body is branch-free, so
+   * compilers vectorise it at `-O2`/`-O3`. `in` and `out` may not overlap.
+   *
+   * @throws InvalidDimensionError if the spans differ in size.
+   */
+  void apply(span<const cartesian::Direction<From>> in, span<cartesian::Direction<To>> out) const {
+    detail::check_batch_size(in.size(), out.size(), "FrameRotation::apply");
+    for_each(in.size(), [&](std::size_t i, const Row &r0, const Row &r1, const Row &r2) {
+      const auto &v = in[i];
+      out[i].x = r0[0] * v.x + r0[1] * v.y + r0[2] * v.z;
+      out[i].y = r1[0] * v.x + r1[1] * v.y + r1[2] * v.z;
+      out[i].z = r2[0] * v.x + r2[1] * v.y + r2[2] * v.z;
+    });
+  }
+
+  /// Bulk overload for displacements (pass `span`s explicitly so `U` deduces).
+  template <typename U>
+  void apply(span<const cartesian::Displacement<From, U>> in,
+             span<cartesian::Displacement<To, U>> out) const {
+    detail::check_batch_size(in.size(), out.size(), "FrameRotation::apply");
+    for (std::size_t i = 0; i < in.size(); ++i) {
+      out[i] = apply(in[i]);
+    }
+  }
+
+  /// Bulk overload for positions (pass `span`s explicitly so `C`, `U` deduce).
+  template <typename C, typename U>
+  void apply(span<const cartesian::Position<C, From, U>> in,
+             span<cartesian::Position<C, To, U>> out) const {
+    detail::check_batch_size(in.size(), out.size(), "FrameRotation::apply");
+    for (std::size_t i = 0; i < in.size(); ++i) {
+      out[i] = apply(in[i]);
+    }
+  }
+
+  /**
+   * @brief Rotate `count` packed `xyz` triples from `in` into `out`.
+   *
+   * Raw-buffer form for callers that keep coordinates in flat `double`
+   * arrays (`in[3*i + k]`).
+   */
+  void apply_xyz(const double *in, double *out, std::size_t count) const {
+    for_each(count, [&](std::size_t i, const Row &r0, const Row &r1, const Row &r2) {
+      const double x = in[3 * i];
+      const double y = in[3 * i + 1];
+      const double z = in[3 * i + 2];
+      out[3 * i] = r0[0] * x + r0[1] * y + r0[2] * z;
+      out[3 * i + 1] = r1[0] * x + r1[1] * y + r1[2] * z;
+      out[3 * i + 2] = r2[0] * x + r2[1] * y + r2[2] * z;
+    });
+  }
+
+  /// Rotate every unit vector of a SoA catalog; `out` is resized to match.
+  void apply(const cartesian::DirectionArray<From> &in, cartesian::DirectionArray<To> &out) const {
+    out.resize(in.size());
+    detail::soa_rotate(m_, in.x().data(), in.y().data(), in.z().data(), in.size(),
+                       out.x().data(), out.y().data(), out.z().data());
+  }
+
+  /// Rotate every direction of a SoA catalog; `out` is resized to match.
+  void apply(const spherical::DirectionArray<From> &in, spherical::DirectionArray<To> &out) const {
+    out.resize(in.size());
+    detail::soa_rotate_spherical(m_, in.azimuth().data(), in.polar().data(), in.size(),
+                                 out.azimuth().data(), out.polar().data());
+  }
+
+private:
+  using Row = std::array<double, 3>;
+
+  /// Dispatch on the compile-time path; `direct` samples a single FFI hop.
+  template <typename Transform>
+  static FrameRotation resolve(const Time<TT, JD> &jd, const AstroContext *ctx,
+                               Transform direct) {
+    using FromAnchor = frames::frame_anchor_t<From>;
+    using ToAnchor = frames::frame_anchor_t<To>;
+    if constexpr (frames::is_fixed_path_v<From, To>) {
+      return fixed();
+    } else if constexpr (!std::is_same_v<From, FromAnchor>) {
+      // Leading dated hop onto the anchor, then the rest of the path.
+      const FrameRotation<From, FromAnchor> lead(
+          frames::DatedRotation<From, FromAnchor>::matrix(jd));
+      return lead.then(ctx ? FrameRotation<FromAnchor, To>::at(jd, *ctx)
+                           : FrameRotation<FromAnchor, To>::at(jd));
+    } else if constexpr (!std::is_same_v<To, ToAnchor>) {
+      const FrameRotation<ToAnchor, To> trail(frames::DatedRotation<ToAnchor, To>::matrix(jd));
+      return (ctx ? FrameRotation<From, ToAnchor>::at(jd, *ctx)
+                  : FrameRotation<From, ToAnchor>::at(jd))
+          .then(trail);
+    } else if constexpr (frames::has_frame_transform_v<From, To>) {
+      return sample(direct);
+    } else {
+      // Two hops through the hub, at most one of which crosses the FFI.
+      using First = FrameRotation<From, frames::ICRS>;
+      using Second = FrameRotation<frames::ICRS, To>;
+      return ctx ? First::at(jd, *ctx).then(Second::at(jd, *ctx))
+                 : First::at(jd).then(Second::at(jd));
+    }
+  }
+
+  template <typename Transform> static FrameRotation sample(Transform transform) {
+    if constexpr (std::is_same_v<From, To>) {
+      return FrameRotation(Matrix{{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}});
+    } else {
+      siderust_cartesian_pos_t ex{}, ey{}, ez{};
+      transform(1.0, 0.0, 0.0, &ex);
+      transform(0.0, 1.0, 0.0, &ey);
+      transform(0.0, 0.0, 1.0, &ez);
+      // The images of the basis vectors are the matrix columns.
+      return FrameRotation(Matrix{{{ex.x, ey.x, ez.x}, {ex.y, ey.y, ez.y}, {ex.z, ey.z, ez.z}}});
+    }
+  }
+
+  void rotate(double x, double y, double z, double &ox, double &oy, double &oz) const {
+    ox = m_[0][0] * x + m_[0][1] * y + m_[0][2] * z;
+    oy = m_[1][0] * x + m_[1][1] * y + m_[1][2] * z;
+    oz = m_[2][0] * x + m_[2][1] * y + m_[2][2] * z;
+  }
+
+  template <typename Body> void for_each(std::size_t count, Body body) const {
+    const Row r0 = m_[0];
+    const Row r1 = m_[1];
+    const Row r2 = m_[2];
+    for (std::size_t i = 0; i < count; ++i) {
+      body(i, r0, r1, r2);
+    }
+  }
+
+  Matrix m_;
+};
+
+// ============================================================================
+// Composite-path to_frame (declared in cartesian.hpp / spherical.hpp)
+// ============================================================================
+
+template <typename F>
+template <typename Target>
+std::enable_if_t<frames::is_composite_path_v<F, Target>, cartesian::Direction<Target>>
+cartesian::Direction<F>::to_frame(const Time<TT, JD> &jd) const {
+  return FrameRotation<F, Target>::at(jd).apply(*this);
+}
+
+template <typename F>
+template <typename Target>
+std::enable_if_t<frames::is_composite_path_v<F, Target>, cartesian::Direction<Target>>
+cartesian::Direction<F>::to_frame_with(const Time<TT, JD> &jd, const AstroContext &ctx) const {
+  return FrameRotation<F, Target>::at(jd, ctx).apply(*this);
+}
+
+template <typename F, typename U>
+template <typename Target>
+std::enable_if_t<frames::is_composite_path_v<F, Target>, cartesian::Displacement<Target, U>>
+cartesian::Displacement<F, U>::to_frame(const Time<TT, JD> &jd) const {
+  return FrameRotation<F, Target>::at(jd).apply(*this);
+}
+
+template <typename F, typename U>
+template <typename Target>
+std::enable_if_t<frames::is_composite_path_v<F, Target>, cartesian::Displacement<Target, U>>
+cartesian::Displacement<F, U>::to_frame_with(const Time<TT, JD> &jd,
+                                             const AstroContext &ctx) const {
+  return FrameRotation<F, Target>::at(jd, ctx).apply(*this);
+}
+
+template <typename C, typename F, typename U>
+template <typename Target>
+std::enable_if_t<frames::is_composite_path_v<F, Target>, cartesian::Position<C, Target, U>>
+cartesian::Position<C, F, U>::to_frame(const Time<TT, JD> &jd) const {
+  return FrameRotation<F, Target>::at(jd).apply(*this);
+}
+
+template <typename C, typename F, typename U>
+template <typename Target>
+std::enable_if_t<frames::is_composite_path_v<F, Target>, cartesian::Position<C, Target, U>>
+cartesian::Position<C, F, U>::to_frame_with(const Time<TT, JD> &jd,
+                                            const AstroContext &ctx) const {
+  return FrameRotation<F, Target>::at(jd, ctx).apply(*this);
+}
+
+template <typename F>
+template <typename Target>
+std::enable_if_t<frames::is_composite_path_v<F, Target>, spherical::Direction<Target>>
+spherical::Direction<F>::to_frame(const Time<TT, JD> &jd) const {
+  return FrameRotation<F, Target>::at(jd).apply(*this);
+}
+
+template <typename F>
+template <typename Target>
+std::enable_if_t<frames::is_composite_path_v<F, Target>, spherical::Direction<Target>>
+spherical::Direction<F>::to_frame_with(const Time<TT, JD> &jd, const AstroContext &ctx) const {
+  return FrameRotation<F, Target>::at(jd, ctx).apply(*this);
+}
+
+template <typename C, typename F, typename U>
+template <typename Target>
+std::enable_if_t<frames::is_composite_path_v<F, Target>, spherical::Position<C, Target, U>>
+spherical::Position<C, F, U>::to_frame(const Time<TT, JD> &jd) const {
+  return FrameRotation<F, Target>::at(jd).apply(to_cartesian()).to_spherical();
+}
+
+template <typename C, typename F, typename U>
+template <typename Target>
+std::enable_if_t<frames::is_composite_path_v<F, Target>, spherical::Position<C, Target, U>>
+spherical::Position<C, F, U>::to_frame_with(const Time<TT, JD> &jd,
+                                            const AstroContext &ctx) const {
+  return FrameRotation<F, Target>::at(jd, ctx).apply(to_cartesian()).to_spherical();
+}
+
+} // namespace siderust
@@ -0,0 +1,203 @@
+#pragma once
+
+/**
+ * @file horizontal_projector.hpp
+ * @ingroup coordinates_spherical
+ * @brief Cached observer + epoch projection into the horizontal frame.
+ *
+ * `Direction::to_horizontal(jd, observer)` evaluates the whole chain —
+ * precession-nutation, Earth rotation angle, polar motion and the observer's
+ * local tangent frame — for every direction it is called on. For a fixed
+ * observer and instant that chain is a single rotation, so a
+ * `HorizontalProjector` samples it once and then projects any number of
+ * directions with a 3×3 product and two `atan2` each.
+ *
+ * @code
+ * const HorizontalProjector<frames::ICRS> proj(site, jd_tt, jd_ut1);
+ * proj.project(catalog, altaz);     // three FFI round-trips in total
+ * @endcode
+ */
+
+#include "../astro_context.hpp"
+#include "../ffi_core.hpp"
+#include "../frames.hpp"
+#include "../span.hpp"
+#include "../time.hpp"
+#include "arrays.hpp"
+#include "cartesian.hpp"
+#include "frame_rotation.hpp"
+#include "geodetic.hpp"
+#include "spherical.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace siderust {
+
+/**
+ * @brief Projects directions in frame `F` onto one observer's horizon at one
+ *        instant.
+ *
+ * The constructor pushes the three basis vectors of `F` through the same
+ * siderust-ffi entry point as the matching per-call method:
+ *
+ * | Constructor                    | Per-call equivalent              |
+ * |--------------------------------|----------------------------------|
+ * | `(obs, jd)`                    | `to_horizontal(jd, obs)`         |
+ * | `(obs, jd_tt, jd_ut1)`         | `to_horizontal_precise(...)`     |
+ * | `(obs, jd, ctx)`               | `to_horizontal_with(jd, obs, ctx)` |
+ * | `(obs, jd_tt, jd_ut1, ctx)`    | precise path under `ctx`         |
+ *
+ * **Accuracy.** The direction transforms behind those entry points are
+ * compositions of rotations, so the sampled matrix reproduces them exactly
+ * up to floating-point rounding: results agree with the per-call path to
+ * ≲1e-9° in azimuth and altitude (away from the zenith, where azimuth is
+ * ill-conditioned for both). The projection is only valid at its own
+ * instant — the sky turns by ≈0.0042° per second of time, so rebuild the
+ * projector whenever the epoch changes (e.g. once per rendered frame).
+ * Like the per-call direction methods, no refraction is applied.
+ *
+ * Frames with a fixed rotation to ICRS (e.g. `frames::Galactic`) are
+ * sampled through ICRS, and frames with a dated rotation to an FFI frame
+ * (`frames::EclipticOfDate`) through that frame; the extra hop is fused into
+ * the cached matrix.
+ *
+ * @ingroup coordinates_spherical
+ * @tparam F  Source frame; must satisfy `frames::has_horizontal_transform_v`,
+ *            have a fixed rotation to ICRS, or be anchored to such a frame.
+ */
+template <typename F = frames::ICRS> class HorizontalProjector {
+  static_assert(frames::has_horizontal_transform_v<F> ||
+                    frames::has_fixed_rotation_v<F, frames::ICRS> ||
+                    frames::has_horizontal_transform_v<frames::frame_anchor_t<F>>,
+                "HorizontalProjector requires a frame with a horizontal transform");
+
+  /// Frame handed to the FFI: `F` itself, ICRS behind a fixed hop, or the
+  /// anchor behind a dated hop.
+  using Sampled = std::conditional_t<
+      frames::has_horizontal_transform_v<F>, F,
+      std::conditional_t<frames::has_fixed_rotation_v<F, frames::ICRS>, frames::ICRS,
+                         frames::frame_anchor_t<F>>>;
+
+public:
+  using Rotation = FrameRotation<F, frames::Horizontal>;
+
+  /// Projector matching `to_horizontal(jd, observer)`.
+  HorizontalProjector(const Geodetic &observer, const Time<TT, JD> &jd)
+      : observer_(observer), jd_(jd),
+        rot_(sample(jd, [&](double pol, double az, siderust_spherical_dir_t *out) {
+          check_status(siderust_spherical_dir_to_horizontal(
+                           pol, az, frames::FrameTraits<Sampled>::ffi_id, jd.value(),
+                           observer.to_c(), out),
+                       "HorizontalProjector");
+        })) {}
+
+  /// Projector matching `to_horizontal_precise(jd_tt, jd_ut1, observer)`.
+  HorizontalProjector(const Geodetic &observer, const Time<TT, JD> &jd_tt,
+                      const Time<UT1, JD> &jd_ut1)
+      : observer_(observer), jd_(jd_tt),
+        rot_(sample(jd_tt, [&](double pol, double az, siderust_spherical_dir_t *out) {
+          check_status(siderust_spherical_dir_to_horizontal_precise(
+                           pol, az, frames::FrameTraits<Sampled>::ffi_id, jd_tt.value(),
+                           jd_ut1.value(), observer.to_c(), out),
+                       "HorizontalProjector");
+        })) {}
+
+  /// Projector matching `to_horizontal_with(jd, observer, ctx)`.
+  HorizontalProjector(const Geodetic &observer, const Time<TT, JD> &jd, const AstroContext &ctx)
+      : HorizontalProjector(observer, jd, jd.value(), ctx) {}
+
+  /// Precise projector (separate TT and UT1) under an explicit context.
+  HorizontalProjector(const Geodetic &observer, const Time<TT, JD> &jd_tt,
+                      const Time<UT1, JD> &jd_ut1, const AstroContext &ctx)
+      : HorizontalProjector(observer, jd_tt, jd_ut1.value(), ctx) {}
+
+  const Geodetic &observer() const { return observer_; }
+  const Time<TT, JD> &epoch() const { return jd_; }
+
+  /// The cached `F` → horizontal rotation.
+  const Rotation &rotation() const { return rot_; }
+
+  // -- Single values --------------------------------------------------------
+
+  spherical::Direction<frames::Horizontal> project(const spherical::Direction<F> &dir) const {
+    return rot_.apply(dir);
+  }
+
+  cartesian::Direction<frames::Horizontal> project(const cartesian::Direction<F> &dir) const {
+    return rot_.apply(dir);
+  }
+
+  // -- Bulk projection ------------------------------------------------------
+
+  /**
+   * @brief Project `dirs[i]` into `out[i]` for every element.
+   *
+   * @throws InvalidDimensionError if the spans differ in size.
+   */
+  void project(span<const spherical::Direction<F>> dirs,
+               span<spherical::Direction<frames::Horizontal>> out) const {
+    detail::check_batch_size(dirs.size(), out.size(), "HorizontalProjector::project");
+    for (std::size_t i = 0; i < dirs.size(); ++i) {
+      out[i] = rot_.apply(dirs[i]);
+    }
+  }
+
+  /// Bulk overload for unit vectors.
+  void project(span<const cartesian::Direction<F>> dirs,
+               span<cartesian::Direction<frames::Horizontal>> out) const {
+    rot_.apply(dirs, out);
+  }
+
+  /// Project a SoA catalog in one fused pass; `out` is resized to match.
+  void project(const spherical::DirectionArray<F> &dirs,
+               spherical::DirectionArray<frames::Horizontal> &out) const {
+    rot_.apply(dirs, out);
+  }
+
+  /// Rotate a SoA array of unit vectors; `out` is resized to match.
+  void project(const cartesian::DirectionArray<F> &dirs,
+               cartesian::DirectionArray<frames::Horizontal> &out) const {
+    rot_.apply(dirs, out);
+  }
+
+private:
+  HorizontalProjector(const Geodetic &observer, const Time<TT, JD> &jd_tt, double jd_ut1,
+                      const AstroContext &ctx)
+      : observer_(observer), jd_(jd_tt),
+        rot_(sample(jd_tt, [&](double pol, double az, siderust_spherical_dir_t *out) {
+          check_status(siderust_spherical_dir_to_horizontal_precise_with_context(
+                           pol, az, frames::FrameTraits<Sampled>::ffi_id, jd_tt.value(), jd_ut1,
+                           observer.to_c(), ctx.ffi_handle(), out),
+                       "HorizontalProjector");
+        })) {}
+
+  /// Build the rotation from the images of the `Sampled` basis vectors,
+  /// prefixed with the C++ `F` → `Sampled` hop at `jd` when they differ.
+  template <typename Transform>
+  static Rotation sample(const Time<TT, JD> &jd, Transform transform) {
+    // Basis vectors as (polar, azimuth) in degrees: +X, +Y, +Z.
+    constexpr double basis[3][2] = {{0.0, 0.0}, {0.0, 90.0}, {90.0, 0.0}};
+    typename Rotation::Matrix m{};
+    for (std::size_t col = 0; col < 3; ++col) {
+      siderust_spherical_dir_t out{};
+      transform(basis[col][0], basis[col][1], &out);
+      const auto v = spherical::Direction<frames::Horizontal>::from_c(out).to_cartesian();
+      m[0][col] = v.x;
+      m[1][col] = v.y;
+      m[2][col] = v.z;
+    }
+    const FrameRotation<Sampled, frames::Horizontal> sampled(m);
+    if constexpr (std::is_same_v<F, Sampled>) {
+      return sampled;
+    } else {
+      return FrameRotation<F, Sampled>::at(jd).then(sampled);
+    }
+  }
+
+  Geodetic observer_;
+  Time<TT, JD> jd_;
+  Rotation rot_;
+};
+
+} // namespace siderust
@@ -0,0 +1,353 @@
+#pragma once
+
+/**
+ * @file interpolated_rotation.hpp
+ * @ingroup coordinates_cartesian
+ * @brief Epoch-interpolated frame rotations for dense time sequences.
+ *
+ * A telescope track sampled at 10 Hz calls `to_frame` or `to_horizontal`
+ * hundreds of thousands of times per night, and each call re-evaluates the
+ * full precession-nutation series although the rotation changes by
+ * micro-arcseconds between samples. An `InterpolatedRotation<From, To>`
+ * samples the exact rotation at a few epochs across the span, interpolates
+ * it with piecewise cubics and subdivides until a requested error budget is
+ * met:
+ *
+ * @code
+ * const auto rot = interpolate_frame_rotation<frames::ICRS, frames::EquatorialTrueOfDate>(
+ *     night_start, night_end);
+ * for (std::size_t i = 0; i < track.size(); ++i)
+ *   out[i] = track[i].to_frame(times[i], rot);   // same as rot.apply(times[i], track[i])
+ * @endcode
+ */
+
+#include "../astro_context.hpp"
+#include "../constants.hpp"
+#include "../ffi_core.hpp"
+#include "../frames.hpp"
+#include "../span.hpp"
+#include "../time.hpp"
+#include "cartesian.hpp"
+#include "frame_rotation.hpp"
+#include "geodetic.hpp"
+#include "horizontal_projector.hpp"
+#include "spherical.hpp"
+
+#include <qtty/qtty.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace siderust {
+
+/**
+ * @brief A `From` → `To` rotation interpolated over an epoch span.
+ *
+ * The span is split into segments. Each segment stores the exact rotation
+ * at four equally spaced epochs and interpolates the matrix elements with a
+ * cubic Lagrange polynomial, re-orthonormalising the result. A segment is
+ * accepted once the interpolated rotation differs from the exact one by at
+ * most `tolerance` (as a rotation angle) at the three epochs where cubic
+ * interpolation error peaks; otherwise it is halved. Segments are never
+ * split below one second, which is far below what any supported rotation
+ * needs for tolerances above the ~1e-12° rounding floor.
+ *
+ * Build cost is seven exact samples per accepted segment. For IAU 2006/2000A
+ * frame rotations a whole night is usually one segment at 1 mas; an
+ * observer's horizontal rotation (dominated by Earth rotation) needs roughly
+ * one segment per 10–15 minutes.
+ *
+ * @ingroup coordinates_cartesian
+ * @tparam From  Source frame tag.
+ * @tparam To    Destination frame tag.
+ */
+template <typename From, typename To> class InterpolatedRotation {
+public:
+  using Rotation = FrameRotation<From, To>;
+  using Matrix = typename Rotation::Matrix;
+
+  /// Default error budget: 1 milliarcsecond.
+  static constexpr double kDefaultToleranceDeg = 1e-3 / 3600.0;
+
+  /**
+   * @brief Fit `exact` over `[start, end]` to within `tolerance`.
+   *
+   * @param exact  Callable `Rotation(const Time<TT, JD> &)` returning the
+   *               exact rotation at an epoch.
+   * @throws InvalidArgumentError if `end <= start` or `tolerance <= 0`.
+   */
+  template <typename Exact,
+            typename = std::enable_if_t<
+                std::is_invocable_r_v<Rotation, Exact &, const Time<TT, JD> &>>>
+  InterpolatedRotation(const Time<TT, JD> &start, const Time<TT, JD> &end, Exact exact,
+                       qtty::Degree tolerance = qtty::Degree(kDefaultToleranceDeg))
+      : t0_(start.value()), t1_(end.value()), tol_(tolerance) {
+    if (!(t1_ > t0_)) {
+      throw InvalidArgumentError("InterpolatedRotation: end must be after start");
+    }
+    if (!(tol_.value() > 0.0)) {
+      throw InvalidArgumentError("InterpolatedRotation: tolerance must be positive");
+    }
+    build(exact);
+  }
+
+  Time<TT, JD> start() const { return Time<TT, JD>(t0_); }
+  Time<TT, JD> end() const { return Time<TT, JD>(t1_); }
+  qtty::Degree tolerance() const { return tol_; }
+
+  /// Number of cubic segments the span was split into.
+  std::size_t segment_count() const { return segs_.size(); }
+
+  /// Number of exact rotations evaluated while fitting.
+  std::size_t sample_count() const { return samples_; }
+
+  /**
+   * @brief The interpolated rotation at `jd`.
+   *
+   * @throws OutOfRangeError if `jd` lies outside `[start, end]`.
+   */
+  Rotation at(const Time<TT, JD> &jd) const {
+    const double t = jd.value();
+    if (!(t >= t0_ && t <= t1_)) {
+      throw OutOfRangeError("InterpolatedRotation::at: epoch outside the fitted span");
+    }
+    auto it = std::upper_bound(segs_.begin(), segs_.end(), t,
+                               [](double v, const Segment &s) { return v < s.t0; });
+    const Segment &seg = *(it == segs_.begin() ? it : it - 1);
+    return Rotation(evaluate(seg, (t - seg.t0) / (seg.t1 - seg.t0)));
+  }
+
+  /// Apply the rotation at `jd` to any value `FrameRotation::apply` accepts.
+  template <typename V> auto apply(const Time<TT, JD> &jd, const V &value) const {
+    return at(jd).apply(value);
+  }
+
+  /**
+   * @brief Rotate a time-tagged track: `out[i]` = rotation at `times[i]`
+   *        applied to `in[i]`.
+   *
+   * @throws InvalidDimensionError if the spans differ in size.
+   * @throws OutOfRangeError if any epoch lies outside the fitted span.
+   */
+  void apply(span<const Time<TT, JD>> times, span<const cartesian::Direction<From>> in,
+             span<cartesian::Direction<To>> out) const {
+    detail::check_batch_size(times.size(), in.size(), "InterpolatedRotation::apply");
+    detail::check_batch_size(in.size(), out.size(), "InterpolatedRotation::apply");
+    for (std::size_t i = 0; i < in.size(); ++i) {
+      out[i] = at(times[i]).apply(in[i]);
+    }
+  }
+
+  /// Spherical-direction overload of the track form.
+  void apply(span<const Time<TT, JD>> times, span<const spherical::Direction<From>> in,
+             span<spherical::Direction<To>> out) const {
+    detail::check_batch_size(times.size(), in.size(), "InterpolatedRotation::apply");
+    detail::check_batch_size(in.size(), out.size(), "InterpolatedRotation::apply");
+    for (std::size_t i = 0; i < in.size(); ++i) {
+      out[i] = at(times[i]).apply(in[i]);
+    }
+  }
+
+private:
+  /// Shortest segment the fit will create (one second).
+  static constexpr double kMinSegmentDays = 1.0 / 86400.0;
+  /// √5 / 6: offset of the outer error extrema from the segment midpoint.
+  static constexpr double kCheckOffset = 0.37267799624996495;
+
+  struct Segment {
+    double t0;
+    double t1;
+    std::array<Matrix, 4> node; // exact rotations at u = 0, 1/3, 2/3, 1
+  };
+
+  template <typename Exact> void build(Exact &exact) {
+    const double tol_rad = tol_.value() * (constants::pi / 180.0);
+    auto sample = [&](double t) {
+      ++samples_;
+      return exact(Time<TT, JD>(t)).matrix();
+    };
+
+    // Depth-first with the left half on top, so segments come out sorted.
+    std::vector<std::pair<double, double>> pending{{t0_, t1_}};
+    while (!pending.empty()) {
+      const auto [a, b] = pending.back();
+      pending.pop_back();
+      const double h = b - a;
+
+      Segment seg{a, b, {}};
+      for (std::size_t k = 0; k < 4; ++k) {
+        seg.node[k] = sample(k == 3 ? b : a + h * static_cast<double>(k) / 3.0);
+      }
+
+      // Check at the extrema of the cubic node polynomial u(u-1/3)(u-2/3)(u-1).
+      double err = 0.0;
+      for (const double u : {0.5 - kCheckOffset, 0.5, 0.5 + kCheckOffset}) {
+        err = std::max(err, angle_between(evaluate(seg, u), sample(a + h * u)));
+      }
+
+      if (err > tol_rad && h > 2.0 * kMinSegmentDays) {
+        const double mid = a + 0.5 * h;
+        pending.emplace_back(mid, b);
+        pending.emplace_back(a, mid);
+      } else {
+        segs_.push_back(seg);
+      }
+    }
+  }
+
+  /// Cubic Lagrange interpolation at `u ∈ [0, 1]`, re-orthonormalised.
+  static Matrix evaluate(const Segment &seg, double u) {
+    const double w[4] = {
+        -4.5 * (u - 1.0 / 3.0) * (u - 2.0 / 3.0) * (u - 1.0),
+        13.5 * u * (u - 2.0 / 3.0) * (u - 1.0),
+        -13.5 * u * (u - 1.0 / 3.0) * (u - 1.0),
+        4.5 * u * (u - 1.0 / 3.0) * (u - 2.0 / 3.0),
+    };
+    Matrix r{};
+    for (std::size_t i = 0; i < 3; ++i) {
+      for (std::size_t j = 0; j < 3; ++j) {
+        r[i][j] = w[0] * seg.node[0][i][j] + w[1] * seg.node[1][i][j] +
+                  w[2] * seg.node[2][i][j] + w[3] * seg.node[3][i][j];
+      }
+    }
+    return orthonormalise(r);
+  }
+
+  /// One Newton–Schulz step `R (3I − RᵀR) / 2`; the input is already
+  /// orthogonal to interpolation accuracy, so one step squares the error.
+  static Matrix orthonormalise(const Matrix &r) {
+    Matrix rtr{};
+    for (std::size_t i = 0; i < 3; ++i) {
+      for (std::size_t j = 0; j < 3; ++j) {
+        rtr[i][j] = r[0][i] * r[0][j] + r[1][i] * r[1][j] + r[2][i] * r[2][j];
+      }
+    }
+    Matrix out{};
+    for (std::size_t i = 0; i < 3; ++i) {
+      for (std::size_t j = 0; j < 3; ++j) {
+        double s = 0.0;
+        for (std::size_t k = 0; k < 3; ++k) {
+          s += r[i][k] * ((k == j ? 3.0 : 0.0) - rtr[k][j]);
+        }
+        out[i][j] = 0.5 * s;
+      }
+    }
+    return out;
+  }
+
+  /// Rotation angle (radians) between two nearby rotations: ‖A − B‖_F / √2.
+  static double angle_between(const Matrix &a, const Matrix &b) {
+    double s = 0.0;
+    for (std::size_t i = 0; i < 3; ++i) {
+      for (std::size_t j = 0; j < 3; ++j) {
+        const double d = a[i][j] - b[i][j];
+        s += d * d;
+      }
+    }
+    return std::sqrt(0.5 * s);
+  }
+
+  double t0_;
+  double t1_;
+  qtty::Degree tol_;
+  std::size_t samples_ = 0;
+  std::vector<Segment> segs_;
+};
+
+// ============================================================================
+// Interpolated to_frame (declared in cartesian.hpp / spherical.hpp)
+// ============================================================================
+
+template <typename F>
+template <typename Target>
+cartesian::Direction<Target>
+cartesian::Direction<F>::to_frame(const Time<TT, JD> &jd,
+                                  const InterpolatedRotation<F, Target> &rot) const {
+  return rot.apply(jd, *this);
+}
+
+template <typename F>
+template <typename Target>
+spherical::Direction<Target>
+spherical::Direction<F>::to_frame(const Time<TT, JD> &jd,
+                                  const InterpolatedRotation<F, Target> &rot) const {
+  return rot.apply(jd, *this);
+}
+
+// ============================================================================
+// Factories
+// ============================================================================
+
+/**
+ * @brief Interpolate `FrameRotation<From, To>::at` over `[start, end]`.
+ */
+template <typename From, typename To,
+          typename = std::enable_if_t<frames::has_frame_transform_v<From, To>>>
+InterpolatedRotation<From, To>
+interpolate_frame_rotation(const Time<TT, JD> &start, const Time<TT, JD> &end,
+                           qtty::Degree tolerance = qtty::Degree(
+                               InterpolatedRotation<From, To>::kDefaultToleranceDeg)) {
+  return InterpolatedRotation<From, To>(
+      start, end, [](const Time<TT, JD> &jd) { return FrameRotation<From, To>::at(jd); },
+      tolerance);
+}
+
+/**
+ * @brief Interpolate `FrameRotation<From, To>::at(jd, ctx)` over `[start, end]`.
+ */
+template <typename From, typename To,
+          typename = std::enable_if_t<frames::has_frame_transform_v<From, To>>>
+InterpolatedRotation<From, To>
+interpolate_frame_rotation(const Time<TT, JD> &start, const Time<TT, JD> &end,
+                           const AstroContext &ctx,
+                           qtty::Degree tolerance = qtty::Degree(
+                               InterpolatedRotation<From, To>::kDefaultToleranceDeg)) {
+  return InterpolatedRotation<From, To>(
+      start, end,
+      [&ctx](const Time<TT, JD> &jd) { return FrameRotation<From, To>::at(jd, ctx); },
+      tolerance);
+}
+
+/**
+ * @brief Interpolate an observer's `F` → horizontal rotation over
+ *        `[start, end]`, matching `to_horizontal(jd, observer)`.
+ */
+template <typename F = frames::ICRS>
+InterpolatedRotation<F, frames::Horizontal>
+interpolate_horizontal(const Geodetic &observer, const Time<TT, JD> &start,
+                       const Time<TT, JD> &end,
+                       qtty::Degree tolerance = qtty::Degree(
+                           InterpolatedRotation<F, frames::Horizontal>::kDefaultToleranceDeg)) {
+  return InterpolatedRotation<F, frames::Horizontal>(
+      start, end,
+      [&observer](const Time<TT, JD> &jd) {
+        return HorizontalProjector<F>(observer, jd).rotation();
+      },
+      tolerance);
+}
+
+/**
+ * @brief Interpolate an observer's `F` → horizontal rotation under `ctx`,
+ *        matching `to_horizontal_with(jd, observer, ctx)`.
+ */
+template <typename F = frames::ICRS>
+InterpolatedRotation<F, frames::Horizontal>
+interpolate_horizontal(const Geodetic &observer, const Time<TT, JD> &start,
+                       const Time<TT, JD> &end, const AstroContext &ctx,
+                       qtty::Degree tolerance = qtty::Degree(
+                           InterpolatedRotation<F, frames::Horizontal>::kDefaultToleranceDeg)) {
+  return InterpolatedRotation<F, frames::Horizontal>(
+      start, end,
+      [&observer, &ctx](const Time<TT, JD> &jd) {
+        return HorizontalProjector<F>(observer, jd, ctx).rotation();
+      },
+      tolerance);
+}
+
+} // namespace siderust
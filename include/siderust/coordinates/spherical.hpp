@@ -21,11 +21,12 @@
 #include <ostream>
 #include <type_traits>
 
-// Forward-declare cartesian Position to avoid circular include.
+// Forward-declare cartesian Position and InterpolatedRotation to avoid circular includes.
 namespace siderust {
 namespace cartesian {
 template <typename C, typename F, typename U> struct Position;
 }
+template <typename From, typename To> class InterpolatedRotation;
 } // namespace siderust
 
 namespace siderust {
@@ -124,6 +125,12 @@ public:
   }
   /// @}
 
+  /// @name Frame-agnostic components
+  /// @{
+  qtty::Degree azimuth() const { return azimuth_; } ///< RA / longitude / azimuth.
+  qtty::Degree polar() const { return polar_; }     ///< Dec / latitude / altitude.
+  /// @}
+
   /// @name FFI interop
   /// @{
   siderust_spherical_dir_t to_c() const { return {polar_.value(), azimuth_.value(), frame_id()}; }
@@ -189,15 +196,41 @@ public:
       return Direction<Target>(azimuth_, polar_);
     } else {
       siderust_spherical_dir_t out;
-      detail::OwnedFfiContext fctx(ctx);
       check_status(siderust_spherical_dir_transform_frame_with_context(
                        polar_.value(), azimuth_.value(), frames::FrameTraits<F>::ffi_id,
-                       frames::FrameTraits<Target>::ffi_id, jd.value(), fctx.get(), &out),
+                       frames::FrameTraits<Target>::ffi_id, jd.value(), ctx.ffi_handle(), &out),
                    "Direction::to_frame_with");
       return Direction<Target>::from_c(out);
     }
   }
 
+  /**
+   * @brief Transform along a composite frame path (e.g. Galactic → of-date).
+   *
+   * Enabled for pairs without a direct FFI rotation that are reachable
+   * through the ICRS hub. Defined in `frame_rotation.hpp`, which fuses the
+   * path into a single `FrameRotation`.
+   */
+  template <typename Target>
+  std::enable_if_t<frames::is_composite_path_v<F, Target>, Direction<Target>>
+  to_frame(const Time<TT, JD> &jd) const;
+
+  template <typename Target>
+  std::enable_if_t<frames::is_composite_path_v<F, Target>, Direction<Target>>
+  to_frame_with(const Time<TT, JD> &jd, const AstroContext &ctx) const;
+
+  /**
+   * @brief Transform with a pre-fitted `InterpolatedRotation`, skipping the
+   *        FFI call for dense time sequences.
+   *
+   * `Target` is deduced from `rot`. Defined in `interpolated_rotation.hpp`.
+   *
+   * @throws OutOfRangeError if `jd` lies outside the span `rot` was fitted on.
+   */
+  template <typename Target>
+  Direction<Target> to_frame(const Time<TT, JD> &jd,
+                             const InterpolatedRotation<F, Target> &rot) const;
+
   /**
    * @brief Shorthand: `.to<Target>(jd)` (calls `to_frame`).
    */
@@ -242,10 +275,9 @@ public:
   to_horizontal_with(const Time<TT, JD> &jd, const Geodetic &observer,
                      const AstroContext &ctx) const {
     siderust_spherical_dir_t out;
-    detail::OwnedFfiContext fctx(ctx);
     check_status(siderust_spherical_dir_to_horizontal_precise_with_context(
                      polar_.value(), azimuth_.value(), frames::FrameTraits<F>::ffi_id, jd.value(),
-                     jd.value(), observer.to_c(), fctx.get(), &out),
+                     jd.value(), observer.to_c(), ctx.ffi_handle(), &out),
                  "Direction::to_horizontal_with");
     return Direction<frames::Horizontal>::from_c(out);
   }
@@ -369,6 +401,21 @@ public:
   std::enable_if_t<frames::has_frame_transform_v<F, Target>, Position<C, Target, U>>
   to_frame_with(const Time<TT, JD> &jd, const AstroContext &ctx) const;
 
+  /**
+   * @brief Transform along a composite frame path (e.g. Galactic → of-date).
+   *
+   * Enabled for pairs without a direct FFI rotation that are reachable
+   * through the ICRS hub. Defined in `frame_rotation.hpp`, which fuses the
+   * path into a single `FrameRotation`.
+   */
+  template <typename Target>
+  std::enable_if_t<frames::is_composite_path_v<F, Target>, Position<C, Target, U>>
+  to_frame(const Time<TT, JD> &jd) const;
+
+  template <typename Target>
+  std::enable_if_t<frames::is_composite_path_v<F, Target>, Position<C, Target, U>>
+  to_frame_with(const Time<TT, JD> &jd, const AstroContext &ctx) const;
+
   /**
    * @brief Shorthand: `.to<Target>(jd)` (calls `to_frame`).
    */
@@ -0,0 +1,54 @@
+#pragma once
+
+/**
+ * @file aberration.hpp
+ * @brief Annual aberration and light-time terms for the C++ apparent-place
+ *        paths (subject lists, snapshots and provider searches).
+ */
+
+#include <cmath>
+#include <cstddef>
+
+namespace siderust {
+namespace detail {
+
+/// Speed of light [AU/day].
+constexpr double kLightAuPerDay = 173.1446326742403;
+
+/**
+ * @brief Apply annual aberration to `p` as seen by an observer moving with
+ *        barycentric velocity `v` [AU/day], both in the same frame.
+ *
+ * Relativistic formula of SOFA `iauAb` without the light deflection by the
+ * Sun (≲4 mas away from the solar limb). `out` keeps the length of `p`, so
+ * positions stay usable for the diurnal parallax. `out` may alias `p`.
+ */
+inline void aberrate(const double (&p)[3], const double (&v)[3], double (&out)[3]) {
+  const double r = std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+  if (r == 0.0) {
+    out[0] = out[1] = out[2] = 0.0;
+    return;
+  }
+  double u[3], b[3];
+  for (std::size_t k = 0; k < 3; ++k) {
+    u[k] = p[k] / r;
+    b[k] = v[k] / kLightAuPerDay;
+  }
+  const double bm1 = std::sqrt(1.0 - (b[0] * b[0] + b[1] * b[1] + b[2] * b[2]));
+  const double pdv = u[0] * b[0] + u[1] * b[1] + u[2] * b[2];
+  const double w1 = 1.0 + pdv / (1.0 + bm1);
+  double q[3];
+  for (std::size_t k = 0; k < 3; ++k)
+    q[k] = bm1 * u[k] + w1 * b[k];
+  const double s = r / std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2]);
+  for (std::size_t k = 0; k < 3; ++k)
+    out[k] = q[k] * s;
+}
+
+/// Light travel time [days] over the vector `p` [AU].
+inline double light_time(const double (&p)[3]) {
+  return std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]) / kLightAuPerDay;
+}
+
+} // namespace detail
+} // namespace siderust
@@ -0,0 +1,45 @@
+#pragma once
+
+/**
+ * @file chebyshev.hpp
+ * @brief Chebyshev series evaluation shared by the ephemeris cache and the
+ *        SPK reader.
+ */
+
+#include <cstddef>
+
+namespace siderust {
+namespace detail {
+
+/// Value and first derivative (w.r.t. `x`) of `Σ c[k] T_k(x)`.
+inline void chebyshev_eval(const double *c, std::size_t n, double x, double &value,
+                           double &deriv) {
+  double t0 = 1.0, t1 = x;    // T_{k-2}, T_{k-1}
+  double d0 = 0.0, d1 = 1.0; // T'_{k-2}, T'_{k-1}
+  value = c[0] + (n > 1 ? c[1] * x : 0.0);
+  deriv = n > 1 ? c[1] : 0.0;
+  for (std::size_t k = 2; k < n; ++k) {
+    const double t2 = 2.0 * x * t1 - t0;
+    const double d2 = 2.0 * t1 + 2.0 * x * d1 - d0;
+    value += c[k] * t2;
+    deriv += c[k] * d2;
+    t0 = t1;
+    t1 = t2;
+    d0 = d1;
+    d1 = d2;
+  }
+}
+
+/// Value of `Σ c[k] T_k(x)` by Clenshaw's recurrence.
+inline double chebyshev_value(const double *c, std::size_t n, double x) {
+  double b1 = 0.0, b2 = 0.0;
+  for (std::size_t k = n; k-- > 1;) {
+    const double b0 = 2.0 * x * b1 - b2 + c[k];
+    b2 = b1;
+    b1 = b0;
+  }
+  return x * b1 - b2 + c[0];
+}
+
+} // namespace detail
+} // namespace siderust
@@ -0,0 +1,267 @@
+#pragma once
+
+/**
+ * @file mapped_file.hpp
+ * @brief Read-only memory mapping of a whole file (POSIX `mmap` / Win32
+ *        file mappings), and positional reads for callers that must not
+ *        keep mapped pages resident.
+ */
+
+#include "../ffi_core.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace siderust {
+namespace detail {
+
+/**
+ * @brief Move-only, read-only view of a file mapped into the address space.
+ *
+ * Pages are shared with the OS page cache: they are read from disk on first
+ * touch and shared by every process mapping the same file.
+ *
+ * @throws DataLoadError if the file cannot be opened or mapped.
+ */
+class MappedFile {
+public:
+  MappedFile() = default;
+
+  explicit MappedFile(const std::string &path) {
+#if defined(_WIN32)
+    file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE)
+      throw DataLoadError("MappedFile: cannot open " + path);
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file_, &size)) {
+      close();
+      throw DataLoadError("MappedFile: cannot stat " + path);
+    }
+    size_ = static_cast<std::size_t>(size.QuadPart);
+    if (size_ != 0) {
+      mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      data_ = mapping_ ? static_cast<const std::uint8_t *>(
+                             MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0))
+                       : nullptr;
+      if (data_ == nullptr) {
+        close();
+        throw DataLoadError("MappedFile: cannot map " + path);
+      }
+    }
+#else
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0)
+      throw DataLoadError("MappedFile: cannot open " + path);
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) {
+      close();
+      throw DataLoadError("MappedFile: cannot stat " + path);
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+    if (size_ != 0) {
+      void *p = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd_, 0);
+      if (p == MAP_FAILED) {
+        close();
+        throw DataLoadError("MappedFile: cannot map " + path);
+      }
+      // Ephemeris lookups jump between records; read-ahead would only
+      // inflate the resident set.
+      ::madvise(p, size_, MADV_RANDOM);
+      data_ = static_cast<const std::uint8_t *>(p);
+    }
+    // The mapping keeps the file referenced; the descriptor is not needed.
+    ::close(fd_);
+    fd_ = -1;
+#endif
+  }
+
+  MappedFile(MappedFile &&other) noexcept { swap(other); }
+
+  MappedFile &operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+      close();
+      swap(other);
+    }
+    return *this;
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  ~MappedFile() { close(); }
+
+  const std::uint8_t *data() const noexcept { return data_; }
+  std::size_t size() const noexcept { return size_; }
+
+private:
+  void swap(MappedFile &other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+#if defined(_WIN32)
+    std::swap(file_, other.file_);
+    std::swap(mapping_, other.mapping_);
+#else
+    std::swap(fd_, other.fd_);
+#endif
+  }
+
+  void close() noexcept {
+#if defined(_WIN32)
+    if (data_)
+      UnmapViewOfFile(data_);
+    if (mapping_)
+      CloseHandle(mapping_);
+    if (file_ != INVALID_HANDLE_VALUE)
+      CloseHandle(file_);
+    mapping_ = nullptr;
+    file_ = INVALID_HANDLE_VALUE;
+#else
+    if (data_)
+      ::munmap(const_cast<std::uint8_t *>(data_), size_);
+    if (fd_ >= 0)
+      ::close(fd_);
+    fd_ = -1;
+#endif
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  const std::uint8_t *data_ = nullptr;
+  std::size_t size_ = 0;
+#if defined(_WIN32)
+  HANDLE file_ = INVALID_HANDLE_VALUE;
+  HANDLE mapping_ = nullptr;
+#else
+  int fd_ = -1;
+#endif
+};
+
+/**
+ * @brief Move-only, read-only file handle serving positional reads
+ *        (`pread` / `ReadFile` at an offset).
+ *
+ * Unlike `MappedFile`, reads copy into caller memory and leave nothing
+ * mapped, so the process's resident set only holds what the caller keeps.
+ *
+ * @throws DataLoadError if the file cannot be opened.
+ */
+class FileReader {
+public:
+  FileReader() = default;
+
+  explicit FileReader(const std::string &path) {
+#if defined(_WIN32)
+    file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE)
+      throw DataLoadError("FileReader: cannot open " + path);
+#else
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0)
+      throw DataLoadError("FileReader: cannot open " + path);
+#endif
+  }
+
+  FileReader(FileReader &&other) noexcept { swap(other); }
+
+  FileReader &operator=(FileReader &&other) noexcept {
+    if (this != &other) {
+      close();
+      swap(other);
+    }
+    return *this;
+  }
+
+  FileReader(const FileReader &) = delete;
+  FileReader &operator=(const FileReader &) = delete;
+
+  ~FileReader() { close(); }
+
+  bool is_open() const noexcept {
+#if defined(_WIN32)
+    return file_ != INVALID_HANDLE_VALUE;
+#else
+    return fd_ >= 0;
+#endif
+  }
+
+  /**
+   * @brief Copy `len` bytes starting at `offset` into `out`.
+   * @throws DataLoadError on an I/O error or if the file ends first.
+   */
+  void read(std::size_t offset, std::size_t len, void *out) const {
+    auto *dst = static_cast<std::uint8_t *>(out);
+    while (len > 0) {
+#if defined(_WIN32)
+      OVERLAPPED at{};
+      at.Offset = static_cast<DWORD>(static_cast<std::uint64_t>(offset) & 0xffffffffu);
+      at.OffsetHigh = static_cast<DWORD>(static_cast<std::uint64_t>(offset) >> 32);
+      DWORD got = 0;
+      const DWORD want = static_cast<DWORD>(std::min<std::size_t>(len, 1u << 30));
+      if (!ReadFile(file_, dst, want, &got, &at) || got == 0)
+        throw DataLoadError("FileReader: short read");
+      const std::size_t n = got;
+#else
+      const ssize_t got = ::pread(fd_, dst, len, static_cast<off_t>(offset));
+      if (got < 0 && errno == EINTR)
+        continue;
+      if (got <= 0)
+        throw DataLoadError("FileReader: short read");
+      const auto n = static_cast<std::size_t>(got);
+#endif
+      dst += n;
+      offset += n;
+      len -= n;
+    }
+  }
+
+private:
+  void swap(FileReader &other) noexcept {
+#if defined(_WIN32)
+    std::swap(file_, other.file_);
+#else
+    std::swap(fd_, other.fd_);
+#endif
+  }
+
+  void close() noexcept {
+#if defined(_WIN32)
+    if (file_ != INVALID_HANDLE_VALUE)
+      CloseHandle(file_);
+    file_ = INVALID_HANDLE_VALUE;
+#else
+    if (fd_ >= 0)
+      ::close(fd_);
+    fd_ = -1;
+#endif
+  }
+
+#if defined(_WIN32)
+  HANDLE file_ = INVALID_HANDLE_VALUE;
+#else
+  int fd_ = -1;
+#endif
+};
+
+} // namespace detail
+} // namespace siderust
@@ -0,0 +1,71 @@
+#pragma once
+
+/**
+ * @file parallel.hpp
+ * @brief Minimal fork/join helpers shared by the opt-in parallel code paths.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace siderust {
+namespace detail {
+
+/// Resolve a user-facing thread count: `0` means
+/// `std::thread::hardware_concurrency()`.
+inline std::size_t resolve_threads(std::size_t requested) {
+  if (requested != 0)
+    return requested;
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Run `fn(i)` for `i = 0 … n-1` on `n` threads (the caller runs `0`).
+ *
+ * The first exception thrown by any task is rethrown on the calling thread
+ * after every worker has joined.
+ */
+template <typename Fn> inline void run_parallel(std::size_t n, Fn fn) {
+  if (n == 0)
+    return;
+  std::vector<std::exception_ptr> errors(n);
+  std::vector<std::thread> workers;
+  workers.reserve(n - 1);
+  for (std::size_t i = 1; i < n; ++i) {
+    workers.emplace_back([&, i] {
+      try {
+        fn(i);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    });
+  }
+  try {
+    fn(0);
+  } catch (...) {
+    errors[0] = std::current_exception();
+  }
+  for (auto &w : workers)
+    w.join();
+  for (const auto &e : errors) {
+    if (e)
+      std::rethrow_exception(e);
+  }
+}
+
+/**
+ * @brief Run `search(i)` for `i = 0 … n-1` on `n` threads and collect the
+ *        results in order.
+ */
+template <typename Result, typename Search>
+inline std::vector<Result> run_chunks(std::size_t n, Search search) {
+  std::vector<Result> results(n);
+  run_parallel(n, [&](std::size_t i) { results[i] = search(i); });
+  return results;
+}
+
+} // namespace detail
+} // namespace siderust
@@ -0,0 +1,87 @@
+#pragma once
+
+/**
+ * @file record_cache.hpp
+ * @brief Byte-bounded, thread-safe LRU cache of fixed-layout `double`
+ *        records, used by the paged SPK storage.
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace siderust {
+namespace detail {
+
+/// Thread-safe LRU of SPK records keyed by their first word address, bounded
+/// by the bytes of the records it holds (at least one record is kept).
+class RecordCache {
+public:
+  explicit RecordCache(std::size_t budget) : budget_(budget) {}
+
+  /// Copy record `addr` (`n` doubles) into `out`, calling `load(buf)` to
+  /// fill a new entry on a miss.
+  ///
+  /// The lock covers only the map lookups: a miss is loaded into a local
+  /// buffer without it, so threads reading other records (hits or misses)
+  /// never wait on another thread's I/O. Two threads missing the same record
+  /// may both load it; the first to re-lock inserts it and the other copies
+  /// its own buffer.
+  template <typename Load>
+  void get(std::size_t addr, std::size_t n, double *out, const Load &load) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const auto it = entries_.find(addr);
+      if (it != entries_.end()) {
+        order_.splice(order_.begin(), order_, it->second.position);
+        std::memcpy(out, it->second.words.data(), n * sizeof(double));
+        return;
+      }
+    }
+
+    std::vector<double> rec(n);
+    load(rec.data());
+    std::memcpy(out, rec.data(), n * sizeof(double));
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.find(addr) != entries_.end())
+      return;
+    order_.push_front(addr);
+    entries_.emplace(addr, Entry{order_.begin(), std::move(rec)});
+    bytes_ += n * sizeof(double);
+    evict();
+  }
+
+  std::size_t bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_;
+  }
+
+private:
+  struct Entry {
+    std::list<std::size_t>::iterator position;
+    std::vector<double> words;
+  };
+
+  void evict() {
+    while (bytes_ > budget_ && order_.size() > 1) {
+      const auto victim = entries_.find(order_.back());
+      bytes_ -= victim->second.words.size() * sizeof(double);
+      entries_.erase(victim);
+      order_.pop_back();
+    }
+  }
+
+  std::size_t budget_;
+  std::size_t bytes_ = 0;
+  std::list<std::size_t> order_; // most recently used first
+  std::unordered_map<std::size_t, Entry> entries_;
+  mutable std::mutex mutex_;
+};
+
+} // namespace detail
+} // namespace siderust
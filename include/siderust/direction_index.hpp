@@ -0,0 +1,410 @@
+#pragma once
+
+/**
+ * @file direction_index.hpp
+ * @brief Spatial index over sky directions for cone searches, nearest
+ *        neighbours and catalog cross-matching.
+ *
+ * `DirectionIndex<F>` stores the unit vectors of a direction catalog in a
+ * balanced kd-tree. Angular distance is monotonic in chord length
+ * (`|a − b| = 2·sin(θ/2)`), so every query is an ordinary Euclidean range or
+ * nearest-neighbour search in 3-D with exact angular results; there is no
+ * pixelisation error and no special handling of the poles or RA wrap.
+ *
+ * @code
+ * const DirectionIndex<frames::ICRS> index(catalog);             // span of Direction
+ * for (const auto &m : index.cone(alert, qtty::Degree(1.0 / 3600.0)))
+ *   targets.emplace_back(catalog[m.index]);                      // DirectionTarget, Subject, ...
+ * @endcode
+ *
+ * Results are indices into the span the index was built from, so matches
+ * slot straight back into the caller's `spherical::Direction` catalog.
+ */
+
+#include "constants.hpp"
+#include "coordinates/cartesian.hpp"
+#include "coordinates/spherical.hpp"
+#include "detail/parallel.hpp"
+#include "ffi_core.hpp"
+#include "frames.hpp"
+#include "span.hpp"
+
+#include <qtty/qtty.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace siderust {
+
+/**
+ * @brief Build options for `DirectionIndex`.
+ */
+struct DirectionIndexOptions {
+  /// Maximum number of directions stored in a leaf.
+  std::size_t leaf_size = 16;
+
+  /// Build threads; `1` (default) builds on the calling thread, `0` selects
+  /// `std::thread::hardware_concurrency()`.
+  std::size_t parallelism = 1;
+
+  DirectionIndexOptions() = default;
+
+  DirectionIndexOptions &with_leaf_size(std::size_t n) {
+    leaf_size = n;
+    return *this;
+  }
+
+  /// Build the independent subtrees below the top levels concurrently.
+  DirectionIndexOptions &with_parallelism(std::size_t threads) {
+    parallelism = threads;
+    return *this;
+  }
+};
+
+/// One catalog entry returned by a query.
+struct DirectionMatch {
+  std::size_t index;       ///< Position in the span the index was built from.
+  qtty::Degree separation; ///< Angular distance from the query direction.
+};
+
+/// One pair returned by `DirectionIndex::cross_match`.
+struct DirectionPair {
+  std::size_t query;       ///< Position in the query span.
+  std::size_t index;       ///< Position in the indexed catalog.
+  qtty::Degree separation; ///< Angular distance between the two.
+};
+
+/**
+ * @brief Balanced kd-tree over the unit vectors of a direction catalog.
+ *
+ * The tree is implicit (children of node `i` are `2i + 1` and `2i + 2`)
+ * and split at the median of the widest axis, so its shape depends only on
+ * the catalog size and subtrees can be built independently. The index is
+ * immutable after construction; all queries are `const` and may run
+ * concurrently.
+ *
+ * @tparam F  Frame tag of the indexed directions.
+ */
+template <typename F = frames::ICRS> class DirectionIndex {
+  static_assert(frames::is_frame_v<F>, "F must be a valid frame tag");
+
+public:
+  DirectionIndex() = default;
+
+  /**
+   * @brief Index a catalog of spherical directions.
+   *
+   * @throws InvalidArgumentError if `opts.leaf_size` is zero.
+   */
+  explicit DirectionIndex(span<const spherical::Direction<F>> dirs,
+                          const DirectionIndexOptions &opts = {}) {
+    points_.resize(dirs.size());
+    for (std::size_t i = 0; i < dirs.size(); ++i) {
+      const auto v = dirs[i].to_cartesian();
+      points_[i] = Point{v.x, v.y, v.z, i};
+    }
+    build(opts);
+  }
+
+  /// Index a catalog of unit vectors.
+  explicit DirectionIndex(span<const cartesian::Direction<F>> dirs,
+                          const DirectionIndexOptions &opts = {}) {
+    points_.resize(dirs.size());
+    for (std::size_t i = 0; i < dirs.size(); ++i) {
+      points_[i] = Point{dirs[i].x, dirs[i].y, dirs[i].z, i};
+    }
+    build(opts);
+  }
+
+  std::size_t size() const noexcept { return points_.size(); }
+  bool empty() const noexcept { return points_.empty(); }
+
+  // -- Cone search ----------------------------------------------------------
+
+  /**
+   * @brief Every catalog entry within `radius` of `center`, nearest first.
+   */
+  std::vector<DirectionMatch> cone(const spherical::Direction<F> &center,
+                                   qtty::Degree radius) const {
+    std::vector<DirectionMatch> out;
+    cone(center.to_cartesian(), radius, out);
+    return out;
+  }
+
+  /**
+   * @brief Cone search into a reused buffer (cleared first), nearest first.
+   */
+  void cone(const cartesian::Direction<F> &center, qtty::Degree radius,
+            std::vector<DirectionMatch> &out) const {
+    out.clear();
+    const Query q{center.x, center.y, center.z};
+    const double max_d2 = chord2(radius);
+    visit_within(q, max_d2, [&](const Point &p, double d2) {
+      out.push_back(DirectionMatch{p.id, to_angle(d2)});
+    });
+    std::sort(out.begin(), out.end(), [](const DirectionMatch &a, const DirectionMatch &b) {
+      return a.separation.value() < b.separation.value() ||
+             (a.separation.value() == b.separation.value() && a.index < b.index);
+    });
+  }
+
+  // -- Nearest neighbours ---------------------------------------------------
+
+  /**
+   * @brief The `k` catalog entries closest to `center`, nearest first.
+   *
+   * Returns fewer than `k` matches only when the catalog is smaller.
+   */
+  std::vector<DirectionMatch> nearest(const spherical::Direction<F> &center,
+                                      std::size_t k) const {
+    return nearest(center.to_cartesian(), k);
+  }
+
+  std::vector<DirectionMatch> nearest(const cartesian::Direction<F> &center,
+                                      std::size_t k) const {
+    std::vector<DirectionMatch> out;
+    if (k == 0 || points_.empty())
+      return out;
+
+    // Max-heap on squared chord: the top is the worst of the current best k.
+    std::priority_queue<std::pair<double, std::size_t>> best;
+    const Query q{center.x, center.y, center.z};
+    nearest_rec(0, q, k, best);
+
+    out.reserve(best.size());
+    for (; !best.empty(); best.pop()) {
+      out.push_back(DirectionMatch{best.top().second, to_angle(best.top().first)});
+    }
+    std::reverse(out.begin(), out.end());
+    return out;
+  }
+
+  // -- Cross-match ----------------------------------------------------------
+
+  /**
+   * @brief Every (query, catalog) pair closer than `radius`.
+   *
+   * Pairs are ordered by query index, then by separation. With
+   * `parallelism != 1` the queries are split into contiguous chunks
+   * searched concurrently (`0` selects the hardware concurrency); the result
+   * is identical to the serial one.
+   */
+  std::vector<DirectionPair> cross_match(span<const spherical::Direction<F>> queries,
+                                         qtty::Degree radius, std::size_t parallelism = 1) const {
+    const std::size_t n = std::min(detail::resolve_threads(parallelism),
+                                   std::max<std::size_t>(1, queries.size()));
+    auto chunks = detail::run_chunks<std::vector<DirectionPair>>(n, [&](std::size_t c) {
+      std::vector<DirectionPair> pairs;
+      std::vector<DirectionMatch> hits;
+      const std::size_t begin = queries.size() * c / n;
+      const std::size_t end = queries.size() * (c + 1) / n;
+      for (std::size_t i = begin; i < end; ++i) {
+        cone(queries[i].to_cartesian(), radius, hits);
+        for (const auto &h : hits) {
+          pairs.push_back(DirectionPair{i, h.index, h.separation});
+        }
+      }
+      return pairs;
+    });
+
+    std::vector<DirectionPair> out;
+    for (auto &chunk : chunks) {
+      out.insert(out.end(), chunk.begin(), chunk.end());
+    }
+    return out;
+  }
+
+private:
+  struct Point {
+    double x, y, z;
+    std::size_t id;
+  };
+
+  struct Query {
+    double x, y, z;
+  };
+
+  /// Axis-aligned bounding box of a subtree, plus its point range.
+  struct Node {
+    double lo[3];
+    double hi[3];
+    std::size_t begin;
+    std::size_t end;
+  };
+
+  // -- Build ----------------------------------------------------------------
+
+  void build(const DirectionIndexOptions &opts) {
+    if (opts.leaf_size == 0) {
+      throw InvalidArgumentError("DirectionIndex: leaf_size must be positive");
+    }
+    if (points_.empty())
+      return;
+
+    depth_ = 0;
+    while ((points_.size() >> depth_) > opts.leaf_size)
+      ++depth_;
+    nodes_.resize((std::size_t{2} << depth_) - 1);
+
+    // Levels above `split` are built serially; the 2^split subtrees below are
+    // independent (disjoint point ranges and node slots) and run in parallel.
+    const std::size_t threads = detail::resolve_threads(opts.parallelism);
+    std::size_t split = 0;
+    while (split < depth_ && (std::size_t{1} << split) < threads)
+      ++split;
+
+    std::vector<Task> tasks;
+    build_rec(0, 0, points_.size(), 0, split, &tasks);
+    if (tasks.empty())
+      return;
+
+    const std::size_t workers = std::min(threads, tasks.size());
+    detail::run_parallel(workers, [&](std::size_t w) {
+      for (std::size_t t = w; t < tasks.size(); t += workers) {
+        build_rec(tasks[t].node, tasks[t].begin, tasks[t].end, tasks[t].level, depth_ + 1,
+                  nullptr);
+      }
+    });
+  }
+
+  struct Task {
+    std::size_t node, begin, end, level;
+  };
+
+  /// Build node `i` over `[begin, end)`; at `level == defer` push a task instead.
+  void build_rec(std::size_t i, std::size_t begin, std::size_t end, std::size_t level,
+                 std::size_t defer, std::vector<Task> *tasks) {
+    if (tasks && level == defer) {
+      tasks->push_back(Task{i, begin, end, level});
+      return;
+    }
+
+    Node &node = nodes_[i];
+    node.begin = begin;
+    node.end = end;
+    for (int a = 0; a < 3; ++a) {
+      node.lo[a] = 2.0;
+      node.hi[a] = -2.0;
+    }
+    for (std::size_t j = begin; j < end; ++j) {
+      const double c[3] = {points_[j].x, points_[j].y, points_[j].z};
+      for (int a = 0; a < 3; ++a) {
+        node.lo[a] = std::min(node.lo[a], c[a]);
+        node.hi[a] = std::max(node.hi[a], c[a]);
+      }
+    }
+    if (level == depth_)
+      return;
+
+    int axis = 0;
+    for (int a = 1; a < 3; ++a) {
+      if (node.hi[a] - node.lo[a] > node.hi[axis] - node.lo[axis])
+        axis = a;
+    }
+    const std::size_t mid = begin + (end - begin) / 2;
+    const auto first = points_.begin();
+    std::nth_element(first + static_cast<std::ptrdiff_t>(begin),
+                     first + static_cast<std::ptrdiff_t>(mid),
+                     first + static_cast<std::ptrdiff_t>(end),
+                     [axis](const Point &a, const Point &b) {
+                       return coord(a, axis) < coord(b, axis);
+                     });
+
+    build_rec(2 * i + 1, begin, mid, level + 1, defer, tasks);
+    build_rec(2 * i + 2, mid, end, level + 1, defer, tasks);
+  }
+
+  // -- Queries --------------------------------------------------------------
+
+  static double coord(const Point &p, int axis) {
+    return axis == 0 ? p.x : (axis == 1 ? p.y : p.z);
+  }
+
+  static double dist2(const Point &p, const Query &q) {
+    const double dx = p.x - q.x, dy = p.y - q.y, dz = p.z - q.z;
+    return dx * dx + dy * dy + dz * dz;
+  }
+
+  /// Squared distance from `q` to the node's bounding box (0 inside).
+  static double box_dist2(const Node &n, const Query &q) {
+    const double c[3] = {q.x, q.y, q.z};
+    double d2 = 0.0;
+    for (int a = 0; a < 3; ++a) {
+      const double d = std::max({n.lo[a] - c[a], 0.0, c[a] - n.hi[a]});
+      d2 += d * d;
+    }
+    return d2;
+  }
+
+  /// Squared chord length of an angular radius (clamped at 180°).
+  static double chord2(qtty::Degree radius) {
+    const double r = std::min(std::max(radius.value(), 0.0), 180.0) * (constants::pi / 180.0);
+    const double c = 2.0 * std::sin(0.5 * r);
+    return c * c;
+  }
+
+  /// Angle subtended by a squared chord length.
+  static qtty::Degree to_angle(double d2) {
+    const double half = std::min(1.0, 0.5 * std::sqrt(d2));
+    return qtty::Degree(2.0 * std::asin(half) * (180.0 / constants::pi));
+  }
+
+  template <typename Visit>
+  void visit_within(const Query &q, double max_d2, Visit visit) const {
+    if (nodes_.empty())
+      return;
+    std::vector<std::size_t> stack{0};
+    while (!stack.empty()) {
+      const std::size_t i = stack.back();
+      stack.pop_back();
+      const Node &n = nodes_[i];
+      if (box_dist2(n, q) > max_d2)
+        continue;
+      if (2 * i + 1 >= nodes_.size()) {
+        for (std::size_t j = n.begin; j < n.end; ++j) {
+          const double d2 = dist2(points_[j], q);
+          if (d2 <= max_d2)
+            visit(points_[j], d2);
+        }
+        continue;
+      }
+      stack.push_back(2 * i + 2);
+      stack.push_back(2 * i + 1);
+    }
+  }
+
+  void nearest_rec(std::size_t i, const Query &q, std::size_t k,
+                   std::priority_queue<std::pair<double, std::size_t>> &best) const {
+    const Node &n = nodes_[i];
+    if (best.size() == k && box_dist2(n, q) > best.top().first)
+      return;
+    if (2 * i + 1 >= nodes_.size()) {
+      for (std::size_t j = n.begin; j < n.end; ++j) {
+        const double d2 = dist2(points_[j], q);
+        if (best.size() < k) {
+          best.emplace(d2, points_[j].id);
+        } else if (d2 < best.top().first) {
+          best.pop();
+          best.emplace(d2, points_[j].id);
+        }
+      }
+      return;
+    }
+    // Descend into the closer child first to tighten the bound early.
+    const std::size_t l = 2 * i + 1, r = 2 * i + 2;
+    const bool left_first = box_dist2(nodes_[l], q) <= box_dist2(nodes_[r], q);
+    nearest_rec(left_first ? l : r, q, k, best);
+    nearest_rec(left_first ? r : l, q, k, best);
+  }
+
+  std::vector<Point> points_;
+  std::vector<Node> nodes_;
+  std::size_t depth_ = 0;
+};
+
+} // namespace siderust
@@ -6,12 +6,29 @@
  *
  * Returns compile-time typed `cartesian::Position<C, F, U>` with the
  * correct center, frame, and unit for each ephemeris query.
+ *
+ * Every body also has a series overload taking a span of epochs, which
+ * writes into a span or `PositionArray` and checks the FFI status once per
+ * batch instead of once per epoch:
+ *
+ * @code
+ * std::vector<Time<TT, JD>> days = ...;                  // 10 years, daily
+ * ephemeris::HeliocentricPositions mars;                 // SoA, AU
+ * ephemeris::mars_heliocentric(days, mars, 0);            // all cores
+ * @endcode
  */
 
 #include "coordinates.hpp"
+#include "detail/parallel.hpp"
 #include "ffi_core.hpp"
+#include "span.hpp"
 #include "time.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
 namespace siderust {
 
 namespace ephemeris {
@@ -212,6 +229,527 @@ moon_geocentric(const Time<TT, JD> &jd) {
   return cartesian::position::MoonGeocentric<qtty::Kilometer>::from_c(out);
 }
 
+// ============================================================================
+// Series API — one call per body over a span of epochs
+// ============================================================================
+
+namespace detail {
+
+/**
+ * @brief Evaluate `eval(jd, &out)` at every epoch and pass each result to
+ *        `store(i, out)`.
+ *
+ * Epochs are split into `parallelism` contiguous chunks (`0` = hardware
+ * concurrency); the VSOP87/ELP2000 entry points are pure functions of time,
+ * so chunks run concurrently without synchronisation. A chunk stops at its
+ * first failing epoch and the earliest failure is reported once, after all
+ * chunks have joined.
+ */
+template <typename Eval, typename Store>
+inline void ephemeris_series(span<const Time<TT, JD>> jd, std::size_t parallelism,
+                             const char *operation, Eval eval, Store store) {
+  const std::size_t n = jd.size();
+  const std::size_t chunks =
+      std::min(siderust::detail::resolve_threads(parallelism), std::max<std::size_t>(n, 1));
+  std::vector<siderust_status_t> status(chunks, SIDERUST_STATUS_T_OK);
+  std::vector<std::size_t> failed(chunks, n);
+  siderust::detail::run_parallel(chunks, [&](std::size_t c) {
+    const std::size_t end = n * (c + 1) / chunks;
+    for (std::size_t i = n * c / chunks; i < end; ++i) {
+      siderust_cartesian_pos_t out;
+      const siderust_status_t s = eval(jd[i].value(), &out);
+      if (s != SIDERUST_STATUS_T_OK) {
+        status[c] = s;
+        failed[c] = i;
+        return;
+      }
+      store(i, out);
+    }
+  });
+  for (std::size_t c = 0; c < chunks; ++c) {
+    if (status[c] != SIDERUST_STATUS_T_OK) {
+      const std::string what =
+          std::string(operation) + " (epoch " + std::to_string(failed[c]) + ")";
+      check_status(status[c], what.c_str());
+    }
+  }
+}
+
+template <typename P> struct position_array;
+
+template <typename C, typename F, typename U> struct position_array<cartesian::Position<C, F, U>> {
+  using type = cartesian::PositionArray<C, F, U>;
+};
+
+template <typename P> using position_array_t = typename position_array<P>::type;
+
+/// Span form of the series overloads: checks sizes, then fills `out[i]`.
+template <typename Pos, typename Eval>
+inline void series_into(span<const Time<TT, JD>> jd, span<Pos> out, std::size_t parallelism,
+                        const char *operation, Eval eval) {
+  siderust::detail::check_batch_size(jd.size(), out.size(), operation);
+  ephemeris_series(jd, parallelism, operation, eval,
+                   [&](std::size_t i, const siderust_cartesian_pos_t &o) {
+                     out[i] = Pos::from_c(o);
+                   });
+}
+
+/// `PositionArray` form of the series overloads: resizes `out`, then fills it.
+template <typename C, typename F, typename U, typename Eval>
+inline void series_into(span<const Time<TT, JD>> jd, cartesian::PositionArray<C, F, U> &out,
+                        std::size_t parallelism, const char *operation, Eval eval) {
+  out.resize(jd.size());
+  ephemeris_series(jd, parallelism, operation, eval,
+                   [&](std::size_t i, const siderust_cartesian_pos_t &o) {
+                     out.set(i, cartesian::Position<C, F, U>::from_c(o));
+                   });
+}
+
+/// Earth's barycentric velocity [AU/day, EclipticMeanJ2000]: central
+/// difference of `earth_barycentric` over ±0.01 day, as in
+/// `snapshot(jd, true)` (relative error ≲1e-6).
+inline void earth_barycentric_velocity(const Time<TT, JD> &jd, double (&out)[3]) {
+  constexpr double h = 0.01; // days
+  const auto lo = earth_barycentric(Time<TT, JD>(jd.value() - h));
+  const auto hi = earth_barycentric(Time<TT, JD>(jd.value() + h));
+  out[0] = (hi.x().value() - lo.x().value()) / (2.0 * h);
+  out[1] = (hi.y().value() - lo.y().value()) / (2.0 * h);
+  out[2] = (hi.z().value() - lo.z().value()) / (2.0 * h);
+}
+
+} // namespace detail
+
+/// A barycentric VSOP87 position (EclipticMeanJ2000, AU).
+using BarycentricPosition = cartesian::position::HelioBarycentric<qtty::AstronomicalUnit>;
+/// A heliocentric VSOP87 position (EclipticMeanJ2000, AU).
+using HeliocentricPosition = cartesian::position::EclipticMeanJ2000<qtty::AstronomicalUnit>;
+/// A geocentric ELP2000 Moon position (EclipticMeanJ2000, km).
+using MoonGeocentricPosition = cartesian::position::MoonGeocentric<qtty::Kilometer>;
+
+/// SoA arrays of the above, filled by the `PositionArray` series overloads.
+using BarycentricPositions = detail::position_array_t<BarycentricPosition>;
+using HeliocentricPositions = detail::position_array_t<HeliocentricPosition>;
+using MoonGeocentricPositions = detail::position_array_t<MoonGeocentricPosition>;
+
+// Each body has two series overloads. The span form fills `out[i]` with the
+// position at `jd[i]`; the `PositionArray` form resizes `out` to `jd.size()`
+// first. `parallelism` is the number of threads (`0` = hardware
+// concurrency), and results are identical to the single-epoch functions.
+
+/**
+ * @brief Sun's barycentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void sun_barycentric(span<const Time<TT, JD>> jd, span<BarycentricPosition> out,
+                            std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::sun_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_sun_barycentric(t, o);
+                      });
+}
+
+/// `sun_barycentric` at each epoch of `jd` into `out`, resized to match.
+inline void sun_barycentric(span<const Time<TT, JD>> jd, BarycentricPositions &out,
+                            std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::sun_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_sun_barycentric(t, o);
+                      });
+}
+
+/**
+ * @brief Earth's barycentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void earth_barycentric(span<const Time<TT, JD>> jd, span<BarycentricPosition> out,
+                              std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::earth_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_earth_barycentric(t, o);
+                      });
+}
+
+/// `earth_barycentric` at each epoch of `jd` into `out`, resized to match.
+inline void earth_barycentric(span<const Time<TT, JD>> jd, BarycentricPositions &out,
+                              std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::earth_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_earth_barycentric(t, o);
+                      });
+}
+
+/**
+ * @brief Earth's heliocentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void earth_heliocentric(span<const Time<TT, JD>> jd, span<HeliocentricPosition> out,
+                               std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::earth_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_earth_heliocentric(t, o);
+                      });
+}
+
+/// `earth_heliocentric` at each epoch of `jd` into `out`, resized to match.
+inline void earth_heliocentric(span<const Time<TT, JD>> jd, HeliocentricPositions &out,
+                               std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::earth_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_earth_heliocentric(t, o);
+                      });
+}
+
+/**
+ * @brief Mercury's heliocentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void mercury_heliocentric(span<const Time<TT, JD>> jd, span<HeliocentricPosition> out,
+                                 std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::mercury_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_mercury_heliocentric(t, o);
+                      });
+}
+
+/// `mercury_heliocentric` at each epoch of `jd` into `out`, resized to match.
+inline void mercury_heliocentric(span<const Time<TT, JD>> jd, HeliocentricPositions &out,
+                                 std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::mercury_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_mercury_heliocentric(t, o);
+                      });
+}
+
+/**
+ * @brief Mercury's barycentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void mercury_barycentric(span<const Time<TT, JD>> jd, span<BarycentricPosition> out,
+                                std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::mercury_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_mercury_barycentric(t, o);
+                      });
+}
+
+/// `mercury_barycentric` at each epoch of `jd` into `out`, resized to match.
+inline void mercury_barycentric(span<const Time<TT, JD>> jd, BarycentricPositions &out,
+                                std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::mercury_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_mercury_barycentric(t, o);
+                      });
+}
+
+/**
+ * @brief Venus's heliocentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void venus_heliocentric(span<const Time<TT, JD>> jd, span<HeliocentricPosition> out,
+                               std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::venus_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_venus_heliocentric(t, o);
+                      });
+}
+
+/// `venus_heliocentric` at each epoch of `jd` into `out`, resized to match.
+inline void venus_heliocentric(span<const Time<TT, JD>> jd, HeliocentricPositions &out,
+                               std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::venus_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_venus_heliocentric(t, o);
+                      });
+}
+
+/**
+ * @brief Venus's barycentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void venus_barycentric(span<const Time<TT, JD>> jd, span<BarycentricPosition> out,
+                              std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::venus_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_venus_barycentric(t, o);
+                      });
+}
+
+/// `venus_barycentric` at each epoch of `jd` into `out`, resized to match.
+inline void venus_barycentric(span<const Time<TT, JD>> jd, BarycentricPositions &out,
+                              std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::venus_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_venus_barycentric(t, o);
+                      });
+}
+
+/**
+ * @brief Mars's heliocentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void mars_heliocentric(span<const Time<TT, JD>> jd, span<HeliocentricPosition> out,
+                              std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::mars_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_mars_heliocentric(t, o);
+                      });
+}
+
+/// `mars_heliocentric` at each epoch of `jd` into `out`, resized to match.
+inline void mars_heliocentric(span<const Time<TT, JD>> jd, HeliocentricPositions &out,
+                              std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::mars_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_mars_heliocentric(t, o);
+                      });
+}
+
+/**
+ * @brief Mars's barycentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void mars_barycentric(span<const Time<TT, JD>> jd, span<BarycentricPosition> out,
+                             std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::mars_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_mars_barycentric(t, o);
+                      });
+}
+
+/// `mars_barycentric` at each epoch of `jd` into `out`, resized to match.
+inline void mars_barycentric(span<const Time<TT, JD>> jd, BarycentricPositions &out,
+                             std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::mars_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_mars_barycentric(t, o);
+                      });
+}
+
+/**
+ * @brief Jupiter's heliocentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void jupiter_heliocentric(span<const Time<TT, JD>> jd, span<HeliocentricPosition> out,
+                                 std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::jupiter_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_jupiter_heliocentric(t, o);
+                      });
+}
+
+/// `jupiter_heliocentric` at each epoch of `jd` into `out`, resized to match.
+inline void jupiter_heliocentric(span<const Time<TT, JD>> jd, HeliocentricPositions &out,
+                                 std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::jupiter_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_jupiter_heliocentric(t, o);
+                      });
+}
+
+/**
+ * @brief Jupiter's barycentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void jupiter_barycentric(span<const Time<TT, JD>> jd, span<BarycentricPosition> out,
+                                std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::jupiter_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_jupiter_barycentric(t, o);
+                      });
+}
+
+/// `jupiter_barycentric` at each epoch of `jd` into `out`, resized to match.
+inline void jupiter_barycentric(span<const Time<TT, JD>> jd, BarycentricPositions &out,
+                                std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::jupiter_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_jupiter_barycentric(t, o);
+                      });
+}
+
+/**
+ * @brief Saturn's heliocentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void saturn_heliocentric(span<const Time<TT, JD>> jd, span<HeliocentricPosition> out,
+                                std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::saturn_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_saturn_heliocentric(t, o);
+                      });
+}
+
+/// `saturn_heliocentric` at each epoch of `jd` into `out`, resized to match.
+inline void saturn_heliocentric(span<const Time<TT, JD>> jd, HeliocentricPositions &out,
+                                std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::saturn_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_saturn_heliocentric(t, o);
+                      });
+}
+
+/**
+ * @brief Saturn's barycentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void saturn_barycentric(span<const Time<TT, JD>> jd, span<BarycentricPosition> out,
+                               std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::saturn_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_saturn_barycentric(t, o);
+                      });
+}
+
+/// `saturn_barycentric` at each epoch of `jd` into `out`, resized to match.
+inline void saturn_barycentric(span<const Time<TT, JD>> jd, BarycentricPositions &out,
+                               std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::saturn_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_saturn_barycentric(t, o);
+                      });
+}
+
+/**
+ * @brief Uranus's heliocentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void uranus_heliocentric(span<const Time<TT, JD>> jd, span<HeliocentricPosition> out,
+                                std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::uranus_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_uranus_heliocentric(t, o);
+                      });
+}
+
+/// `uranus_heliocentric` at each epoch of `jd` into `out`, resized to match.
+inline void uranus_heliocentric(span<const Time<TT, JD>> jd, HeliocentricPositions &out,
+                                std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::uranus_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_uranus_heliocentric(t, o);
+                      });
+}
+
+/**
+ * @brief Uranus's barycentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void uranus_barycentric(span<const Time<TT, JD>> jd, span<BarycentricPosition> out,
+                               std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::uranus_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_uranus_barycentric(t, o);
+                      });
+}
+
+/// `uranus_barycentric` at each epoch of `jd` into `out`, resized to match.
+inline void uranus_barycentric(span<const Time<TT, JD>> jd, BarycentricPositions &out,
+                               std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::uranus_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_uranus_barycentric(t, o);
+                      });
+}
+
+/**
+ * @brief Neptune's heliocentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void neptune_heliocentric(span<const Time<TT, JD>> jd, span<HeliocentricPosition> out,
+                                 std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::neptune_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_neptune_heliocentric(t, o);
+                      });
+}
+
+/// `neptune_heliocentric` at each epoch of `jd` into `out`, resized to match.
+inline void neptune_heliocentric(span<const Time<TT, JD>> jd, HeliocentricPositions &out,
+                                 std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::neptune_heliocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_neptune_heliocentric(t, o);
+                      });
+}
+
+/**
+ * @brief Neptune's barycentric position (EclipticMeanJ2000, AU) via VSOP87
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void neptune_barycentric(span<const Time<TT, JD>> jd, span<BarycentricPosition> out,
+                                std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::neptune_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_neptune_barycentric(t, o);
+                      });
+}
+
+/// `neptune_barycentric` at each epoch of `jd` into `out`, resized to match.
+inline void neptune_barycentric(span<const Time<TT, JD>> jd, BarycentricPositions &out,
+                                std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::neptune_barycentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_neptune_barycentric(t, o);
+                      });
+}
+
+/**
+ * @brief Moon's geocentric position (EclipticMeanJ2000, km) via ELP2000
+ *        at each epoch of `jd`.
+ *
+ * @throws InvalidDimensionError if `jd` and `out` differ in size.
+ */
+inline void moon_geocentric(span<const Time<TT, JD>> jd, span<MoonGeocentricPosition> out,
+                            std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::moon_geocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_moon_geocentric(t, o);
+                      });
+}
+
+/// `moon_geocentric` at each epoch of `jd` into `out`, resized to match.
+inline void moon_geocentric(span<const Time<TT, JD>> jd, MoonGeocentricPositions &out,
+                            std::size_t parallelism = 1) {
+  detail::series_into(jd, out, parallelism, "ephemeris::moon_geocentric",
+                      [](double t, siderust_cartesian_pos_t *o) {
+                        return siderust_vsop87_moon_geocentric(t, o);
+                      });
+}
+
 } // namespace ephemeris
 
 } // namespace siderust
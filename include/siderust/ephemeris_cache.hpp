@@ -0,0 +1,378 @@
+#pragma once
+
+/**
+ * @file ephemeris_cache.hpp
+ * @brief Chebyshev-fitted cache of geocentric VSOP87 / ELP2000 positions.
+ *
+ * Evaluating the analytic series costs thousands of terms per epoch.
+ * `EphemerisCache` samples them once over a requested time span and stores
+ * piecewise Chebyshev polynomials per body — the layout of an SPK type 2
+ * segment — after which a position costs one segment lookup and a
+ * Clenshaw recurrence (≈40 multiply-adds for the default degree 12), and a
+ * velocity comes from the derivative of the same polynomials.
+ *
+ * @code
+ * const Body bodies[] = {Body::Sun, Body::Moon};
+ * const EphemerisCache cache(bodies, night_start, night_end);
+ * auto moon = cache.geocentric(Body::Moon, jd);          // AU, EclipticMeanJ2000
+ * @endcode
+ *
+ * A built cache is immutable: every member is `const`, so one instance can
+ * be shared read-only across threads without synchronisation.
+ */
+
+#include "body_target.hpp"
+#include "constants.hpp"
+#include "coordinates.hpp"
+#include "detail/chebyshev.hpp"
+#include "ephemeris.hpp"
+#include "ffi_core.hpp"
+#include "runtime_ephemeris.hpp"
+#include "span.hpp"
+#include "time.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace siderust {
+
+/// Build options for `EphemerisCache`.
+struct EphemerisCacheOptions {
+  /// Maximum position error accepted at the fit check points. Segments are
+  /// halved (up to `max_refinements` times) until every body meets it;
+  /// construction fails if one does not.
+  qtty::Kilometer tolerance = qtty::Kilometer(1e-3);
+
+  /// Polynomial degree per segment (coefficients per component − 1).
+  std::size_t degree = 12;
+
+  /// Number of times a body's segments may be halved to reach `tolerance`.
+  std::size_t max_refinements = 8;
+
+  /// Threads used to evaluate the series while fitting; `0` selects
+  /// `std::thread::hardware_concurrency()`.
+  std::size_t parallelism = 1;
+
+  EphemerisCacheOptions() = default;
+
+  EphemerisCacheOptions &with_tolerance(qtty::Kilometer tol) {
+    tolerance = tol;
+    return *this;
+  }
+
+  EphemerisCacheOptions &with_degree(std::size_t n) {
+    degree = n;
+    return *this;
+  }
+
+  EphemerisCacheOptions &with_max_refinements(std::size_t n) {
+    max_refinements = n;
+    return *this;
+  }
+
+  EphemerisCacheOptions &with_parallelism(std::size_t threads) {
+    parallelism = threads;
+    return *this;
+  }
+};
+
+namespace detail {
+
+/// Geocentric positions (EclipticMeanJ2000, AU) of `b` at every epoch,
+/// evaluated through the `ephemeris::` series overloads.
+inline void geocentric_series(
+    Body b, span<const Time<TT, JD>> jd, std::size_t parallelism,
+    cartesian::PositionArray<centers::Geocentric, frames::EclipticMeanJ2000, qtty::AstronomicalUnit>
+        &out) {
+  out.resize(jd.size());
+  if (b == Body::Moon) {
+    cartesian::PositionArray<centers::Geocentric, frames::EclipticMeanJ2000, qtty::Kilometer> km;
+    ephemeris::moon_geocentric(jd, km, parallelism);
+    const double to_au = qtty::Kilometer(1.0).to<qtty::AstronomicalUnit>().value();
+    for (std::size_t i = 0; i < jd.size(); ++i) {
+      out.x()[i] = km.x()[i] * to_au;
+      out.y()[i] = km.y()[i] * to_au;
+      out.z()[i] = km.z()[i] * to_au;
+    }
+    return;
+  }
+
+  cartesian::PositionArray<centers::Heliocentric, frames::EclipticMeanJ2000,
+                           qtty::AstronomicalUnit>
+      earth, body;
+  ephemeris::earth_heliocentric(jd, earth, parallelism);
+  switch (b) {
+  case Body::Sun:
+    body.resize(jd.size()); // the Sun is the heliocentric origin
+    break;
+  case Body::Mercury:
+    ephemeris::mercury_heliocentric(jd, body, parallelism);
+    break;
+  case Body::Venus:
+    ephemeris::venus_heliocentric(jd, body, parallelism);
+    break;
+  case Body::Mars:
+    ephemeris::mars_heliocentric(jd, body, parallelism);
+    break;
+  case Body::Jupiter:
+    ephemeris::jupiter_heliocentric(jd, body, parallelism);
+    break;
+  case Body::Saturn:
+    ephemeris::saturn_heliocentric(jd, body, parallelism);
+    break;
+  case Body::Uranus:
+    ephemeris::uranus_heliocentric(jd, body, parallelism);
+    break;
+  case Body::Neptune:
+    ephemeris::neptune_heliocentric(jd, body, parallelism);
+    break;
+  default:
+    throw InvalidArgumentError("EphemerisCache: unsupported body");
+  }
+  for (std::size_t i = 0; i < jd.size(); ++i) {
+    out.x()[i] = body.x()[i] - earth.x()[i];
+    out.y()[i] = body.y()[i] - earth.y()[i];
+    out.z()[i] = body.z()[i] - earth.z()[i];
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Piecewise-Chebyshev cache of geocentric body positions over a
+ *        fixed time span.
+ *
+ * Positions are geocentric, geometric, in the mean ecliptic and equinox of
+ * J2000 and in AU — the same quantity `ephemeris::snapshot` derives, fitted
+ * directly so the Moon keeps full ELP2000 precision. Each body gets its own
+ * uniform segment length, starting at 8 days for the Moon and 32 days for
+ * the Sun and planets and halved until the fit error at the check points
+ * (midway between the Chebyshev nodes, plus both segment ends) is within
+ * `tolerance`.
+ */
+class EphemerisCache {
+public:
+  using Position =
+      cartesian::Position<centers::Geocentric, frames::EclipticMeanJ2000, qtty::AstronomicalUnit>;
+
+  /**
+   * @brief Fit `bodies` over `[start, end]`.
+   *
+   * @throws InvalidArgumentError if `end <= start`, `degree` is zero, a
+   *         body is listed twice, or a body's fit error still exceeds
+   *         `tolerance` after `max_refinements` halvings.
+   */
+  EphemerisCache(span<const Body> bodies, const Time<TT, JD> &start, const Time<TT, JD> &end,
+                 const EphemerisCacheOptions &opts = {})
+      : start_(start), end_(end), tolerance_(opts.tolerance), degree_(opts.degree) {
+    if (!(end.value() > start.value()))
+      throw InvalidArgumentError("EphemerisCache: end must be after start");
+    if (opts.degree == 0)
+      throw InvalidArgumentError("EphemerisCache: degree must be positive");
+    series_.reserve(bodies.size());
+    for (Body b : bodies) {
+      if (find(b) != nullptr)
+        throw InvalidArgumentError("EphemerisCache: body listed twice");
+      series_.push_back(fit(b, opts));
+    }
+  }
+
+  const Time<TT, JD> &start() const { return start_; }
+  const Time<TT, JD> &end() const { return end_; }
+
+  /// Requested fit tolerance.
+  qtty::Kilometer tolerance() const { return tolerance_; }
+
+  bool contains(Body b) const { return find(b) != nullptr; }
+
+  /// Largest error measured at the check points while fitting `b`.
+  qtty::Kilometer fit_error(Body b) const { return qtty::Kilometer(series(b).fit_error_km); }
+
+  /// Segment length chosen for `b`.
+  qtty::Day segment_length(Body b) const { return qtty::Day(series(b).length); }
+
+  /// Bytes held by the coefficient tables.
+  std::size_t memory_bytes() const {
+    std::size_t bytes = sizeof(*this) + series_.capacity() * sizeof(Series);
+    for (const auto &s : series_)
+      bytes += s.coeffs.capacity() * sizeof(double);
+    return bytes;
+  }
+
+  /// `memory_bytes()` normalised to one Julian year of coverage.
+  double bytes_per_year() const {
+    return static_cast<double>(memory_bytes()) * 365.25 / (end_.value() - start_.value());
+  }
+
+  // -- Queries --------------------------------------------------------------
+
+  /**
+   * @brief Geocentric position of `b` at `jd`.
+   *
+   * @throws InvalidArgumentError if `b` is not cached.
+   * @throws OutOfRangeError if `jd` lies outside `[start(), end()]`.
+   */
+  Position geocentric(Body b, const Time<TT, JD> &jd) const {
+    const Series &s = series(b);
+    double x;
+    const double *c = segment(s, jd.value(), x);
+    const std::size_t n = degree_ + 1;
+    return Position(detail::chebyshev_value(c, n, x), detail::chebyshev_value(c + n, n, x),
+                    detail::chebyshev_value(c + 2 * n, n, x));
+  }
+
+  /// Geocentric velocity of `b` at `jd` (AU/day), from the fitted polynomials.
+  CartesianVelocity geocentric_velocity(Body b, const Time<TT, JD> &jd) const {
+    Position p;
+    CartesianVelocity v;
+    state(b, jd, p, v);
+    return v;
+  }
+
+  /// Position and velocity of `b` at `jd` in one evaluation.
+  void state(Body b, const Time<TT, JD> &jd, Position &pos, CartesianVelocity &vel) const {
+    const Series &s = series(b);
+    double x;
+    const double *c = segment(s, jd.value(), x);
+    const std::size_t n = degree_ + 1;
+    const double dxdt = 2.0 / s.length;
+    double p[3], d[3];
+    for (std::size_t k = 0; k < 3; ++k)
+      detail::chebyshev_eval(c + k * n, n, x, p[k], d[k]);
+    pos = Position(p[0], p[1], p[2]);
+    vel = {d[0] * dxdt, d[1] * dxdt, d[2] * dxdt, SIDERUST_FRAME_T_ECLIPTIC_MEAN_J2000};
+  }
+
+  /**
+   * @brief Geocentric positions of `b` at every epoch.
+   *
+   * @throws InvalidDimensionError if the spans differ in size.
+   */
+  void geocentric(Body b, span<const Time<TT, JD>> jd, span<Position> out) const {
+    detail::check_batch_size(jd.size(), out.size(), "EphemerisCache::geocentric");
+    for (std::size_t i = 0; i < jd.size(); ++i)
+      out[i] = geocentric(b, jd[i]);
+  }
+
+private:
+  struct Series {
+    Body body;
+    double length;              ///< Segment length [days].
+    std::size_t segments;       ///< Number of segments covering the span.
+    std::vector<double> coeffs; ///< [segment][component][k], (degree + 1) per component.
+    double fit_error_km;
+  };
+
+  const Series *find(Body b) const {
+    for (const auto &s : series_) {
+      if (s.body == b)
+        return &s;
+    }
+    return nullptr;
+  }
+
+  const Series &series(Body b) const {
+    const Series *s = find(b);
+    if (s == nullptr)
+      throw InvalidArgumentError("EphemerisCache: body not cached: " + BodyTarget(b).name());
+    return *s;
+  }
+
+  /// Coefficients of the segment holding `jd`; `x` receives the normalised
+  /// time in [-1, 1].
+  const double *segment(const Series &s, double jd, double &x) const {
+    if (jd < start_.value() || jd > end_.value())
+      throw OutOfRangeError("EphemerisCache: epoch " + std::to_string(jd) + " outside cache span");
+    const double t = (jd - start_.value()) / s.length;
+    const std::size_t i = std::min(static_cast<std::size_t>(t), s.segments - 1);
+    x = 2.0 * (t - static_cast<double>(i)) - 1.0;
+    return s.coeffs.data() + i * 3 * (degree_ + 1);
+  }
+
+  Series fit(Body b, const EphemerisCacheOptions &opts) const {
+    const std::size_t n = degree_ + 1;
+    const double span_days = end_.value() - start_.value();
+    const double initial = b == Body::Moon ? 8.0 : 32.0;
+
+    Series s{b, 0.0, static_cast<std::size_t>(std::ceil(span_days / initial)), {}, 0.0};
+    s.segments = std::max<std::size_t>(s.segments, 1);
+
+    // Chebyshev nodes and the check points midway between them, on [-1, 1].
+    // The segment ends are checked too: interpolation error peaks there.
+    std::vector<double> nodes(n), checks(n + 1);
+    for (std::size_t j = 0; j < n; ++j)
+      nodes[j] = std::cos(constants::pi * (static_cast<double>(j) + 0.5) / static_cast<double>(n));
+    for (std::size_t j = 0; j <= n; ++j)
+      checks[j] = std::cos(constants::pi * static_cast<double>(j) / static_cast<double>(n));
+
+    const double au_km = qtty::AstronomicalUnit(1.0).to<qtty::Kilometer>().value();
+    for (std::size_t refinement = 0;; ++refinement) {
+      s.length = span_days / static_cast<double>(s.segments);
+      const std::size_t per_segment = n + checks.size();
+
+      std::vector<Time<TT, JD>> epochs;
+      epochs.reserve(s.segments * per_segment);
+      for (std::size_t i = 0; i < s.segments; ++i) {
+        const double mid = start_.value() + (static_cast<double>(i) + 0.5) * s.length;
+        for (double x : nodes)
+          epochs.push_back(Time<TT, JD>(mid + 0.5 * s.length * x));
+        for (double x : checks)
+          epochs.push_back(Time<TT, JD>(mid + 0.5 * s.length * x));
+      }
+      cartesian::PositionArray<centers::Geocentric, frames::EclipticMeanJ2000,
+                               qtty::AstronomicalUnit>
+          values;
+      detail::geocentric_series(b, epochs, opts.parallelism, values);
+      const span<const double> comp[3] = {values.x(), values.y(), values.z()};
+
+      s.coeffs.assign(s.segments * 3 * n, 0.0);
+      double worst = 0.0;
+      for (std::size_t i = 0; i < s.segments; ++i) {
+        const std::size_t base = i * per_segment;
+        for (std::size_t k = 0; k < 3; ++k) {
+          double *c = s.coeffs.data() + (i * 3 + k) * n;
+          for (std::size_t m = 0; m < n; ++m) {
+            double sum = 0.0;
+            for (std::size_t j = 0; j < n; ++j) {
+              sum += comp[k][base + j] * std::cos(constants::pi * static_cast<double>(m) *
+                                                  (static_cast<double>(j) + 0.5) /
+                                                  static_cast<double>(n));
+            }
+            c[m] = sum * (m == 0 ? 1.0 : 2.0) / static_cast<double>(n);
+          }
+        }
+        for (std::size_t j = 0; j < checks.size(); ++j) {
+          double err2 = 0.0;
+          for (std::size_t k = 0; k < 3; ++k) {
+            const double fit =
+                detail::chebyshev_value(s.coeffs.data() + (i * 3 + k) * n, n, checks[j]);
+            const double diff = fit - comp[k][base + n + j];
+            err2 += diff * diff;
+          }
+          worst = std::max(worst, std::sqrt(err2) * au_km);
+        }
+      }
+      s.fit_error_km = worst;
+      if (worst <= tolerance_.value())
+        return s;
+      if (refinement >= opts.max_refinements) {
+        throw InvalidArgumentError(
+            "EphemerisCache: " + BodyTarget(b).name() + " fit error " + std::to_string(worst) +
+            " km exceeds tolerance " + std::to_string(tolerance_.value()) + " km after " +
+            std::to_string(opts.max_refinements) + " refinements");
+      }
+      s.segments *= 2;
+    }
+  }
+
+  Time<TT, JD> start_;
+  Time<TT, JD> end_;
+  qtty::Kilometer tolerance_;
+  std::size_t degree_;
+  std::vector<Series> series_;
+};
+
+} // namespace siderust
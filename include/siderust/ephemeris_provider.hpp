@@ -0,0 +1,102 @@
+#pragma once
+
+/**
+ * @file ephemeris_provider.hpp
+ * @brief Non-owning selector of the ephemeris behind altitude searches.
+ *
+ * The altitude searches in `altitude.hpp`, `body_target.hpp` and
+ * `subject.hpp` evaluate the built-in VSOP87 / ELP2000 series inside
+ * siderust-ffi. An `EphemerisProvider` points them at a loaded
+ * `RuntimeEphemeris` (e.g. DE440) or a precomputed `EphemerisCache`
+ * instead; the overloads taking one are defined in `ephemeris_search.hpp`.
+ *
+ * @code
+ * const RuntimeEphemeris de440(
+ *     path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+ * auto nights = sun::below_threshold(site, window, qtty::Degree(-18.0), de440);
+ *
+ * const auto ctx = AstroContext().with_ephemeris(de440);
+ * auto moonrise = moon::crossings(site, window, qtty::Degree(0.0), ctx);
+ * @endcode
+ */
+
+#include "ffi_core.hpp"
+
+namespace siderust {
+
+class AstroContext;
+class EphemerisCache;
+class RuntimeEphemeris;
+
+/// Where an `EphemerisProvider` takes body positions from.
+enum class EphemerisSource : int32_t {
+  Builtin, ///< VSOP87 / ELP2000 series inside siderust-ffi.
+  Runtime, ///< A loaded `RuntimeEphemeris` (JPL DE kernel).
+  Cache,   ///< A fitted `EphemerisCache`.
+};
+
+/**
+ * @brief Borrowed handle to the ephemeris an altitude search should use.
+ *
+ * Converts implicitly from a `RuntimeEphemeris`, an `EphemerisCache` or an
+ * `AstroContext`, so any of them can be passed where a provider is
+ * expected. The provider only stores a pointer: the ephemeris must outlive
+ * every search it is passed to. Converting from an `AstroContext` also
+ * carries the context's Earth-orientation model, which then sets the
+ * horizontal rotation of searches on a runtime ephemeris or a cache.
+ *
+ * A built-in provider, default-constructed or taken from an `AstroContext`,
+ * forwards to the siderust-ffi searches, which apply their own model:
+ * searches given one behave exactly like the overloads without a provider.
+ */
+class EphemerisProvider {
+public:
+  constexpr EphemerisProvider() = default;
+
+  constexpr EphemerisProvider(const RuntimeEphemeris &eph)
+      : source_(EphemerisSource::Runtime), runtime_(&eph) {}
+
+  constexpr EphemerisProvider(const EphemerisCache &cache)
+      : source_(EphemerisSource::Cache), cache_(&cache) {}
+
+  /// The context's provider, using the context's Earth-orientation model.
+  EphemerisProvider(const AstroContext &ctx);
+
+  EphemerisProvider(const RuntimeEphemeris &&) = delete;
+  EphemerisProvider(const EphemerisCache &&) = delete;
+
+  /// The built-in VSOP87 / ELP2000 series.
+  static constexpr EphemerisProvider builtin() { return EphemerisProvider(); }
+
+  constexpr EphemerisSource source() const { return source_; }
+  constexpr bool is_builtin() const { return source_ == EphemerisSource::Builtin; }
+
+  /// The runtime ephemeris, or `nullptr` unless `source() == Runtime`.
+  constexpr const RuntimeEphemeris *runtime() const { return runtime_; }
+
+  /// The cache, or `nullptr` unless `source() == Cache`.
+  constexpr const EphemerisCache *cache() const { return cache_; }
+
+  /// True when the provider carries an Earth-orientation model.
+  constexpr bool has_model() const { return has_model_; }
+
+  /// The carried model; only meaningful when `has_model()`.
+  constexpr EarthOrientationModel model() const { return model_; }
+
+  /// Copy of this provider that rotates into the horizontal frame with `m`.
+  constexpr EphemerisProvider with_model(EarthOrientationModel m) const {
+    EphemerisProvider out = *this;
+    out.model_ = m;
+    out.has_model_ = true;
+    return out;
+  }
+
+private:
+  EphemerisSource source_ = EphemerisSource::Builtin;
+  const RuntimeEphemeris *runtime_ = nullptr;
+  const EphemerisCache *cache_ = nullptr;
+  EarthOrientationModel model_ = EarthOrientationModel::Iau2006A;
+  bool has_model_ = false;
+};
+
+} // namespace siderust
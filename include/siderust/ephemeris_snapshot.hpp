@@ -0,0 +1,373 @@
+#pragma once
+
+/**
+ * @file ephemeris_snapshot.hpp
+ * @brief Sun, Moon and the eight planets at one epoch, sharing common terms.
+ *
+ * Asking `ephemeris.hpp` for every body's heliocentric, barycentric and
+ * geocentric position costs two or three VSOP87 evaluations per body, and
+ * every geocentric conversion re-evaluates the Earth. `ephemeris::snapshot`
+ * evaluates each series once — the Sun's barycentric offset, the Earth, the
+ * seven other planets and the Moon — and derives every other position by
+ * vector addition:
+ *
+ * | Quantity     | Derived as                                  |
+ * |--------------|---------------------------------------------|
+ * | heliocentric | VSOP87 series (Moon: Earth + ELP2000)       |
+ * | barycentric  | heliocentric + Sun's barycentric position   |
+ * | geocentric   | heliocentric − Earth's heliocentric position |
+ *
+ * The snapshot then feeds one-pass apparent horizontal queries for any
+ * observer:
+ *
+ * @code
+ * const auto sky = ephemeris::snapshot(jd);
+ * const auto altaz = horizontal_at(ephemeris::Snapshot::bodies(), site, sky);
+ * @endcode
+ */
+
+#include "body_target.hpp"
+#include "detail/aberration.hpp"
+#include "coordinates.hpp"
+#include "ephemeris.hpp"
+#include "ffi_core.hpp"
+#include "runtime_ephemeris.hpp"
+#include "span.hpp"
+#include "subject.hpp"
+#include "time.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace siderust {
+
+namespace ephemeris {
+
+/**
+ * @brief Positions and (optionally) velocities of one body in a `Snapshot`.
+ *
+ * All vectors are geometric (no light-time or aberration), in the mean
+ * ecliptic and equinox of J2000 and in AU; velocities are in AU/day and
+ * stay zero unless the snapshot was built with velocities.
+ */
+struct BodyState {
+  cartesian::position::EclipticMeanJ2000<qtty::AstronomicalUnit> heliocentric;
+  cartesian::position::HelioBarycentric<qtty::AstronomicalUnit> barycentric;
+  cartesian::Position<centers::Geocentric, frames::EclipticMeanJ2000, qtty::AstronomicalUnit>
+      geocentric;
+  CartesianVelocity heliocentric_velocity{0.0, 0.0, 0.0, SIDERUST_FRAME_T_ECLIPTIC_MEAN_J2000};
+  CartesianVelocity barycentric_velocity{0.0, 0.0, 0.0, SIDERUST_FRAME_T_ECLIPTIC_MEAN_J2000};
+  CartesianVelocity geocentric_velocity{0.0, 0.0, 0.0, SIDERUST_FRAME_T_ECLIPTIC_MEAN_J2000};
+};
+
+class Snapshot;
+
+Snapshot snapshot(const Time<TT, JD> &jd, bool with_velocities = false);
+
+/**
+ * @brief Every `Body` (plus the Earth) at one epoch; built by `snapshot()`.
+ */
+class Snapshot {
+public:
+  static constexpr std::size_t kBodyCount = 9;
+
+  /// The bodies of a snapshot, in `states()` order.
+  static span<const Body> bodies() {
+    static constexpr Body order[kBodyCount] = {Body::Sun,     Body::Moon,   Body::Mercury,
+                                               Body::Venus,   Body::Mars,   Body::Jupiter,
+                                               Body::Saturn,  Body::Uranus, Body::Neptune};
+    return span<const Body>(order, kBodyCount);
+  }
+
+  const Time<TT, JD> &epoch() const { return jd_; }
+  bool has_velocities() const { return with_velocities_; }
+
+  const BodyState &operator[](Body b) const { return states_[index(b)]; }
+  const BodyState &earth() const { return earth_; }
+
+  /// States of `bodies()`, in the same order.
+  span<const BodyState> states() const { return span<const BodyState>(states_.data(), kBodyCount); }
+
+  /// Geocentric direction of `b` in ICRS (geometric, no light-time).
+  spherical::direction::ICRS icrs_direction(Body b) const {
+    const auto p = to_icrs_.apply((*this)[b].geocentric);
+    const double x = p.comp_x.value();
+    const double y = p.comp_y.value();
+    const double z = p.comp_z.value();
+    constexpr double RAD2DEG = 180.0 / constants::pi;
+    double ra = std::atan2(y, x) * RAD2DEG;
+    if (ra < 0.0)
+      ra += 360.0;
+    return spherical::direction::ICRS(qtty::Degree(ra),
+                                      qtty::Degree(std::atan2(z, std::hypot(x, y)) * RAD2DEG));
+  }
+
+  /// The mean-ecliptic-J2000 → ICRS rotation used by `icrs_direction`.
+  const FrameRotation<frames::EclipticMeanJ2000, frames::ICRS> &to_icrs() const {
+    return to_icrs_;
+  }
+
+  /// Index of `b` in `bodies()` / `states()`.
+  static std::size_t index(Body b) {
+    switch (b) {
+    case Body::Sun:
+      return 0;
+    case Body::Moon:
+      return 1;
+    case Body::Mercury:
+      return 2;
+    case Body::Venus:
+      return 3;
+    case Body::Mars:
+      return 4;
+    case Body::Jupiter:
+      return 5;
+    case Body::Saturn:
+      return 6;
+    case Body::Uranus:
+      return 7;
+    case Body::Neptune:
+      return 8;
+    }
+    throw InvalidArgumentError("ephemeris::Snapshot: unknown body");
+  }
+
+private:
+  friend Snapshot snapshot(const Time<TT, JD> &jd, bool with_velocities);
+
+  Snapshot(const Time<TT, JD> &jd, bool with_velocities)
+      : jd_(jd), with_velocities_(with_velocities),
+        to_icrs_(FrameRotation<frames::EclipticMeanJ2000, frames::ICRS>::at(jd)) {}
+
+  Time<TT, JD> jd_;
+  bool with_velocities_;
+  std::array<BodyState, kBodyCount> states_{};
+  BodyState earth_{};
+  FrameRotation<frames::EclipticMeanJ2000, frames::ICRS> to_icrs_;
+};
+
+namespace detail {
+
+/// Heliocentric vectors [AU] of `Snapshot::bodies()` plus the Earth, and
+/// the Sun's barycentric vector, from one evaluation of each series.
+struct SnapshotVectors {
+  double helio[Snapshot::kBodyCount][3] = {};
+  double earth[3] = {};
+  double sun_bary[3] = {};
+};
+
+template <typename Pos> inline void store_au(const Pos &p, double (&out)[3]) {
+  out[0] = p.comp_x.template to<qtty::AstronomicalUnit>().value();
+  out[1] = p.comp_y.template to<qtty::AstronomicalUnit>().value();
+  out[2] = p.comp_z.template to<qtty::AstronomicalUnit>().value();
+}
+
+inline SnapshotVectors snapshot_vectors(const Time<TT, JD> &jd) {
+  SnapshotVectors v;
+  store_au(sun_barycentric(jd), v.sun_bary);
+  store_au(earth_heliocentric(jd), v.earth);
+  // helio[0] (Sun) stays at the origin.
+  store_au(moon_geocentric(jd), v.helio[1]);
+  for (std::size_t k = 0; k < 3; ++k)
+    v.helio[1][k] += v.earth[k];
+  store_au(mercury_heliocentric(jd), v.helio[2]);
+  store_au(venus_heliocentric(jd), v.helio[3]);
+  store_au(mars_heliocentric(jd), v.helio[4]);
+  store_au(jupiter_heliocentric(jd), v.helio[5]);
+  store_au(saturn_heliocentric(jd), v.helio[6]);
+  store_au(uranus_heliocentric(jd), v.helio[7]);
+  store_au(neptune_heliocentric(jd), v.helio[8]);
+  return v;
+}
+
+inline CartesianVelocity ecliptic_velocity(const double (&v)[3]) {
+  return {v[0], v[1], v[2], SIDERUST_FRAME_T_ECLIPTIC_MEAN_J2000};
+}
+
+/// Fill `s` from heliocentric `h`, Earth `e` and Sun-barycentric `b`.
+inline void fill_positions(BodyState &s, const double (&h)[3], const double (&e)[3],
+                           const double (&b)[3]) {
+  s.heliocentric = {h[0], h[1], h[2]};
+  s.barycentric = {h[0] + b[0], h[1] + b[1], h[2] + b[2]};
+  s.geocentric = {h[0] - e[0], h[1] - e[1], h[2] - e[2]};
+}
+
+/// Fill the velocities of `s` from the same vectors differentiated in time.
+inline void fill_velocities(BodyState &s, const double (&h)[3], const double (&e)[3],
+                            const double (&b)[3]) {
+  const double bary[3] = {h[0] + b[0], h[1] + b[1], h[2] + b[2]};
+  const double geo[3] = {h[0] - e[0], h[1] - e[1], h[2] - e[2]};
+  s.heliocentric_velocity = ecliptic_velocity(h);
+  s.barycentric_velocity = ecliptic_velocity(bary);
+  s.geocentric_velocity = ecliptic_velocity(geo);
+}
+
+} // namespace detail
+
+/**
+ * @brief Evaluate every body at `jd` in one pass.
+ *
+ * Costs ten VSOP87/ELP2000 evaluations (one per series) plus one sampled
+ * frame rotation, instead of two or three evaluations per body. With
+ * `with_velocities`, velocities come from a central difference over
+ * ±0.01 day (relative error ≲1e-6 even for the Moon), tripling the series
+ * evaluations.
+ *
+ * Barycentric and geocentric positions are sums of the heliocentric series
+ * and agree with the dedicated `*_barycentric` functions to the truncation
+ * level of VSOP87.
+ */
+inline Snapshot snapshot(const Time<TT, JD> &jd, bool with_velocities) {
+  Snapshot snap(jd, with_velocities);
+  const detail::SnapshotVectors v = detail::snapshot_vectors(jd);
+  for (std::size_t i = 0; i < Snapshot::kBodyCount; ++i)
+    detail::fill_positions(snap.states_[i], v.helio[i], v.earth, v.sun_bary);
+  detail::fill_positions(snap.earth_, v.earth, v.earth, v.sun_bary);
+
+  if (with_velocities) {
+    constexpr double h = 0.01; // days
+    const detail::SnapshotVectors lo = detail::snapshot_vectors(Time<TT, JD>(jd.value() - h));
+    const detail::SnapshotVectors hi = detail::snapshot_vectors(Time<TT, JD>(jd.value() + h));
+    const auto rate = [&](const double (&a)[3], const double (&b)[3], double (&out)[3]) {
+      for (std::size_t k = 0; k < 3; ++k)
+        out[k] = (b[k] - a[k]) / (2.0 * h);
+    };
+    double de[3], db[3];
+    rate(lo.earth, hi.earth, de);
+    rate(lo.sun_bary, hi.sun_bary, db);
+    for (std::size_t i = 0; i < Snapshot::kBodyCount; ++i) {
+      double dh[3];
+      rate(lo.helio[i], hi.helio[i], dh);
+      detail::fill_velocities(snap.states_[i], dh, de, db);
+    }
+    detail::fill_velocities(snap.earth_, de, de, db);
+  }
+  return snap;
+}
+
+} // namespace ephemeris
+
+// ============================================================================
+// Horizontal queries from a snapshot
+// ============================================================================
+
+namespace detail {
+
+/**
+ * @brief The observer's geocentric position in its own (north, east, up)
+ *        frame, in AU. The east component is zero.
+ *
+ * Subtracting it from a geocentric vector rotated into the horizontal frame
+ * gives the topocentric vector (diurnal parallax).
+ */
+inline void site_offset_au(const Geodetic &obs, double &north, double &up) {
+  double ox, oy, oz;
+  detail::wgs84::forward(obs.lon.value(), obs.lat.value(), obs.height.value(), ox, oy, oz);
+  const double lon = obs.lon.value() * (constants::pi / 180.0);
+  const double lat = obs.lat.value() * (constants::pi / 180.0);
+  const double m_to_au = qtty::Meter(1.0).to<qtty::AstronomicalUnit>().value();
+  const double sl = std::sin(lat), cl = std::cos(lat), so = std::sin(lon), co = std::cos(lon);
+  north = (-sl * co * ox - sl * so * oy + cl * oz) * m_to_au;
+  up = (cl * co * ox + cl * so * oy + sl * oz) * m_to_au;
+}
+
+} // namespace detail
+
+/**
+ * @brief Altitude and azimuth of `bodies[i]` as seen from `obs` at the
+ *        snapshot's epoch, written to `out[i]`.
+ *
+ * One `HorizontalProjector<frames::ICRS>` rotation is sampled for the whole
+ * list and every body is projected from its snapshot position, turned into
+ * an apparent place — one light-time step along the body's heliocentric
+ * velocity, then annual aberration from the Earth's barycentric velocity —
+ * and corrected for the observer's offset from the geocentre (diurnal
+ * parallax, up to ≈1° for the Moon). No refraction is applied. Results
+ * match `BodyTarget::altitude_at` / `azimuth_at` to about 1″ (the neglected
+ * gravitational deflection stays at the mas level away from the Sun).
+ *
+ * The velocities come from the snapshot when it was built with them;
+ * otherwise one more pass of the series at `epoch − 0.01 d` supplies them by
+ * a backward difference.
+ *
+ * @throws InvalidDimensionError if `out.size() != bodies.size()`.
+ */
+inline void horizontal_at(span<const Body> bodies, const Geodetic &obs,
+                          const ephemeris::Snapshot &snap,
+                          span<spherical::Direction<frames::Horizontal>> out) {
+  constexpr const char *op = "horizontal_at(Snapshot)";
+  detail::check_batch_size(bodies.size(), out.size(), op);
+  if (bodies.empty())
+    return;
+
+  const auto m = HorizontalProjector<frames::ICRS>(obs, snap.epoch()).rotation().matrix();
+  double site_n, site_u;
+  detail::site_offset_au(obs, site_n, site_u);
+
+  // Earth's barycentric velocity and the bodies' heliocentric velocities.
+  double earth_v[3];
+  std::array<double, 3> body_v[ephemeris::Snapshot::kBodyCount];
+  if (snap.has_velocities()) {
+    const auto &ev = snap.earth().barycentric_velocity;
+    earth_v[0] = ev.vx, earth_v[1] = ev.vy, earth_v[2] = ev.vz;
+    for (std::size_t j = 0; j < ephemeris::Snapshot::kBodyCount; ++j) {
+      const auto &bv = snap.states()[j].heliocentric_velocity;
+      body_v[j] = {bv.vx, bv.vy, bv.vz};
+    }
+  } else {
+    constexpr double h = 0.01; // days
+    const auto prev =
+        ephemeris::detail::snapshot_vectors(Time<TT, JD>(snap.epoch().value() - h));
+    double now[3];
+    ephemeris::detail::store_au(snap.earth().barycentric, now);
+    for (std::size_t k = 0; k < 3; ++k)
+      earth_v[k] = (now[k] - prev.earth[k] - prev.sun_bary[k]) / h;
+    for (std::size_t j = 0; j < ephemeris::Snapshot::kBodyCount; ++j) {
+      ephemeris::detail::store_au(snap.states()[j].heliocentric, now);
+      for (std::size_t k = 0; k < 3; ++k)
+        body_v[j][k] = (now[k] - prev.helio[j][k]) / h;
+    }
+  }
+
+  for (std::size_t i = 0; i < bodies.size(); ++i) {
+    const std::size_t j = ephemeris::Snapshot::index(bodies[i]);
+    double g[3];
+    ephemeris::detail::store_au(snap.states()[j].geocentric, g);
+    const double tau = detail::light_time(g);
+    for (std::size_t k = 0; k < 3; ++k)
+      g[k] -= tau * body_v[j][k];
+    detail::aberrate(g, earth_v, g);
+    const auto p = snap.to_icrs().apply(
+        cartesian::Position<centers::Geocentric, frames::EclipticMeanJ2000,
+                            qtty::AstronomicalUnit>(g[0], g[1], g[2]));
+    const double x = p.comp_x.value(), y = p.comp_y.value(), z = p.comp_z.value();
+    const double n = m[0][0] * x + m[0][1] * y + m[0][2] * z;
+    const double e = m[1][0] * x + m[1][1] * y + m[1][2] * z;
+    const double u = m[2][0] * x + m[2][1] * y + m[2][2] * z;
+    out[i] = detail::horizontal_direction(n - site_n, e, u - site_u);
+  }
+}
+
+/// Allocating overload of `horizontal_at(bodies, obs, snapshot, out)`.
+inline std::vector<spherical::Direction<frames::Horizontal>>
+horizontal_at(span<const Body> bodies, const Geodetic &obs, const ephemeris::Snapshot &snap) {
+  std::vector<spherical::Direction<frames::Horizontal>> out(bodies.size());
+  horizontal_at(bodies, obs, snap, span<spherical::Direction<frames::Horizontal>>(out));
+  return out;
+}
+
+/// `BodyTarget` overload of `horizontal_at(bodies, obs, snapshot, out)`.
+inline void horizontal_at(span<const BodyTarget> targets, const Geodetic &obs,
+                          const ephemeris::Snapshot &snap,
+                          span<spherical::Direction<frames::Horizontal>> out) {
+  detail::check_batch_size(targets.size(), out.size(), "horizontal_at(Snapshot)");
+  std::vector<Body> bodies;
+  bodies.reserve(targets.size());
+  for (const auto &t : targets)
+    bodies.push_back(t.body());
+  horizontal_at(span<const Body>(bodies), obs, snap, out);
+}
+
+} // namespace siderust
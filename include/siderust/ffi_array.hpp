@@ -0,0 +1,229 @@
+#pragma once
+
+/**
+ * @file ffi_array.hpp
+ * @brief Owning, zero-copy view over an array allocated by siderust-ffi.
+ *
+ * Search, grid and parser entry points in siderust-ffi return a
+ * library-allocated `CItem *` plus a count that must be released with the
+ * matching `siderust_*_free`. `FfiArray<T, CItem>` adopts such a buffer,
+ * frees it on destruction and exposes it as a random-access range of `T`,
+ * converting each element with `T::from_c` on access instead of copying the
+ * whole array into a `std::vector` up front.
+ *
+ * @code
+ * tempoch_period_mjd_t *ptr = nullptr;
+ * uintptr_t count = 0;
+ * siderust::check_status(siderust_above_threshold(..., &ptr, &count), "op");
+ * siderust::PeriodList periods(ptr, count);
+ * for (const auto p : periods) { ... }
+ * @endcode
+ */
+
+#include "ffi_core.hpp"
+#include "span.hpp"
+#include "time.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace siderust {
+
+namespace detail {
+
+/**
+ * @brief Releases an FFI-allocated array of `CItem` with its matching
+ *        `siderust_*_free`.
+ */
+template <typename CItem> struct FfiFree;
+
+template <> struct FfiFree<tempoch_period_mjd_t> {
+  static void release(tempoch_period_mjd_t *ptr, uintptr_t count) {
+    siderust_periods_free(ptr, count);
+  }
+};
+
+template <> struct FfiFree<siderust_crossing_event_t> {
+  static void release(siderust_crossing_event_t *ptr, uintptr_t count) {
+    siderust_crossings_free(ptr, count);
+  }
+};
+
+template <> struct FfiFree<siderust_culmination_event_t> {
+  static void release(siderust_culmination_event_t *ptr, uintptr_t count) {
+    siderust_culminations_free(ptr, count);
+  }
+};
+
+template <> struct FfiFree<siderust_azimuth_crossing_event_t> {
+  static void release(siderust_azimuth_crossing_event_t *ptr, uintptr_t count) {
+    siderust_azimuth_crossings_free(ptr, count);
+  }
+};
+
+template <> struct FfiFree<siderust_azimuth_extremum_t> {
+  static void release(siderust_azimuth_extremum_t *ptr, uintptr_t count) {
+    siderust_azimuth_extrema_free(ptr, count);
+  }
+};
+
+template <> struct FfiFree<siderust_phase_event_t> {
+  static void release(siderust_phase_event_t *ptr, uintptr_t count) {
+    siderust_phase_events_free(ptr, count);
+  }
+};
+
+template <> struct FfiFree<SiderustSkyGridCell> {
+  static void release(SiderustSkyGridCell *ptr, uintptr_t count) {
+    siderust_sky_grid_cells_free(ptr, count);
+  }
+};
+
+template <> struct FfiFree<SiderustOemState> {
+  static void release(SiderustOemState *ptr, uintptr_t count) {
+    siderust_oem_states_free(ptr, static_cast<unsigned long>(count));
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief Move-only owner of a siderust-ffi result array.
+ *
+ * @tparam T      C++ element type; must provide `static T from_c(const CItem &)`.
+ * @tparam CItem  C element type returned by the FFI.
+ *
+ * Elements are yielded by value: `operator[]` and iterator dereference run
+ * `T::from_c` on the underlying C struct, which for every result type in this
+ * library is a handful of field reads. Use @ref raw for direct access to the
+ * C array and @ref to_vector when an owning C++ copy is needed.
+ */
+template <typename T, typename CItem> class FfiArray {
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /// Random-access iterator yielding converted elements by value.
+  class const_iterator {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = T;
+
+    const_iterator() noexcept = default;
+    explicit const_iterator(const CItem *p) noexcept : p_(p) {}
+
+    T operator*() const { return T::from_c(*p_); }
+    T operator[](difference_type n) const { return T::from_c(p_[n]); }
+
+    const_iterator &operator++() noexcept {
+      ++p_;
+      return *this;
+    }
+    const_iterator operator++(int) noexcept { return const_iterator(p_++); }
+    const_iterator &operator--() noexcept {
+      --p_;
+      return *this;
+    }
+    const_iterator operator--(int) noexcept { return const_iterator(p_--); }
+    const_iterator &operator+=(difference_type n) noexcept {
+      p_ += n;
+      return *this;
+    }
+    const_iterator &operator-=(difference_type n) noexcept {
+      p_ -= n;
+      return *this;
+    }
+
+    friend const_iterator operator+(const_iterator it, difference_type n) noexcept {
+      return it += n;
+    }
+    friend const_iterator operator+(difference_type n, const_iterator it) noexcept {
+      return it += n;
+    }
+    friend const_iterator operator-(const_iterator it, difference_type n) noexcept {
+      return it -= n;
+    }
+    friend difference_type operator-(const_iterator a, const_iterator b) noexcept {
+      return a.p_ - b.p_;
+    }
+
+    friend bool operator==(const_iterator a, const_iterator b) noexcept { return a.p_ == b.p_; }
+    friend bool operator!=(const_iterator a, const_iterator b) noexcept { return a.p_ != b.p_; }
+    friend bool operator<(const_iterator a, const_iterator b) noexcept { return a.p_ < b.p_; }
+    friend bool operator>(const_iterator a, const_iterator b) noexcept { return a.p_ > b.p_; }
+    friend bool operator<=(const_iterator a, const_iterator b) noexcept { return a.p_ <= b.p_; }
+    friend bool operator>=(const_iterator a, const_iterator b) noexcept { return a.p_ >= b.p_; }
+
+  private:
+    const CItem *p_ = nullptr;
+  };
+  using iterator = const_iterator;
+
+  FfiArray() noexcept = default;
+
+  /// Adopt `count` elements at `ptr`, as returned by an FFI out-parameter pair.
+  FfiArray(CItem *ptr, uintptr_t count) noexcept : ptr_(ptr), count_(count) {}
+
+  ~FfiArray() { reset(); }
+
+  FfiArray(const FfiArray &) = delete;
+  FfiArray &operator=(const FfiArray &) = delete;
+
+  FfiArray(FfiArray &&other) noexcept
+      : ptr_(std::exchange(other.ptr_, nullptr)), count_(std::exchange(other.count_, 0)) {}
+
+  FfiArray &operator=(FfiArray &&other) noexcept {
+    if (this != &other) {
+      reset();
+      ptr_ = std::exchange(other.ptr_, nullptr);
+      count_ = std::exchange(other.count_, 0);
+    }
+    return *this;
+  }
+
+  /// Free the owned array (if any) and become empty.
+  void reset() noexcept {
+    if (ptr_ != nullptr) {
+      detail::FfiFree<CItem>::release(ptr_, count_);
+    }
+    ptr_ = nullptr;
+    count_ = 0;
+  }
+
+  std::size_t size() const noexcept { return static_cast<std::size_t>(count_); }
+  bool empty() const noexcept { return count_ == 0; }
+
+  T operator[](std::size_t i) const { return T::from_c(ptr_[i]); }
+  T front() const { return T::from_c(ptr_[0]); }
+  T back() const { return T::from_c(ptr_[count_ - 1]); }
+
+  const_iterator begin() const noexcept { return const_iterator(ptr_); }
+  const_iterator end() const noexcept { return const_iterator(ptr_ + count_); }
+
+  /// The underlying C array, still owned by this object.
+  span<const CItem> raw() const noexcept { return span<const CItem>(ptr_, size()); }
+
+  /// Convert every element into an owning `std::vector<T>`.
+  std::vector<T> to_vector() const {
+    std::vector<T> out;
+    out.reserve(size());
+    for (uintptr_t i = 0; i < count_; ++i) {
+      out.push_back(T::from_c(ptr_[i]));
+    }
+    return out;
+  }
+
+private:
+  CItem *ptr_ = nullptr;
+  uintptr_t count_ = 0;
+};
+
+/// Periods returned by an FFI search, freed with `siderust_periods_free`.
+using PeriodList = FfiArray<Period<TT, MJD>, tempoch_period_mjd_t>;
+
+} // namespace siderust
@@ -254,6 +254,24 @@ enum class RaConvention : int32_t {
 
 namespace detail {
 
+/// Throws `InvalidDimensionError` unless a batch output has one slot per input.
+inline void check_batch_size(std::size_t inputs, std::size_t outputs, const char *operation) {
+  if (inputs != outputs) {
+    throw InvalidDimensionError(std::string(operation) + ": output size " +
+                                std::to_string(outputs) + " does not match input size " +
+                                std::to_string(inputs));
+  }
+}
+
+/// Throws `InvalidDimensionError` unless a batch has one epoch in total or one
+/// epoch per input.
+inline void check_epoch_count(std::size_t inputs, std::size_t epochs, const char *operation) {
+  if (epochs != 1 && epochs != inputs) {
+    throw InvalidDimensionError(std::string(operation) + ": " + std::to_string(epochs) +
+                                " epochs for " + std::to_string(inputs) + " inputs");
+  }
+}
+
 /// Build a `siderust_subject_t` for a solar-system body.
 inline siderust_subject_t make_body_subject(SiderustBody b) {
   siderust_subject_t s{};
@@ -250,6 +250,94 @@ SIDERUST_FRAME_TRANSFORM_PAIR(ICRF, ICRS);
 template <typename From, typename To>
 inline constexpr bool has_frame_transform_v = has_frame_transform<From, To>::value;
 
+// ============================================================================
+// Compile-Time Frame Paths
+// ============================================================================
+
+/**
+ * @brief Marks frame pairs related by a fixed, epoch-independent rotation
+ *        evaluated in C++ (`FixedRotation` in `coordinates/frame_rotation.hpp`).
+ */
+template <typename From, typename To> struct has_fixed_rotation : std::false_type {};
+
+#define SIDERUST_FIXED_ROTATION_PAIR(A, B)                                                         \
+  template <> struct has_fixed_rotation<A, B> : std::true_type {};                                 \
+  template <> struct has_fixed_rotation<B, A> : std::true_type {}
+
+SIDERUST_FIXED_ROTATION_PAIR(ICRS, Galactic);
+SIDERUST_FIXED_ROTATION_PAIR(ICRS, ICRF);
+
+#undef SIDERUST_FIXED_ROTATION_PAIR
+
+template <typename From, typename To>
+inline constexpr bool has_fixed_rotation_v = has_fixed_rotation<From, To>::value;
+
+/**
+ * @brief Marks frame pairs related by an epoch-dependent rotation evaluated
+ *        in C++ (`DatedRotation` in `coordinates/frame_rotation.hpp`), for
+ *        frames siderust-ffi has no rotation for.
+ */
+template <typename From, typename To> struct has_dated_rotation : std::false_type {};
+
+template <> struct has_dated_rotation<EquatorialMeanOfDate, EclipticOfDate> : std::true_type {};
+template <> struct has_dated_rotation<EclipticOfDate, EquatorialMeanOfDate> : std::true_type {};
+
+template <typename From, typename To>
+inline constexpr bool has_dated_rotation_v = has_dated_rotation<From, To>::value;
+
+/**
+ * @brief The frame paths to and from `F` are routed through: `F` itself, or
+ *        the FFI frame a dated rotation attaches `F` to.
+ */
+template <typename F> struct frame_anchor {
+  using type = F;
+};
+template <> struct frame_anchor<EclipticOfDate> {
+  using type = EquatorialMeanOfDate;
+};
+
+template <typename F> using frame_anchor_t = typename frame_anchor<F>::type;
+
+/// A single hop the library can evaluate: an FFI rotation or a fixed one.
+template <typename From, typename To>
+inline constexpr bool has_frame_hop_v =
+    has_frame_transform_v<From, To> || has_fixed_rotation_v<From, To>;
+
+/// True when `To` is reachable from `From` in one hop or in two hops through
+/// the ICRS hub.
+template <typename From, typename To>
+inline constexpr bool has_hub_path_v =
+    has_frame_hop_v<From, To> || (has_frame_hop_v<From, ICRS> && has_frame_hop_v<ICRS, To>);
+
+/**
+ * @brief True when `To` is reachable from `From` through the ICRS hub,
+ *        entering and leaving it through each frame's anchor.
+ *
+ * Every siderust-ffi pair is already a single hop (the FFI routes through
+ * its own hub internally), so a resolved path holds at most one FFI rotation
+ * plus fixed rotations and a dated rotation at either end (e.g. Galactic →
+ * ICRS → EquatorialMeanOfDate → EclipticOfDate), and fuses into a single
+ * matrix per epoch.
+ */
+template <typename From, typename To>
+struct has_frame_path
+    : std::bool_constant<has_hub_path_v<frame_anchor_t<From>, frame_anchor_t<To>>> {};
+
+template <typename From, typename To>
+inline constexpr bool has_frame_path_v = has_frame_path<From, To>::value;
+
+/// True when every hop of the `From` → `To` path is a fixed rotation.
+template <typename From, typename To>
+inline constexpr bool is_fixed_path_v =
+    std::is_same_v<From, To> || has_fixed_rotation_v<From, To> ||
+    (!has_frame_transform_v<From, To> && has_fixed_rotation_v<From, ICRS> &&
+     has_fixed_rotation_v<ICRS, To>);
+
+/// True for pairs reachable only by composing hops in C++ (no direct FFI call).
+template <typename From, typename To>
+inline constexpr bool is_composite_path_v =
+    has_frame_path_v<From, To> && !has_frame_transform_v<From, To>;
+
 /**
  * @brief Marks frames from which to_horizontal is reachable.
  */
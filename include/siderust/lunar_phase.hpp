@@ -13,6 +13,7 @@
 
 #include "altitude.hpp"
 #include "coordinates.hpp"
+#include "ffi_array.hpp"
 #include "ffi_core.hpp"
 #include "time.hpp"
 #include <ostream>
@@ -85,27 +86,12 @@ struct PhaseEvent {
 namespace detail {
 
 inline std::vector<PhaseEvent> phase_events_from_c(siderust_phase_event_t *ptr, uintptr_t count) {
-  std::vector<PhaseEvent> result;
-  result.reserve(count);
-  for (uintptr_t i = 0; i < count; ++i) {
-    result.push_back(PhaseEvent::from_c(ptr[i]));
-  }
-  siderust_phase_events_free(ptr, count);
-  return result;
+  return FfiArray<PhaseEvent, siderust_phase_event_t>(ptr, count).to_vector();
 }
 
-/// Like periods_from_c but for tempoch_period_mjd_t* pointers (freed with
-/// siderust_periods_free).
 inline std::vector<Period<TT, MJD>> illum_periods_from_c(tempoch_period_mjd_t *ptr,
                                                          uintptr_t count) {
-  std::vector<Period<TT, MJD>> result;
-  result.reserve(count);
-  for (uintptr_t i = 0; i < count; ++i) {
-    result.push_back(
-        Period<TT, MJD>(Time<TT, MJD>(ptr[i].start_mjd), Time<TT, MJD>(ptr[i].end_mjd)));
-  }
-  siderust_periods_free(ptr, count);
-  return result;
+  return PeriodList(ptr, count).to_vector();
 }
 
 } // namespace detail
@@ -24,6 +24,7 @@
  * @endcode
  */
 
+#include "ffi_array.hpp"
 #include "ffi_core.hpp"
 
 #include <array>
@@ -37,62 +38,54 @@ namespace siderust {
 /// @{
 namespace oem {
 
-namespace detail {
-
-struct OemStatesGuard {
-  SiderustOemState *ptr = nullptr;
-  unsigned long count = 0;
-
-  ~OemStatesGuard() { siderust_oem_states_free(ptr, count); }
-
-  OemStatesGuard() = default;
-  OemStatesGuard(const OemStatesGuard &) = delete;
-  OemStatesGuard &operator=(const OemStatesGuard &) = delete;
-  OemStatesGuard(OemStatesGuard &&) = delete;
-  OemStatesGuard &operator=(OemStatesGuard &&) = delete;
-};
-
-} // namespace detail
-
 /// A single spacecraft state vector from a CCSDS OEM file.
 struct StateVector {
   double epoch_jd;               ///< Epoch as Julian Date.
   std::array<double, 3> pos_km;  ///< Position [x, y, z] in km.
   std::array<double, 3> vel_kms; ///< Velocity [vx, vy, vz] in km/s.
+
+  static StateVector from_c(const SiderustOemState &s) {
+    return {s.epoch_jd,
+            {s.pos_km[0], s.pos_km[1], s.pos_km[2]},
+            {s.vel_kms[0], s.vel_kms[1], s.vel_kms[2]}};
+  }
 };
 
+/// State vectors owned in their FFI-allocated buffer.
+using StateVectorList = FfiArray<StateVector, SiderustOemState>;
+
 /**
- * @brief Parse a CCSDS OEM (KVN) document from a string.
- *
- * All state vectors from all OEM segments are returned in a flat vector,
- * in the order they appear in the document.
+ * @brief Parse a CCSDS OEM (KVN) document, leaving the states in the
+ *        FFI-allocated buffer.
  *
- * @param text  OEM document text (null termination added internally).
- * @return std::vector<StateVector>  Parsed state vectors (may be empty).
+ * Same as @ref parse but without copying into a `std::vector`; elements are
+ * converted to `StateVector` on access.
  *
  * @throws siderust::InvalidArgumentError  if the OEM document is malformed.
  */
-inline std::vector<StateVector> parse(std::string_view text) {
+inline StateVectorList parse_view(std::string_view text) {
   const std::string buf{text};
   SiderustOemState *raw_ptr = nullptr;
   unsigned long count = 0;
 
   check_status(siderust_oem_parse_str(buf.c_str(), &raw_ptr, &count), "oem::parse");
 
-  detail::OemStatesGuard guard{};
-  guard.ptr = raw_ptr;
-  guard.count = count;
-
-  std::vector<StateVector> result;
-  result.reserve(static_cast<std::size_t>(count));
-  for (unsigned long i = 0; i < count; ++i) {
-    const auto &s = raw_ptr[i];
-    result.push_back({s.epoch_jd,
-                      {s.pos_km[0], s.pos_km[1], s.pos_km[2]},
-                      {s.vel_kms[0], s.vel_kms[1], s.vel_kms[2]}});
-  }
+  return StateVectorList(raw_ptr, static_cast<uintptr_t>(count));
+}
 
-  return result;
+/**
+ * @brief Parse a CCSDS OEM (KVN) document from a string.
+ *
+ * All state vectors from all OEM segments are returned in a flat vector,
+ * in the order they appear in the document.
+ *
+ * @param text  OEM document text (null termination added internally).
+ * @return std::vector<StateVector>  Parsed state vectors (may be empty).
+ *
+ * @throws siderust::InvalidArgumentError  if the OEM document is malformed.
+ */
+inline std::vector<StateVector> parse(std::string_view text) {
+  return parse_view(text).to_vector();
 }
 
 } // namespace oem
@@ -6,23 +6,48 @@
  *
  * Provides an RAII `RuntimeEphemeris` class that loads a BSP file at runtime
  * and exposes the same position queries as the compile-time VSOP87 wrappers
- * in `ephemeris.hpp`.
+ * in `ephemeris.hpp`, plus `state(target, center, jd)` for any pair of NAIF
+ * bodies when the kernel is read by the header-only SPK reader.
  *
  * @code
  * #include <siderust/runtime_ephemeris.hpp>
  *
  * siderust::RuntimeEphemeris eph("/path/to/de440.bsp");
  * auto sun = eph.sun_barycentric(jd);
+ *
+ * // Large kernels: map the file instead of reading it into memory.
+ * siderust::RuntimeEphemeris de441(
+ *     "/path/to/de441.bsp",
+ *     siderust::RuntimeEphemerisOptions().with_mode(siderust::EphemerisLoadMode::Mapped));
+ *
+ * // Keep only 1990–2050 for the Earth and Moon, in at most 64 MiB.
+ * using namespace siderust;
+ * RuntimeEphemeris small("/path/to/de441.bsp",
+ *                        RuntimeEphemerisOptions()
+ *                            .with_period({Time<TT, JD>(2447892.5), Time<TT, JD>(2469807.5)})
+ *                            .with_bodies({spk::naif::Earth, spk::naif::Moon})
+ *                            .with_memory_budget(64u << 20));
+ *
+ * // Any body by NAIF id, here Mars relative to the Moon.
+ * auto mars = de441.state(spk::naif::Mars, spk::naif::Moon, jd);
  * @endcode
  */
 
 #include "coordinates.hpp"
+#include "detail/parallel.hpp"
 #include "ffi_core.hpp"
+#include "span.hpp"
+#include "spk.hpp"
 #include "time.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace siderust {
 
@@ -43,22 +68,217 @@ struct CartesianVelocity {
   }
 };
 
+/**
+ * @brief Position and velocity of one body relative to another, returned by
+ *        `RuntimeEphemeris::state`.
+ */
+struct EphemerisState {
+  /// Target minus center (EclipticMeanJ2000, AU).
+  cartesian::Displacement<frames::EclipticMeanJ2000, qtty::AstronomicalUnit> position;
+  /// Its time derivative (EclipticMeanJ2000, AU/day).
+  CartesianVelocity velocity{0.0, 0.0, 0.0, SIDERUST_FRAME_T_ECLIPTIC_MEAN_J2000};
+};
+
+/// How `RuntimeEphemeris` brings a BSP kernel into memory.
+enum class EphemerisLoadMode {
+  /// Read and parse the whole kernel inside siderust-ffi (default).
+  Copy,
+  /// Map the file read-only and evaluate it with the header-only
+  /// `spk::Kernel` reader: only the segment summaries are parsed at open
+  /// time and coefficient records are paged in from the OS page cache on
+  /// first use, shared by every process mapping the same file.
+  Mapped,
+};
+
+/**
+ * @brief Load options for `RuntimeEphemeris(path, options)`.
+ *
+ * A period, a body subset or a memory budget is applied by the header-only
+ * SPK reader, which retains only what they select: with `Copy` the
+ * retained records are copied into memory and the file is released, with
+ * `Mapped` the rest of the file is simply never touched. A non-zero
+ * `memory_budget` replaces both by an LRU of records that never holds more
+ * than that many bytes.
+ */
+struct RuntimeEphemerisOptions {
+  EphemerisLoadMode mode = EphemerisLoadMode::Copy;
+  /// Retained span; queries outside it throw `OutOfRangeError`.
+  std::optional<Period<TT, JD>> period;
+  /// NAIF ids to retain (see `spk::naif`); the centers they are chained
+  /// through are kept too. Empty keeps every body. Geocentric queries need
+  /// both the body and `spk::naif::Earth`.
+  std::vector<std::int32_t> bodies;
+  /// Cap on coefficient-record memory in bytes; 0 means unbounded.
+  std::size_t memory_budget = 0;
+
+  RuntimeEphemerisOptions() = default;
+
+  RuntimeEphemerisOptions &with_mode(EphemerisLoadMode m) {
+    mode = m;
+    return *this;
+  }
+  RuntimeEphemerisOptions &with_period(const Period<TT, JD> &p) {
+    period = p;
+    return *this;
+  }
+  RuntimeEphemerisOptions &with_bodies(std::vector<std::int32_t> naif_ids) {
+    bodies = std::move(naif_ids);
+    return *this;
+  }
+  RuntimeEphemerisOptions &with_memory_budget(std::size_t bytes) {
+    memory_budget = bytes;
+    return *this;
+  }
+
+  /// True when the options need the SPK reader rather than siderust-ffi.
+  bool uses_spk_reader() const {
+    return mode == EphemerisLoadMode::Mapped || period.has_value() || !bodies.empty() ||
+           memory_budget != 0;
+  }
+
+  /// Equivalent `spk::LoadOptions`.
+  spk::LoadOptions spk_options() const {
+    spk::LoadOptions out;
+    if (period) {
+      out.with_span(spk::et_from_jd_tt(period->start().value()),
+                    spk::et_from_jd_tt(period->end().value()));
+    }
+    return out.with_targets(bodies)
+        .with_resident(mode == EphemerisLoadMode::Copy)
+        .with_cache_bytes(memory_budget);
+  }
+};
+
+namespace detail {
+
+/// C++ evaluation path of `RuntimeEphemeris` when it is backed by
+/// `spk::Kernel`: SPK states (km, J2000 or ECLIPJ2000) chained through the
+/// Earth–Moon barycenter and rotated to the mean ecliptic of J2000.
+class SpkEphemeris {
+public:
+  SpkEphemeris(const std::string &path, const spk::LoadOptions &opts)
+      : kernel_(path, opts),
+        to_ecliptic_(
+            FrameRotation<frames::ICRS, frames::EclipticMeanJ2000>::at(Time<TT, JD>::J2000())) {}
+
+  SpkEphemeris(const std::uint8_t *data, std::size_t len, const spk::LoadOptions &opts)
+      : kernel_(data, len, opts),
+        to_ecliptic_(
+            FrameRotation<frames::ICRS, frames::EclipticMeanJ2000>::at(Time<TT, JD>::J2000())) {}
+
+  const spk::Kernel &kernel() const { return kernel_; }
+
+  /// Barycentric state of the Sun [km, km/s, EclipticMeanJ2000].
+  spk::State sun(double et) const {
+    return state(spk::naif::Sun, spk::naif::SolarSystemBarycenter, et);
+  }
+
+  /// Barycentric state of the Earth [km, km/s, EclipticMeanJ2000].
+  spk::State earth(double et) const {
+    return state(spk::naif::Earth, spk::naif::SolarSystemBarycenter, et);
+  }
+
+  /// Heliocentric state of the Earth [km, km/s, EclipticMeanJ2000].
+  spk::State earth_heliocentric(double et) const {
+    return state(spk::naif::Earth, spk::naif::Sun, et);
+  }
+
+  /// Geocentric state of the Moon [km, km/s, EclipticMeanJ2000].
+  spk::State moon(double et) const { return state(spk::naif::Moon, spk::naif::Earth, et); }
+
+  /// State of `target` relative to `center` [km, km/s, EclipticMeanJ2000].
+  spk::State state(std::int32_t target, std::int32_t center, double et) const {
+    const spk::Chain chain = kernel_.chain(target, center);
+    return to_ecliptic(chain.frame(), kernel_.state(chain, et));
+  }
+
+  /// Rotate a vector in NAIF frame `frame` to EclipticMeanJ2000.
+  /// @throws InvalidArgumentError for frames other than J2000 / ECLIPJ2000.
+  void to_ecliptic(std::int32_t frame, const double (&v)[3], double (&out)[3]) const {
+    if (frame == spk::frame::J2000) {
+      to_ecliptic_.apply_xyz(v, out, 1);
+    } else if (frame == spk::frame::EclipJ2000) {
+      std::copy(v, v + 3, out);
+    } else {
+      throw InvalidArgumentError("RuntimeEphemeris: unsupported SPK frame " +
+                                 std::to_string(frame));
+    }
+  }
+
+  /// Rotate both vectors of a state in NAIF frame `frame` to EclipticMeanJ2000.
+  spk::State to_ecliptic(std::int32_t frame, const spk::State &s) const {
+    spk::State out;
+    to_ecliptic(frame, s.position, out.position);
+    to_ecliptic(frame, s.velocity, out.velocity);
+    return out;
+  }
+
+  /// An EclipticMeanJ2000 vector multiplied by `scale`, as `Pos`.
+  template <typename Pos> static Pos scaled(const double (&v)[3], double scale) {
+    return Pos(v[0] * scale, v[1] * scale, v[2] * scale);
+  }
+
+private:
+  spk::Kernel kernel_;
+  FrameRotation<frames::ICRS, frames::EclipticMeanJ2000> to_ecliptic_;
+};
+
+/// SPK index of a kernel file loaded by siderust-ffi, mapped on the first
+/// query that needs it (`state`, `kernel`, `Reader::state`). Mapping costs
+/// one `mmap` and a pass over the segment summaries; a failed attempt is
+/// retried by the next call.
+class LazySpkEphemeris {
+public:
+  explicit LazySpkEphemeris(std::string path) : path_(std::move(path)) {}
+
+  const SpkEphemeris &get() const {
+    std::call_once(once_, [this] {
+      index_ = std::make_unique<const SpkEphemeris>(path_, spk::LoadOptions());
+    });
+    return *index_;
+  }
+
+private:
+  std::string path_;
+  mutable std::once_flag once_;
+  mutable std::unique_ptr<const SpkEphemeris> index_;
+};
+
+} // namespace detail
+
 /**
  * @brief Runtime-loaded JPL DE4xx ephemeris.
  *
  * This class wraps an opaque Rust `RuntimeEphemeris` handle.  It loads a
  * BSP file once (from a file path or a memory buffer) and then provides the
  * same five fundamental position/velocity queries as the compile-time
- * `ephemeris::*` free functions.
+ * `ephemeris::*` free functions, plus `state(target, center, jd)` for any
+ * pair of bodies the kernel links.
  *
  * The class is **move-only** — use `std::move` to transfer ownership.
+ *
+ * ## Thread safety
+ *
+ * Every query is `const` and one instance may be shared by any number of
+ * threads: the SPK reader only reads its mapping or retained copy (the
+ * `memory_budget` LRU locks internally), the siderust-ffi handle is only
+ * read after loading, and its lazily mapped index is built once under
+ * `std::call_once`. Shared calls locate the segment and record from
+ * scratch each time; for hot loops give each thread its own `Reader`.
  */
 class RuntimeEphemeris {
 public:
+  class Reader;
+
   // -- Constructors ----------------------------------------------------------
 
   /**
    * @brief Load a runtime ephemeris from a BSP file on disk.
+   *
+   * The named queries go through siderust-ffi. `state()`, `kernel()` and
+   * `Reader::state()` map the file on first use and read it with the
+   * header-only SPK reader.
+   *
    * @param path  Filesystem path to a JPL DE4xx BSP file.
    * @throws DataLoadError  if the file cannot be read or parsed.
    */
@@ -66,23 +286,57 @@ public:
     siderust_runtime_ephemeris_t *h = nullptr;
     check_status(siderust_runtime_ephemeris_load_bsp(path.c_str(), &h), "RuntimeEphemeris(path)");
     handle_ = h;
+    index_ = std::make_shared<const detail::LazySpkEphemeris>(path);
   }
 
   /**
    * @brief Load a runtime ephemeris from raw BSP bytes in memory.
+   *
+   * The bytes are parsed by the header-only SPK reader, which copies the
+   * records (`spk::LoadOptions::resident`), so `data` may be released after
+   * the call and every query — `state()` and readers included — works as
+   * for a path opened with `EphemerisLoadMode::Copy` options.
+   *
    * @param data  Pointer to BSP data.
    * @param len   Length in bytes.
    * @throws DataLoadError  if the data cannot be parsed.
    */
-  RuntimeEphemeris(const uint8_t *data, size_t len) : handle_(nullptr) {
-    siderust_runtime_ephemeris_t *h = nullptr;
-    check_status(siderust_runtime_ephemeris_load_bytes(data, len, &h), "RuntimeEphemeris(bytes)");
-    handle_ = h;
+  RuntimeEphemeris(const uint8_t *data, size_t len)
+      : handle_(nullptr),
+        spk_(std::make_shared<const detail::SpkEphemeris>(
+            data, len, spk::LoadOptions().with_resident(true))) {}
+
+  /**
+   * @brief Load a BSP file with explicit options.
+   *
+   * With `EphemerisLoadMode::Mapped`, opening a kernel costs one `mmap` and
+   * a pass over the segment summaries regardless of its size; queries are
+   * evaluated in C++ (segment types 2 and 3, TT → TDB by the two leading
+   * periodic terms) and rotated to EclipticMeanJ2000 with the library's own
+   * ICRS → ecliptic rotation. A period, body subset or memory budget
+   * selects the same C++ path in either mode (see
+   * `RuntimeEphemerisOptions`).
+   *
+   * @throws DataLoadError  if the file cannot be read, mapped or parsed.
+   * @throws InvalidArgumentError  if the period ends before it starts.
+   */
+  RuntimeEphemeris(const std::string &path, const RuntimeEphemerisOptions &opts)
+      : handle_(nullptr) {
+    if (opts.uses_spk_reader()) {
+      spk_ = std::make_shared<const detail::SpkEphemeris>(path, opts.spk_options());
+    } else {
+      siderust_runtime_ephemeris_t *h = nullptr;
+      check_status(siderust_runtime_ephemeris_load_bsp(path.c_str(), &h),
+                   "RuntimeEphemeris(path)");
+      handle_ = h;
+      index_ = std::make_shared<const detail::LazySpkEphemeris>(path);
+    }
   }
 
   // -- Move semantics --------------------------------------------------------
 
-  RuntimeEphemeris(RuntimeEphemeris &&other) noexcept : handle_(other.handle_) {
+  RuntimeEphemeris(RuntimeEphemeris &&other) noexcept
+      : handle_(other.handle_), spk_(std::move(other.spk_)), index_(std::move(other.index_)) {
     other.handle_ = nullptr;
   }
 
@@ -90,6 +344,8 @@ public:
     if (this != &other) {
       reset();
       handle_ = other.handle_;
+      spk_ = std::move(other.spk_);
+      index_ = std::move(other.index_);
       other.handle_ = nullptr;
     }
     return *this;
@@ -110,6 +366,11 @@ public:
    */
   cartesian::position::HelioBarycentric<qtty::AstronomicalUnit>
   sun_barycentric(const Time<TT, JD> &jd) const {
+    if (spk_) {
+      return detail::SpkEphemeris::scaled<
+          cartesian::position::HelioBarycentric<qtty::AstronomicalUnit>>(
+          spk_->sun(spk::et_from_jd_tt(jd.value())).position, km_to_au());
+    }
     siderust_cartesian_pos_t out;
     check_status(siderust_runtime_ephemeris_sun_barycentric(handle_, jd.value(), &out),
                  "RuntimeEphemeris::sun_barycentric");
@@ -121,6 +382,11 @@ public:
    */
   cartesian::position::GeoBarycentric<qtty::AstronomicalUnit>
   earth_barycentric(const Time<TT, JD> &jd) const {
+    if (spk_) {
+      return detail::SpkEphemeris::scaled<
+          cartesian::position::GeoBarycentric<qtty::AstronomicalUnit>>(
+          spk_->earth(spk::et_from_jd_tt(jd.value())).position, km_to_au());
+    }
     siderust_cartesian_pos_t out;
     check_status(siderust_runtime_ephemeris_earth_barycentric(handle_, jd.value(), &out),
                  "RuntimeEphemeris::earth_barycentric");
@@ -132,6 +398,11 @@ public:
    */
   cartesian::position::EclipticMeanJ2000<qtty::AstronomicalUnit>
   earth_heliocentric(const Time<TT, JD> &jd) const {
+    if (spk_) {
+      return detail::SpkEphemeris::scaled<
+          cartesian::position::EclipticMeanJ2000<qtty::AstronomicalUnit>>(
+          spk_->earth_heliocentric(spk::et_from_jd_tt(jd.value())).position, km_to_au());
+    }
     siderust_cartesian_pos_t out;
     check_status(siderust_runtime_ephemeris_earth_heliocentric(handle_, jd.value(), &out),
                  "RuntimeEphemeris::earth_heliocentric");
@@ -143,6 +414,11 @@ public:
    */
   cartesian::position::MoonGeocentric<qtty::Kilometer>
   moon_geocentric(const Time<TT, JD> &jd) const {
+    if (spk_) {
+      return detail::SpkEphemeris::scaled<
+          cartesian::position::MoonGeocentric<qtty::Kilometer>>(
+          spk_->moon(spk::et_from_jd_tt(jd.value())).position, 1.0);
+    }
     siderust_cartesian_pos_t out;
     check_status(siderust_runtime_ephemeris_moon_geocentric(handle_, jd.value(), &out),
                  "RuntimeEphemeris::moon_geocentric");
@@ -156,21 +432,132 @@ public:
    * position as provided by the loaded JPL DE kernel.
    */
   CartesianVelocity earth_barycentric_velocity(const Time<TT, JD> &jd) const {
+    if (spk_) {
+      const spk::State s = spk_->earth(spk::et_from_jd_tt(jd.value()));
+      const double scale = km_to_au() * 86400.0;
+      return {s.velocity[0] * scale, s.velocity[1] * scale, s.velocity[2] * scale,
+              SIDERUST_FRAME_T_ECLIPTIC_MEAN_J2000};
+    }
     siderust_cartesian_vel_t out{};
     check_status(siderust_runtime_ephemeris_earth_barycentric_velocity(handle_, jd.value(), &out),
                  "RuntimeEphemeris::earth_barycentric_velocity");
     return CartesianVelocity::from_c(out);
   }
 
+  // -- Arbitrary bodies ------------------------------------------------------
+
+  /**
+   * @brief State of any body relative to any other, by NAIF id.
+   *
+   * Works for every body the kernel links to the solar-system barycenter —
+   * planets, barycenters, satellites and spacecraft segments in custom
+   * SPKs — by chaining segments through the bodies' common ancestor (see
+   * `spk::Kernel::chain`). Segments in the J2000 and ECLIPJ2000 frames are
+   * supported.
+   *
+   * Evaluated by the header-only SPK reader; a kernel file loaded by
+   * siderust-ffi is mapped for it on the first call.
+   *
+   * @throws OutOfRangeError if the bodies are not connected or `jd` is not
+   *         covered.
+   */
+  EphemerisState state(std::int32_t target, std::int32_t center, const Time<TT, JD> &jd) const {
+    const spk::Chain chain = require_kernel("RuntimeEphemeris::state").chain(target, center);
+    return state(chain, spk::et_from_jd_tt(jd.value()));
+  }
+
+  /**
+   * @brief `state(target, center, jd[i])` for every epoch, resolving the
+   *        segment chain once and splitting the epochs over `parallelism`
+   *        threads (`0` = hardware concurrency).
+   * @throws InvalidDimensionError if `out.size() != jd.size()`.
+   */
+  void state(std::int32_t target, std::int32_t center, span<const Time<TT, JD>> jd,
+             span<EphemerisState> out, std::size_t parallelism = 1) const {
+    detail::check_batch_size(jd.size(), out.size(), "RuntimeEphemeris::state");
+    const spk::Chain chain = require_kernel("RuntimeEphemeris::state").chain(target, center);
+    const std::size_t n = jd.size();
+    const std::size_t chunks =
+        std::min(detail::resolve_threads(parallelism), std::max<std::size_t>(n, 1));
+    detail::run_parallel(chunks, [&](std::size_t c) {
+      const std::size_t end = n * (c + 1) / chunks;
+      for (std::size_t i = n * c / chunks; i < end; ++i)
+        out[i] = state(chain, spk::et_from_jd_tt(jd[i].value()));
+    });
+  }
+
+  /// Allocating form of the batch `state`.
+  std::vector<EphemerisState> state(std::int32_t target, std::int32_t center,
+                                    span<const Time<TT, JD>> jd,
+                                    std::size_t parallelism = 1) const {
+    std::vector<EphemerisState> out(jd.size());
+    state(target, center, jd, out, parallelism);
+    return out;
+  }
+
   // -- Validity --------------------------------------------------------------
 
   /**
    * @brief Check whether this handle is valid (non-null).
    */
-  explicit operator bool() const noexcept { return handle_ != nullptr; }
+  explicit operator bool() const noexcept { return handle_ != nullptr || spk_ != nullptr; }
+
+  /// True when the kernel was opened with `EphemerisLoadMode::Mapped`
+  /// and reads records straight from the mapping.
+  bool is_mapped() const noexcept {
+    return spk_ != nullptr && spk_->kernel().storage() == spk::Storage::Mapped;
+  }
+
+  /// True when the named queries are evaluated by the header-only SPK
+  /// reader rather than siderust-ffi.
+  bool has_kernel() const noexcept { return spk_ != nullptr; }
+
+  /**
+   * @brief The SPK kernel read by the header-only reader (mapped on first
+   *        use for a kernel file loaded by siderust-ffi).
+   * @throws InvalidArgumentError for a default-constructed or moved-from
+   *         ephemeris.
+   */
+  const spk::Kernel &kernel() const { return require_kernel("RuntimeEphemeris::kernel"); }
+
+  /// A per-thread `Reader` over this ephemeris.
+  Reader reader() const;
 
 private:
   siderust_runtime_ephemeris_t *handle_;
+  std::shared_ptr<const detail::SpkEphemeris> spk_;
+  std::shared_ptr<const detail::LazySpkEphemeris> index_; ///< FFI-loaded file.
+
+  static double km_to_au() { return qtty::Kilometer(1.0).to<qtty::AstronomicalUnit>().value(); }
+
+  /// The SPK reader answering `state()`: the primary one, or the lazily
+  /// mapped index of a kernel file loaded by siderust-ffi.
+  const detail::SpkEphemeris &index(const char *operation) const {
+    if (spk_)
+      return *spk_;
+    if (!index_)
+      throw InvalidArgumentError(std::string(operation) + ": empty RuntimeEphemeris");
+    return index_->get();
+  }
+
+  const spk::Kernel &require_kernel(const char *operation) const {
+    return index(operation).kernel();
+  }
+
+  EphemerisState state(const spk::Chain &chain, double et) const {
+    return to_state(chain.frame(), index("RuntimeEphemeris::state").kernel().state(chain, et));
+  }
+
+  /// Rotate and scale an SPK state in NAIF frame `frame`.
+  EphemerisState to_state(std::int32_t frame, const spk::State &s) const {
+    const spk::State e = index("RuntimeEphemeris::state").to_ecliptic(frame, s);
+    const double au = km_to_au();
+    EphemerisState out;
+    out.position = detail::SpkEphemeris::scaled<decltype(out.position)>(e.position, au);
+    out.velocity = {e.velocity[0] * au * 86400.0, e.velocity[1] * au * 86400.0,
+                    e.velocity[2] * au * 86400.0, SIDERUST_FRAME_T_ECLIPTIC_MEAN_J2000};
+    return out;
+  }
 
   void reset() noexcept {
     if (handle_) {
@@ -180,4 +567,122 @@ private:
   }
 };
 
+/**
+ * @brief Per-thread read handle over a shared `RuntimeEphemeris`.
+ *
+ * Resolves each body chain once and keeps an `spk::Cursor`, so queries
+ * whose epoch falls in the record used last for each link skip the segment
+ * search and record copy. Monotone time scans hit almost always; results
+ * are identical to the `RuntimeEphemeris` queries.
+ *
+ * A reader is cheap to create, is not thread-safe, and must not outlive
+ * the ephemeris it reads. Create one per worker thread:
+ *
+ * @code
+ * const RuntimeEphemeris de440(
+ *     path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+ * // on each worker:
+ * auto reader = de440.reader();
+ * for (const auto &t : my_epochs) use(reader.moon_geocentric(t));
+ * @endcode
+ *
+ * For kernels loaded through siderust-ffi the named queries forward to the
+ * ephemeris, and `state()` keeps its own cursor over the mapped index.
+ */
+class RuntimeEphemeris::Reader {
+public:
+  explicit Reader(const RuntimeEphemeris &eph) : eph_(&eph) {
+    if (eph.spk_)
+      cursor_.emplace(eph.spk_->kernel());
+  }
+
+  cartesian::position::HelioBarycentric<qtty::AstronomicalUnit>
+  sun_barycentric(const Time<TT, JD> &jd) {
+    if (!cursor_)
+      return eph_->sun_barycentric(jd);
+    return position<cartesian::position::HelioBarycentric<qtty::AstronomicalUnit>>(
+        sun_, spk::naif::Sun, spk::naif::SolarSystemBarycenter, jd, RuntimeEphemeris::km_to_au());
+  }
+
+  cartesian::position::GeoBarycentric<qtty::AstronomicalUnit>
+  earth_barycentric(const Time<TT, JD> &jd) {
+    if (!cursor_)
+      return eph_->earth_barycentric(jd);
+    return position<cartesian::position::GeoBarycentric<qtty::AstronomicalUnit>>(
+        earth_, spk::naif::Earth, spk::naif::SolarSystemBarycenter, jd,
+        RuntimeEphemeris::km_to_au());
+  }
+
+  cartesian::position::EclipticMeanJ2000<qtty::AstronomicalUnit>
+  earth_heliocentric(const Time<TT, JD> &jd) {
+    if (!cursor_)
+      return eph_->earth_heliocentric(jd);
+    return position<cartesian::position::EclipticMeanJ2000<qtty::AstronomicalUnit>>(
+        earth_sun_, spk::naif::Earth, spk::naif::Sun, jd, RuntimeEphemeris::km_to_au());
+  }
+
+  cartesian::position::MoonGeocentric<qtty::Kilometer> moon_geocentric(const Time<TT, JD> &jd) {
+    if (!cursor_)
+      return eph_->moon_geocentric(jd);
+    return position<cartesian::position::MoonGeocentric<qtty::Kilometer>>(
+        moon_, spk::naif::Moon, spk::naif::Earth, jd, 1.0);
+  }
+
+  CartesianVelocity earth_barycentric_velocity(const Time<TT, JD> &jd) {
+    if (!cursor_)
+      return eph_->earth_barycentric_velocity(jd);
+    return state(spk::naif::Earth, spk::naif::SolarSystemBarycenter, jd).velocity;
+  }
+
+  /// `RuntimeEphemeris::state` through this reader's cursor.
+  EphemerisState state(std::int32_t target, std::int32_t center, const Time<TT, JD> &jd) {
+    if (!cursor_ && !index_cursor_)
+      index_cursor_.emplace(eph_->require_kernel("RuntimeEphemeris::Reader::state"));
+    spk::Cursor &cursor = cursor_ ? *cursor_ : *index_cursor_;
+    const spk::Chain &c = chain(target, center);
+    return eph_->to_state(c.frame(), cursor.state(c, spk::et_from_jd_tt(jd.value())));
+  }
+
+  /// Link evaluations served from the remembered records (0 without a
+  /// cursor).
+  std::size_t hits() const noexcept {
+    return cursor_ ? cursor_->hits() : index_cursor_ ? index_cursor_->hits() : 0;
+  }
+
+  /// Link evaluations that located and copied a record.
+  std::size_t misses() const noexcept {
+    return cursor_ ? cursor_->misses() : index_cursor_ ? index_cursor_->misses() : 0;
+  }
+
+private:
+  template <typename Pos>
+  Pos position(std::optional<spk::Chain> &slot, std::int32_t target, std::int32_t center,
+               const Time<TT, JD> &jd, double scale) {
+    if (!slot)
+      slot = eph_->spk_->kernel().chain(target, center);
+    const spk::State s = cursor_->state(*slot, spk::et_from_jd_tt(jd.value()));
+    double p[3];
+    eph_->spk_->to_ecliptic(slot->frame(), s.position, p);
+    return detail::SpkEphemeris::scaled<Pos>(p, scale);
+  }
+
+  const spk::Chain &chain(std::int32_t target, std::int32_t center) {
+    for (const spk::Chain &c : chains_) {
+      if (c.target() == target && c.center() == center)
+        return c;
+    }
+    chains_.push_back(
+        eph_->require_kernel("RuntimeEphemeris::Reader::state").chain(target, center));
+    return chains_.back();
+  }
+
+  const RuntimeEphemeris *eph_;
+  std::optional<spk::Cursor> cursor_;
+  std::optional<spk::Cursor> index_cursor_; ///< `state()` over the mapped index.
+  std::optional<spk::Chain> sun_, earth_, earth_sun_, moon_;
+  std::vector<spk::Chain> chains_;
+};
+
+inline RuntimeEphemeris::Reader RuntimeEphemeris::reader() const { return Reader(*this); }
+
 } // namespace siderust
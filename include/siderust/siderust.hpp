@@ -34,9 +34,16 @@
 #include "bodies.hpp"
 #include "body_target.hpp"
 #include "centers.hpp"
+#include "compact_catalog.hpp"
 #include "coordinates.hpp"
 #include "coordinates/bodycentric_transforms.hpp"
+#include "direction_index.hpp"
 #include "ephemeris.hpp"
+#include "ephemeris_cache.hpp"
+#include "ephemeris_provider.hpp"
+#include "ephemeris_search.hpp"
+#include "ephemeris_snapshot.hpp"
+#include "ffi_array.hpp"
 #include "ffi_core.hpp"
 #include "frames.hpp"
 #include "lambert.hpp"
@@ -48,6 +55,8 @@
 #include "runtime_ephemeris.hpp"
 #include "sgp4.hpp"
 #include "sky_grid.hpp"
+#include "span.hpp"
+#include "spk.hpp"
 #include "star_target.hpp"
 #include "subject.hpp"
 #include "target.hpp"
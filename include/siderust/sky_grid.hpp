@@ -12,29 +12,13 @@
  */
 
 #include "coordinates/spherical.hpp"
+#include "ffi_array.hpp"
 #include "ffi_core.hpp"
 #include <qtty/qtty.hpp>
 #include <vector>
 
 namespace siderust {
 
-namespace detail {
-
-struct SkyGridCellsGuard {
-  SiderustSkyGridCell *ptr = nullptr;
-  uintptr_t count = 0;
-
-  ~SkyGridCellsGuard() { siderust_sky_grid_cells_free(ptr, count); }
-
-  SkyGridCellsGuard() = default;
-  SkyGridCellsGuard(const SkyGridCellsGuard &) = delete;
-  SkyGridCellsGuard &operator=(const SkyGridCellsGuard &) = delete;
-  SkyGridCellsGuard(SkyGridCellsGuard &&) = delete;
-  SkyGridCellsGuard &operator=(SkyGridCellsGuard &&) = delete;
-};
-
-} // namespace detail
-
 /**
  * @brief A single sky-grid cell: a Horizontal direction and its solid angle.
  *
@@ -51,6 +35,9 @@ struct SkyGridCell {
   }
 };
 
+/// Sky-grid cells owned in their FFI-allocated buffer.
+using SkyGridCellList = FfiArray<SkyGridCell, SiderustSkyGridCell>;
+
 /**
  * @brief Typed hemispherical alt/az grid sampler.
  *
@@ -91,28 +78,21 @@ public:
     return *this;
   }
 
-  /// Materialise every cell of the grid.
-  std::vector<SkyGridCell> cells() const {
+  /// Every cell of the grid, left in the FFI-allocated buffer.
+  SkyGridCellList cells_view() const {
     SiderustSkyGridCell *ptr = nullptr;
     uintptr_t count = 0;
     check_status(
         siderust_sky_grid_cells(alt_min_, alt_max_, alt_step_, az_step_, equal_area_, &ptr, &count),
         "SkyGrid::cells");
-
-    detail::SkyGridCellsGuard guard{};
-    guard.ptr = ptr;
-    guard.count = count;
-
-    std::vector<SkyGridCell> result;
-    result.reserve(count);
-    for (uintptr_t i = 0; i < count; ++i) {
-      result.push_back(SkyGridCell::from_c(ptr[i]));
-    }
-    return result;
+    return SkyGridCellList(ptr, count);
   }
 
+  /// Materialise every cell of the grid.
+  std::vector<SkyGridCell> cells() const { return cells_view().to_vector(); }
+
   /// Number of cells the grid materialises.
-  std::size_t size() const { return cells().size(); }
+  std::size_t size() const { return cells_view().size(); }
 };
 
 } // namespace siderust
@@ -0,0 +1,118 @@
+#pragma once
+
+/**
+ * @file span.hpp
+ * @brief Non-owning contiguous view used by the batch APIs.
+ *
+ * The wrapper targets C++17, which has no `std::span`. `siderust::span<T>`
+ * is a minimal stand-in exposing the subset of the `std::span` interface the
+ * batch functions need (`data`, `size`, `empty`, indexing, iteration and
+ * `subspan`). When the translation unit is compiled as C++20 or later it is
+ * an alias of `std::span<T>`, so caller code written against it keeps working
+ * unchanged.
+ *
+ * A span converts implicitly from `std::vector`, `std::array`, C arrays and
+ * from `span<U>` when `U(*)[]` converts to `T(*)[]` (e.g. `span<T>` to
+ * `span<const T>`).
+ */
+
+#include <cstddef>
+
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+#include <span>
+#else
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#endif
+
+namespace siderust {
+
+#if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
+
+template <typename T> using span = std::span<T>;
+
+#else
+
+/**
+ * @brief Non-owning view over `size()` contiguous elements of type `T`.
+ */
+template <typename T> class span {
+  template <typename C>
+  using container_element_t =
+      std::remove_pointer_t<decltype(std::data(std::declval<C &>()))>;
+
+  template <typename C>
+  using enable_if_compatible_container_t = std::enable_if_t<
+      !std::is_array<std::remove_cv_t<C>>::value &&
+      std::is_convertible<container_element_t<C> (*)[], T (*)[]>::value>;
+
+public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using pointer = T *;
+  using reference = T &;
+  using iterator = T *;
+
+  constexpr span() noexcept = default;
+  constexpr span(T *data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+  template <std::size_t N> constexpr span(T (&arr)[N]) noexcept : data_(arr), size_(N) {}
+
+  template <typename C, typename = enable_if_compatible_container_t<C>>
+  constexpr span(C &c) noexcept(noexcept(std::data(c)))
+      : data_(std::data(c)), size_(std::size(c)) {}
+
+  template <typename C, typename = enable_if_compatible_container_t<const C>>
+  constexpr span(const C &c) noexcept(noexcept(std::data(c)))
+      : data_(std::data(c)), size_(std::size(c)) {}
+
+  template <typename U,
+            typename = std::enable_if_t<!std::is_same<U, T>::value &&
+                                        std::is_convertible<U (*)[], T (*)[]>::value>>
+  constexpr span(const span<U> &other) noexcept : data_(other.data()), size_(other.size()) {}
+
+  constexpr T *data() const noexcept { return data_; }
+  constexpr std::size_t size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr T &operator[](std::size_t i) const { return data_[i]; }
+  constexpr T &front() const { return data_[0]; }
+  constexpr T &back() const { return data_[size_ - 1]; }
+
+  constexpr iterator begin() const noexcept { return data_; }
+  constexpr iterator end() const noexcept { return data_ + size_; }
+
+  constexpr span subspan(std::size_t offset, std::size_t count) const {
+    return span(data_ + offset, count);
+  }
+  constexpr span first(std::size_t count) const { return span(data_, count); }
+
+private:
+  T *data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+#endif
+
+namespace detail {
+
+/// Keeps `T` out of template argument deduction, so a batch function can
+/// deduce its tags from one span parameter and let containers convert
+/// implicitly into the others.
+template <typename T> struct non_deduced {
+  using type = T;
+};
+template <typename T> using non_deduced_t = typename non_deduced<T>::type;
+
+} // namespace detail
+
+} // namespace siderust
@@ -0,0 +1,793 @@
+#pragma once
+
+/**
+ * @file spk.hpp
+ * @brief Header-only reader for JPL SPK (DAF) kernels with Chebyshev
+ *        segments (types 2 and 3).
+ *
+ * `spk::Kernel` maps a `.bsp` file read-only and parses only the DAF file
+ * record and the segment summaries at open time — a few kilobytes even for
+ * DE441. Coefficient records stay on disk until a query touches them and
+ * are then served from the OS page cache, which every process mapping the
+ * same kernel shares.
+ *
+ * Positions are returned in km and velocities in km/s, in the segment's own
+ * frame (J2000/ICRF for the JPL planetary kernels) and relative to the
+ * segment's center, exactly as stored.
+ *
+ * @code
+ * const spk::Kernel de440("/data/de440.bsp");
+ * const double et = spk::et_from_jd_tt(jd.value());
+ * const auto emb = de440.state(3, 0, et);   // Earth–Moon barycenter wrt SSB
+ * @endcode
+ *
+ * `LoadOptions` trims a kernel to a time span and a set of bodies, and can
+ * replace the mapping by a private copy of the retained records or by an
+ * LRU cache of records bounded in bytes.
+ */
+
+#include "constants.hpp"
+#include "detail/chebyshev.hpp"
+#include "detail/mapped_file.hpp"
+#include "detail/record_cache.hpp"
+#include "ffi_core.hpp"
+#include "span.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace siderust {
+namespace spk {
+
+/// Well-known NAIF body ids used by the planetary kernels.
+namespace naif {
+constexpr std::int32_t SolarSystemBarycenter = 0;
+constexpr std::int32_t MercuryBarycenter = 1;
+constexpr std::int32_t VenusBarycenter = 2;
+constexpr std::int32_t EarthMoonBarycenter = 3;
+constexpr std::int32_t MarsBarycenter = 4;
+constexpr std::int32_t JupiterBarycenter = 5;
+constexpr std::int32_t SaturnBarycenter = 6;
+constexpr std::int32_t UranusBarycenter = 7;
+constexpr std::int32_t NeptuneBarycenter = 8;
+constexpr std::int32_t PlutoBarycenter = 9;
+constexpr std::int32_t Sun = 10;
+constexpr std::int32_t Mercury = 199;
+constexpr std::int32_t Venus = 299;
+constexpr std::int32_t Moon = 301;
+constexpr std::int32_t Earth = 399;
+constexpr std::int32_t Mars = 499;
+} // namespace naif
+
+/// NAIF frame codes of the segments `RuntimeEphemeris` can rotate.
+namespace frame {
+constexpr std::int32_t J2000 = 1;       ///< ICRF-aligned J2000 equator.
+constexpr std::int32_t EclipJ2000 = 17; ///< Mean ecliptic and equinox of J2000.
+} // namespace frame
+
+/// TDB seconds past J2000 for a TT Julian date. TDB − TT is taken from the
+/// two leading periodic terms (≤ 1.7 ms, good to ~30 µs).
+inline double et_from_jd_tt(double jd_tt) {
+  constexpr double kJ2000 = 2451545.0;
+  const double d = jd_tt - kJ2000;
+  const double g = (357.53 + 0.98560028 * d) * (constants::pi / 180.0);
+  return d * 86400.0 + 0.001657 * std::sin(g) + 0.000014 * std::sin(2.0 * g);
+}
+
+/// Descriptor of one SPK segment, parsed from its DAF summary.
+struct Segment {
+  std::int32_t target = 0;
+  std::int32_t center = 0;
+  std::int32_t frame = 0;
+  std::int32_t type = 0;
+  double start_et = 0.0; ///< Coverage start, TDB seconds past J2000.
+  double end_et = 0.0;   ///< Coverage end, TDB seconds past J2000.
+  std::size_t begin = 0; ///< First double-word address (1-based).
+  std::size_t end = 0;   ///< Last double-word address (1-based).
+
+  // Type 2/3 directory (trailing four words of the segment).
+  double init = 0.0;           ///< Start of the first record [s].
+  double interval = 0.0;       ///< Length of each record [s].
+  std::size_t record_size = 0; ///< Doubles per record.
+  std::size_t record_count = 0;
+
+  bool covers(double et) const { return et >= start_et && et <= end_et; }
+
+  /// Record holding `et`, clamped to the retained records.
+  std::size_t record_index(double et) const {
+    const double idx = std::floor((et - init) / interval);
+    if (!(idx > 0.0))
+      return 0;
+    return std::min(static_cast<std::size_t>(idx), record_count - 1);
+  }
+
+  /// Chebyshev components per record: 3 (type 2) or 6 (type 3).
+  std::size_t components() const { return type == 3 ? 6 : 3; }
+
+  /// Coefficients per component.
+  std::size_t coefficients() const { return (record_size - 2) / components(); }
+};
+
+/// Position [km] and velocity [km/s] returned by `Kernel::state`.
+struct State {
+  double position[3];
+  double velocity[3];
+};
+
+/// Where `Kernel` reads coefficient records from.
+enum class Storage {
+  /// Straight from the read-only mapping (pages stay resident once touched).
+  Mapped,
+  /// From a private, native-endian copy of the retained records made at
+  /// open; the file is unmapped afterwards.
+  Resident,
+  /// From an LRU cache of records bounded by `LoadOptions::cache_bytes`.
+  /// A kernel opened from a path unmaps the file after parsing and reads
+  /// misses with positional file reads, so the cache is all it keeps
+  /// resident; one parsed from memory copies misses out of that memory.
+  Paged,
+};
+
+/// What `Kernel` retains of a file and how it stores it.
+struct LoadOptions {
+  /// Retained coverage, TDB seconds past J2000. Segments are clipped to it
+  /// and queries outside fail with `OutOfRangeError`.
+  double start_et = -std::numeric_limits<double>::infinity();
+  double end_et = std::numeric_limits<double>::infinity();
+  /// NAIF ids whose segments are kept, together with every center on their
+  /// chain towards the solar-system barycenter. Empty keeps all segments.
+  std::vector<std::int32_t> targets;
+  /// Copy the retained records into memory and unmap the file.
+  bool resident = false;
+  /// When non-zero, serve records from an LRU cache of at most this many
+  /// bytes (takes precedence over `resident`).
+  std::size_t cache_bytes = 0;
+
+  LoadOptions() = default;
+
+  LoadOptions &with_span(double start, double end) {
+    start_et = start;
+    end_et = end;
+    return *this;
+  }
+  LoadOptions &with_targets(std::vector<std::int32_t> ids) {
+    targets = std::move(ids);
+    return *this;
+  }
+  LoadOptions &with_resident(bool r) {
+    resident = r;
+    return *this;
+  }
+  LoadOptions &with_cache_bytes(std::size_t bytes) {
+    cache_bytes = bytes;
+    return *this;
+  }
+};
+
+class Kernel;
+class Cursor;
+
+/**
+ * @brief Segment path between two bodies, resolved once by
+ *        `Kernel::chain` and evaluated by `Kernel::state(chain, et)`.
+ *
+ * Holds one step per body → parent link, from the target up to the common
+ * ancestor and back down to the center, so repeated queries for the same
+ * pair skip the lookup. Valid for the kernel that resolved it.
+ */
+class Chain {
+public:
+  /// Longest supported path in links.
+  static constexpr std::size_t kMaxSteps = 16;
+
+  std::int32_t target() const noexcept { return target_; }
+  std::int32_t center() const noexcept { return center_; }
+
+  /// NAIF frame code shared by every segment on the path.
+  std::int32_t frame() const noexcept { return frame_; }
+
+  /// Number of links (0 when target and center coincide).
+  std::size_t size() const noexcept { return count_; }
+
+private:
+  friend class Kernel;
+  friend class Cursor;
+
+  struct Step {
+    std::size_t link; ///< Index into the kernel's link table.
+    double sign;      ///< +1 walking up from the target, −1 down to the center.
+  };
+
+  std::int32_t target_ = 0;
+  std::int32_t center_ = 0;
+  std::int32_t frame_ = frame::J2000;
+  std::array<Step, kMaxSteps> steps_{};
+  std::size_t count_ = 0;
+};
+
+/**
+ * @brief Memory-mapped SPK kernel.
+ *
+ * Only segments of type 2 (Chebyshev position) and 3 (Chebyshev position
+ * and velocity) — the types used by every JPL DE planetary kernel — can be
+ * evaluated; other segments are listed but `state` rejects them. Both
+ * little- and big-endian (`LTL-IEEE` / `BIG-IEEE`) files are accepted.
+ *
+ * All queries are `const`; they touch only the read-only mapping (or the
+ * retained copy), and the `Storage::Paged` cache locks internally around
+ * its file reads, so one kernel may be queried from any number of threads
+ * concurrently.
+ */
+class Kernel {
+public:
+  /// Largest coefficient count per component the reader accepts.
+  static constexpr std::size_t kMaxCoefficients = 64;
+
+  /// Largest record (mid, radius and six components) in doubles.
+  static constexpr std::size_t kMaxRecord = 2 + 6 * kMaxCoefficients;
+
+  /**
+   * @brief Map the kernel at `path`, parse its segment summaries and apply
+   *        `opts`.
+   * @throws DataLoadError if the file cannot be mapped or is not a valid SPK.
+   */
+  explicit Kernel(const std::string &path, const LoadOptions &opts = LoadOptions())
+      : file_(path) {
+    data_ = file_.data();
+    size_ = file_.size();
+    parse();
+    apply(opts);
+    index_links();
+    if (storage_ == Storage::Paged) {
+      // Parsing touched only summaries and directories; from here on the
+      // LRU is the only copy of coefficient data this process keeps.
+      reader_ = detail::FileReader(path);
+      file_ = detail::MappedFile();
+      data_ = nullptr;
+    }
+  }
+
+  /**
+   * @brief Parse a kernel already in memory. Unless `opts.resident` is set
+   *        the bytes are not copied and must outlive the kernel.
+   * @throws DataLoadError if the data is not a valid SPK.
+   */
+  Kernel(const std::uint8_t *data, std::size_t len, const LoadOptions &opts = LoadOptions())
+      : data_(data), size_(len) {
+    parse();
+    apply(opts);
+    index_links();
+  }
+
+  Kernel(Kernel &&) noexcept = default;
+  Kernel &operator=(Kernel &&) noexcept = default;
+  Kernel(const Kernel &) = delete;
+  Kernel &operator=(const Kernel &) = delete;
+
+  /// Segment descriptors in file order.
+  span<const Segment> segments() const { return segments_; }
+
+  /// Size of the kernel in bytes (address space, not resident memory); for
+  /// `Storage::Resident` the size of the retained copy. A `Storage::Paged`
+  /// kernel opened from a path reports the file size but maps nothing.
+  std::size_t mapped_bytes() const noexcept { return size_; }
+
+  /// How coefficient records are stored.
+  Storage storage() const noexcept { return storage_; }
+
+  /// Heap bytes held for coefficient records: the retained copy, or the
+  /// current LRU contents. Pages of a mapping are not counted.
+  std::size_t resident_bytes() const {
+    if (cache_)
+      return cache_->bytes();
+    return storage_ == Storage::Resident ? size_ : 0;
+  }
+
+  /**
+   * @brief Segment giving `target` relative to `center` at `et`, or
+   *        `nullptr`. Later segments take precedence, as in SPICE.
+   */
+  const Segment *find(std::int32_t target, std::int32_t center, double et) const {
+    for (std::size_t i = segments_.size(); i-- > 0;) {
+      const Segment &s = segments_[i];
+      if (s.target == target && s.center == center && s.covers(et))
+        return &s;
+    }
+    return nullptr;
+  }
+
+  /// Bodies that have an evaluable segment towards a parent, in first-seen
+  /// order.
+  std::vector<std::int32_t> bodies() const {
+    std::vector<std::int32_t> out;
+    out.reserve(links_.size());
+    for (const Link &l : links_)
+      out.push_back(l.body);
+    return out;
+  }
+
+  /**
+   * @brief Resolve the segment path from `center` to `target`.
+   *
+   * Each body is linked to the center of its highest-precedence segment;
+   * the path climbs from the target to the first ancestor it shares with
+   * the center and descends from there, e.g. Mars (499) wrt Moon (301) is
+   * 499 → 4 → 0 ← 3 ← 301.
+   *
+   * @throws OutOfRangeError if the two bodies are not connected.
+   * @throws InvalidArgumentError if the path mixes reference frames.
+   * @throws DataLoadError if the path is longer than `Chain::kMaxSteps`.
+   */
+  Chain chain(std::int32_t target, std::int32_t center) const {
+    Chain c;
+    c.target_ = target;
+    c.center_ = center;
+
+    std::int32_t up[Chain::kMaxSteps + 1];
+    std::size_t depth = 0;
+    for (std::int32_t b = center;; b = links_[link_of_.at(b)].parent) {
+      if (depth > Chain::kMaxSteps)
+        throw DataLoadError("spk::Kernel: segment chain too deep from " + std::to_string(center));
+      up[depth++] = b;
+      if (link_of_.count(b) == 0)
+        break;
+    }
+
+    const auto push = [&](std::size_t link, double sign) {
+      if (c.count_ == Chain::kMaxSteps)
+        throw DataLoadError("spk::Kernel: segment chain too deep between " +
+                            std::to_string(target) + " and " + std::to_string(center));
+      // Any candidate segment of the link may serve an epoch, so all of them
+      // must share the chain's frame.
+      for (std::size_t seg : links_[link].segments) {
+        const std::int32_t f = segments_[seg].frame;
+        if (c.count_ == 0 && seg == links_[link].segments.front())
+          c.frame_ = f;
+        else if (f != c.frame_)
+          throw InvalidArgumentError("spk::Kernel: chain " + std::to_string(target) + " wrt " +
+                                     std::to_string(center) + " mixes reference frames");
+      }
+      c.steps_[c.count_++] = {link, sign};
+    };
+
+    std::int32_t b = target;
+    while (std::find(up, up + depth, b) == up + depth) {
+      const auto it = link_of_.find(b);
+      if (it == link_of_.end())
+        throw OutOfRangeError("spk::Kernel: no segment chain links " + std::to_string(target) +
+                              " to " + std::to_string(center));
+      push(it->second, 1.0);
+      b = links_[it->second].parent;
+    }
+    for (std::size_t i = 0; up[i] != b; ++i)
+      push(link_of_.at(up[i]), -1.0);
+    return c;
+  }
+
+  /**
+   * @brief State of `target` relative to `center` at `et`, chaining
+   *        segments through their common ancestor as needed.
+   * @throws OutOfRangeError if the bodies are not connected or a link is
+   *         not covered at `et`.
+   */
+  State state(std::int32_t target, std::int32_t center, double et) const {
+    return state(chain(target, center), et);
+  }
+
+  /**
+   * @brief Evaluate a resolved chain at `et`.
+   * @throws OutOfRangeError if a link has no segment covering `et`.
+   */
+  State state(const Chain &c, double et) const {
+    State out{};
+    for (std::size_t i = 0; i < c.count_; ++i) {
+      const Link &l = links_[c.steps_[i].link];
+      const Segment *seg = nullptr;
+      for (std::size_t j = l.segments.size(); j-- > 0;) {
+        if (segments_[l.segments[j]].covers(et)) {
+          seg = &segments_[l.segments[j]];
+          break;
+        }
+      }
+      if (seg == nullptr) {
+        throw OutOfRangeError("spk::Kernel: no segment for " + std::to_string(l.body) + " wrt " +
+                              std::to_string(l.parent) + " at et " + std::to_string(et));
+      }
+      const State s = state(*seg, et);
+      const double sign = c.steps_[i].sign;
+      for (std::size_t k = 0; k < 3; ++k) {
+        out.position[k] += sign * s.position[k];
+        out.velocity[k] += sign * s.velocity[k];
+      }
+    }
+    return out;
+  }
+
+  /**
+   * @brief Evaluate `seg` at `et`.
+   * @throws DataLoadError if the segment type is not 2 or 3.
+   */
+  State state(const Segment &seg, double et) const {
+    if (seg.type != 2 && seg.type != 3)
+      throw DataLoadError("spk::Kernel: unsupported segment type " + std::to_string(seg.type));
+    return evaluate(seg, seg.record_index(et), et);
+  }
+
+  /// Evaluate record `index` of `seg` at `et` (no coverage check).
+  State evaluate(const Segment &seg, std::size_t index, double et) const {
+    double rec[kMaxRecord];
+    read_record(seg, index, rec);
+    return evaluate(seg, rec, et);
+  }
+
+  /// Evaluate a record of `seg` already copied by `read_record`.
+  static State evaluate(const Segment &seg, const double *rec, double et) {
+    const double mid = rec[0];
+    const double radius = rec[1];
+    const double x = (et - mid) / radius;
+    const std::size_t n = seg.coefficients();
+
+    State out{};
+    for (std::size_t k = 0; k < 3; ++k) {
+      double deriv;
+      detail::chebyshev_eval(rec + 2 + k * n, n, x, out.position[k], deriv);
+      out.velocity[k] = deriv / radius;
+    }
+    if (seg.type == 3) {
+      for (std::size_t k = 0; k < 3; ++k)
+        out.velocity[k] = detail::chebyshev_value(rec + 2 + (3 + k) * n, n, x);
+    }
+    return out;
+  }
+
+  /// Copy record `index` of `seg` (`seg.record_size` doubles) into `out`.
+  void read_record(const Segment &seg, std::size_t index, double *out) const {
+    const std::size_t addr = seg.begin + index * seg.record_size;
+    if (!cache_) {
+      read_words(addr, seg.record_size, out);
+      return;
+    }
+    cache_->get(addr, seg.record_size, out,
+                [&](double *words) { read_words(addr, seg.record_size, words); });
+  }
+
+private:
+  friend class Cursor;
+
+  static bool host_little_endian() {
+    const std::uint16_t one = 1;
+    std::uint8_t first;
+    std::memcpy(&first, &one, 1);
+    return first == 1;
+  }
+
+  template <typename T> T read_at(std::size_t offset) const {
+    std::uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, data_ + offset, sizeof(T));
+    if (swap_) {
+      for (std::size_t i = 0; i < sizeof(T) / 2; ++i)
+        std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+    }
+    T v;
+    std::memcpy(&v, bytes, sizeof(T));
+    return v;
+  }
+
+  /// Double at 1-based DAF word address `addr`.
+  double word(std::size_t addr) const { return read_at<double>((addr - 1) * 8); }
+
+  void read_words(std::size_t addr, std::size_t n, double *out) const {
+    if (reader_.is_open()) {
+      reader_.read((addr - 1) * 8, n * sizeof(double), out);
+      if (swap_) {
+        for (std::size_t i = 0; i < n; ++i) {
+          auto *b = reinterpret_cast<std::uint8_t *>(out + i);
+          std::reverse(b, b + sizeof(double));
+        }
+      }
+      return;
+    }
+    if (!swap_) {
+      std::memcpy(out, data_ + (addr - 1) * 8, n * sizeof(double));
+      return;
+    }
+    for (std::size_t i = 0; i < n; ++i)
+      out[i] = word(addr + i);
+  }
+
+  void parse() {
+    constexpr std::size_t kRecord = 1024;
+    if (data_ == nullptr || size_ < kRecord)
+      throw DataLoadError("spk::Kernel: file too small for a DAF file record");
+    const std::string idword(reinterpret_cast<const char *>(data_), 8);
+    if (idword.compare(0, 7, "DAF/SPK") != 0 && idword != "NAIF/DAF")
+      throw DataLoadError("spk::Kernel: not an SPK file (id word '" + idword + "')");
+    const std::string fmt(reinterpret_cast<const char *>(data_) + 88, 8);
+    if (fmt == "LTL-IEEE")
+      swap_ = !host_little_endian();
+    else if (fmt == "BIG-IEEE")
+      swap_ = host_little_endian();
+    else
+      throw DataLoadError("spk::Kernel: unsupported binary format '" + fmt + "'");
+
+    const std::int32_t nd = read_at<std::int32_t>(8);
+    const std::int32_t ni = read_at<std::int32_t>(12);
+    if (nd != 2 || ni != 6)
+      throw DataLoadError("spk::Kernel: unexpected summary layout (ND/NI)");
+    const std::size_t summary_words = 2 + (6 + 1) / 2;
+    const std::size_t words = size_ / 8;
+
+    std::int32_t record = read_at<std::int32_t>(76);
+    std::size_t guard = size_ / kRecord;
+    while (record > 0) {
+      if (guard-- == 0 || static_cast<std::size_t>(record) * kRecord > size_)
+        throw DataLoadError("spk::Kernel: corrupt summary record chain");
+      const std::size_t off = static_cast<std::size_t>(record - 1) * kRecord;
+      const auto next = static_cast<std::int32_t>(read_at<double>(off));
+      const auto count = static_cast<std::size_t>(read_at<double>(off + 16));
+      if (3 + count * summary_words > kRecord / 8)
+        throw DataLoadError("spk::Kernel: corrupt summary record");
+
+      for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t s = off + 24 + i * summary_words * 8;
+        Segment seg;
+        seg.start_et = read_at<double>(s);
+        seg.end_et = read_at<double>(s + 8);
+        seg.target = read_at<std::int32_t>(s + 16);
+        seg.center = read_at<std::int32_t>(s + 20);
+        seg.frame = read_at<std::int32_t>(s + 24);
+        seg.type = read_at<std::int32_t>(s + 28);
+        seg.begin = static_cast<std::size_t>(read_at<std::int32_t>(s + 32));
+        seg.end = static_cast<std::size_t>(read_at<std::int32_t>(s + 36));
+        if (seg.begin == 0 || seg.end < seg.begin || seg.end > words)
+          throw DataLoadError("spk::Kernel: segment addresses outside the file");
+        if (seg.type == 2 || seg.type == 3)
+          read_directory(seg);
+        segments_.push_back(seg);
+      }
+      record = next;
+    }
+  }
+
+  void read_directory(Segment &seg) const {
+    if (seg.end - seg.begin + 1 < 4)
+      throw DataLoadError("spk::Kernel: truncated Chebyshev segment");
+    seg.init = word(seg.end - 3);
+    seg.interval = word(seg.end - 2);
+    seg.record_size = static_cast<std::size_t>(word(seg.end - 1));
+    seg.record_count = static_cast<std::size_t>(word(seg.end));
+    const std::size_t comps = seg.components();
+    if (!(seg.interval > 0.0) || seg.record_count == 0 || seg.record_size <= 2 ||
+        (seg.record_size - 2) % comps != 0 || seg.coefficients() > kMaxCoefficients ||
+        seg.record_count * seg.record_size > seg.end - seg.begin + 1 - 4)
+      throw DataLoadError("spk::Kernel: inconsistent Chebyshev segment directory");
+  }
+
+  /// Trim segments to `opts` and set up the record storage.
+  void apply(const LoadOptions &opts) {
+    if (!(opts.start_et <= opts.end_et))
+      throw InvalidArgumentError("spk::Kernel: retained span ends before it starts");
+
+    std::vector<std::int32_t> keep = opts.targets;
+    for (std::size_t i = 0; i < keep.size(); ++i) { // grows while walking the chains
+      for (const Segment &s : segments_) {
+        if (s.target == keep[i] && s.center != naif::SolarSystemBarycenter &&
+            std::find(keep.begin(), keep.end(), s.center) == keep.end())
+          keep.push_back(s.center);
+      }
+    }
+
+    std::vector<Segment> retained;
+    for (Segment s : segments_) {
+      if (!opts.targets.empty() && std::find(keep.begin(), keep.end(), s.target) == keep.end())
+        continue;
+      if (s.end_et < opts.start_et || s.start_et > opts.end_et)
+        continue;
+      if (s.record_count != 0)
+        clip(s, opts.start_et, opts.end_et);
+      retained.push_back(s);
+    }
+    segments_ = std::move(retained);
+
+    if (opts.cache_bytes != 0) {
+      storage_ = Storage::Paged;
+      cache_ = std::make_unique<detail::RecordCache>(opts.cache_bytes);
+    } else if (opts.resident) {
+      make_resident();
+    }
+  }
+
+  /// Link every body to the center of its last evaluable segment, keeping
+  /// all segments for that pair as candidates in file order.
+  void index_links() {
+    for (std::size_t i = 0; i < segments_.size(); ++i) {
+      const Segment &s = segments_[i];
+      if (s.record_count == 0)
+        continue;
+      const auto it = link_of_.find(s.target);
+      if (it == link_of_.end()) {
+        link_of_.emplace(s.target, links_.size());
+        links_.push_back({s.target, s.center, {i}});
+      } else if (links_[it->second].parent == s.center) {
+        links_[it->second].segments.push_back(i);
+      } else {
+        links_[it->second] = {s.target, s.center, {i}};
+      }
+    }
+  }
+
+  /// Restrict a Chebyshev segment to the records overlapping [t0, t1].
+  static void clip(Segment &s, double t0, double t1) {
+    const auto record_of = [&](double t) {
+      const double i = std::floor((t - s.init) / s.interval);
+      const double last = static_cast<double>(s.record_count - 1);
+      return static_cast<std::size_t>(std::min(std::max(i, 0.0), last));
+    };
+    const std::size_t first = record_of(std::max(t0, s.start_et));
+    const std::size_t last = record_of(std::min(t1, s.end_et));
+    s.begin += first * s.record_size;
+    s.init += static_cast<double>(first) * s.interval;
+    s.record_count = last - first + 1;
+    s.end = s.begin + s.record_count * s.record_size - 1;
+    s.start_et = std::max(s.start_et, t0);
+    s.end_et = std::min(s.end_et, t1);
+  }
+
+  /// Copy the retained records into `resident_` (native byte order) and
+  /// release the mapping. Segments that cannot be evaluated are dropped.
+  void make_resident() {
+    std::size_t words = 0;
+    for (const Segment &s : segments_)
+      words += s.record_count * s.record_size;
+    std::vector<double> copy(words);
+    std::vector<Segment> kept;
+    std::size_t at = 0;
+    for (Segment s : segments_) {
+      if (s.record_count == 0)
+        continue;
+      const std::size_t n = s.record_count * s.record_size;
+      read_words(s.begin, n, copy.data() + at);
+      s.begin = at + 1;
+      s.end = at + n;
+      at += n;
+      kept.push_back(s);
+    }
+    segments_ = std::move(kept);
+    resident_ = std::move(copy);
+    file_ = detail::MappedFile();
+    data_ = reinterpret_cast<const std::uint8_t *>(resident_.data());
+    size_ = resident_.size() * sizeof(double);
+    swap_ = false;
+    storage_ = Storage::Resident;
+  }
+
+  detail::MappedFile file_;
+  detail::FileReader reader_; ///< `Storage::Paged` from a path: record reads.
+  const std::uint8_t *data_ = nullptr;
+  std::size_t size_ = 0;
+  bool swap_ = false;
+  std::vector<Segment> segments_;
+  Storage storage_ = Storage::Mapped;
+  std::vector<double> resident_;
+  std::unique_ptr<detail::RecordCache> cache_;
+
+  struct Link {
+    std::int32_t body;
+    std::int32_t parent;
+    std::vector<std::size_t> segments; ///< Candidates, lowest precedence first.
+  };
+  std::vector<Link> links_;
+  std::unordered_map<std::int32_t, std::size_t> link_of_;
+};
+
+/**
+ * @brief Single-thread read cursor over a `Kernel` that remembers, per body
+ *        link, the last segment and coefficient record it used.
+ *
+ * A query whose epoch falls in the remembered record is evaluated from the
+ * cursor's own copy: no segment search, no record read and, for
+ * `Storage::Paged`, no cache lock. Monotone time scans therefore miss once
+ * per record (4 days for the Moon in DE440, 8–32 days for the planets).
+ *
+ * A cursor is cheap to create and must not be shared between threads; the
+ * kernel itself stays safe to share. Results are identical to
+ * `Kernel::state`.
+ */
+class Cursor {
+public:
+  explicit Cursor(const Kernel &kernel) : kernel_(&kernel), slots_(kernel.links_.size()) {}
+
+  /// State of `chain` at `et`; see `Kernel::state(const Chain &, double)`.
+  State state(const Chain &c, double et) {
+    State out{};
+    for (std::size_t i = 0; i < c.count_; ++i) {
+      const State s = evaluate(c.steps_[i].link, et);
+      const double sign = c.steps_[i].sign;
+      for (std::size_t k = 0; k < 3; ++k) {
+        out.position[k] += sign * s.position[k];
+        out.velocity[k] += sign * s.velocity[k];
+      }
+    }
+    return out;
+  }
+
+  /// Link evaluations served from the remembered record.
+  std::size_t hits() const noexcept { return hits_; }
+
+  /// Link evaluations that had to locate and copy a record.
+  std::size_t misses() const noexcept { return misses_; }
+
+  const Kernel &kernel() const noexcept { return *kernel_; }
+
+private:
+  static constexpr std::size_t kNone = static_cast<std::size_t>(-1);
+
+  struct Slot {
+    std::size_t candidate = kNone; ///< Position in the link's segment list.
+    double start = 0.0;            ///< Record span [start, end) in et.
+    double end = 0.0;
+    std::vector<double> words;
+  };
+
+  State evaluate(std::size_t link, double et) {
+    const Kernel::Link &l = kernel_->links_[link];
+    Slot &slot = slots_[link];
+    if (slot.candidate != kNone && et >= slot.start && et < slot.end &&
+        current(l, slot.candidate, et)) {
+      ++hits_;
+      return Kernel::evaluate(kernel_->segments_[l.segments[slot.candidate]], slot.words.data(),
+                              et);
+    }
+
+    ++misses_;
+    std::size_t j = l.segments.size();
+    while (j > 0 && !kernel_->segments_[l.segments[j - 1]].covers(et))
+      --j;
+    if (j-- == 0) {
+      throw OutOfRangeError("spk::Cursor: no segment for " + std::to_string(l.body) + " wrt " +
+                            std::to_string(l.parent) + " at et " + std::to_string(et));
+    }
+    const Segment &seg = kernel_->segments_[l.segments[j]];
+    const std::size_t index = seg.record_index(et);
+    slot.words.resize(seg.record_size);
+    kernel_->read_record(seg, index, slot.words.data());
+    slot.candidate = j;
+    slot.start = seg.init + static_cast<double>(index) * seg.interval;
+    slot.end = slot.start + seg.interval;
+    if (index + 1 == seg.record_count) // the last record also owns the end
+      slot.end = std::numeric_limits<double>::infinity();
+    if (index == 0)
+      slot.start = -std::numeric_limits<double>::infinity();
+    return Kernel::evaluate(seg, slot.words.data(), et);
+  }
+
+  /// True when candidate `j` is still the highest-precedence segment
+  /// covering `et` (later segments override earlier ones).
+  bool current(const Kernel::Link &l, std::size_t j, double et) const {
+    if (!kernel_->segments_[l.segments[j]].covers(et))
+      return false;
+    for (std::size_t k = j + 1; k < l.segments.size(); ++k) {
+      if (kernel_->segments_[l.segments[k]].covers(et))
+        return false;
+    }
+    return true;
+  }
+
+  const Kernel *kernel_;
+  std::vector<Slot> slots_;
+  std::size_t hits_ = 0;
+  std::size_t misses_ = 0;
+};
+
+} // namespace spk
+} // namespace siderust
@@ -56,6 +56,12 @@ public:
     return rad.to<qtty::Degree>();
   }
 
+  void altitude_at(const Geodetic &obs, span<const Time<TT, MJD>> mjds,
+                   span<qtty::Degree> out) const override {
+    detail::altitude_batch(detail::make_star_subject(star_.c_handle()), obs, mjds, out,
+                           "StarTarget::altitude_at(span)");
+  }
+
   std::vector<Period<TT, MJD>> above_threshold(const Geodetic &obs, const Period<TT, MJD> &window,
                                                qtty::Degree threshold,
                                                const SearchOptions &opts = {}) const override {
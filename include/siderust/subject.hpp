@@ -44,10 +44,17 @@
 #include "azimuth.hpp"
 #include "bodies.hpp"
 #include "body_target.hpp"
+#include "constants.hpp"
 #include "coordinates.hpp"
+#include "detail/aberration.hpp"
+#include "ephemeris.hpp"
 #include "ffi_core.hpp"
+#include "span.hpp"
 #include "target.hpp"
 #include "time.hpp"
+#include <cmath>
+#include <cstddef>
+#include <optional>
 #include <vector>
 
 namespace siderust {
@@ -99,7 +106,12 @@ public:
     siderust_subject_t s{};
     s.kind = SIDERUST_SUBJECT_KIND_T_STAR;
     s.star_handle = star.c_handle();
-    return Subject(s);
+    Subject out(s);
+    if (const auto &pos = star.fixed_position()) {
+      out.inner_.icrs_dir = pos->to_c();
+      out.fixed_star_ = true;
+    }
+    return out;
   }
 
   /**
@@ -133,8 +145,17 @@ public:
   SubjectKind kind() const { return static_cast<SubjectKind>(inner_.kind); }
   const siderust_subject_t &c_inner() const { return inner_; }
 
+  /// The ICRS direction of an `Icrs` subject or of a star without proper
+  /// motion (`Star::fixed_position()`); `std::nullopt` for other subjects.
+  std::optional<spherical::Direction<frames::ICRS>> fixed_direction() const {
+    if (inner_.kind == SIDERUST_SUBJECT_KIND_T_ICRS || fixed_star_)
+      return spherical::Direction<frames::ICRS>::from_c(inner_.icrs_dir);
+    return std::nullopt;
+  }
+
 private:
   siderust_subject_t inner_{};
+  bool fixed_star_ = false;
   explicit Subject(siderust_subject_t s) : inner_(s) {}
 };
 
@@ -153,6 +174,53 @@ inline qtty::Radian altitude_at(const Subject &subj, const Geodetic &obs,
   return qtty::Radian(out);
 }
 
+/**
+ * @brief Altitude (radians) of a subject at every instant of `mjds`.
+ *
+ * Writes `out[i] = altitude_at(subj, obs, mjds[i])`. The subject and observer
+ * are marshalled once for the whole series, and no allocation is performed,
+ * so the same output buffer can be reused across calls.
+ *
+ * @throws InvalidDimensionError if `out.size() != mjds.size()`.
+ *
+ * @code
+ * std::vector<Time<TT, MJD>> grid = ...;
+ * std::vector<qtty::Radian> alt(grid.size());
+ * altitude_at(Subject::body(Body::Sun), obs, grid, alt);
+ * @endcode
+ */
+inline void altitude_at(const Subject &subj, const Geodetic &obs, span<const Time<TT, MJD>> mjds,
+                        span<qtty::Radian> out) {
+  detail::altitude_batch(subj.c_inner(), obs, mjds, out, "altitude_at(Subject, span)");
+}
+
+/**
+ * @brief Altitude (radians) of a subject at every instant of `mjds`.
+ */
+inline std::vector<qtty::Radian> altitude_at(const Subject &subj, const Geodetic &obs,
+                                             span<const Time<TT, MJD>> mjds) {
+  return detail::altitude_batch(subj.c_inner(), obs, mjds, "altitude_at(Subject, span)");
+}
+
+/**
+ * @brief Altitude (radians) of a subject on the uniform grid
+ *        `start + i * step`, `i = 0 … count-1`.
+ *
+ * Instants are generated on the fly, so no time array is materialised.
+ */
+inline std::vector<qtty::Radian> altitude_at(const Subject &subj, const Geodetic &obs,
+                                             const Time<TT, MJD> &start, qtty::Day step,
+                                             std::size_t count) {
+  std::vector<qtty::Radian> out(count);
+  const double t0 = start.value();
+  const double dt = step.value();
+  detail::altitude_series(
+      subj.c_inner(), obs.to_c(), count,
+      [&](std::size_t i) { return t0 + static_cast<double>(i) * dt; }, out.data(),
+      "altitude_at(Subject, grid)");
+  return out;
+}
+
 /**
  * @brief Periods when a subject is above a threshold altitude.
  */
@@ -160,12 +228,8 @@ inline std::vector<Period<TT, MJD>> above_threshold(const Subject &subj, const G
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_above_threshold(subj.c_inner(), obs.to_c(), window.c_inner(),
-                                        threshold.value(), opts.to_c(), &ptr, &count),
-               "above_threshold(Subject)");
-  return detail::periods_from_c(ptr, count);
+  return detail::above_threshold_periods(subj.c_inner(), obs.to_c(), window, threshold, opts,
+                                         "above_threshold(Subject)");
 }
 
 /**
@@ -175,12 +239,8 @@ inline std::vector<Period<TT, MJD>> below_threshold(const Subject &subj, const G
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree threshold,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_below_threshold(subj.c_inner(), obs.to_c(), window.c_inner(),
-                                        threshold.value(), opts.to_c(), &ptr, &count),
-               "below_threshold(Subject)");
-  return detail::periods_from_c(ptr, count);
+  return detail::below_threshold_periods(subj.c_inner(), obs.to_c(), window, threshold, opts,
+                                         "below_threshold(Subject)");
 }
 
 /**
@@ -189,12 +249,8 @@ inline std::vector<Period<TT, MJD>> below_threshold(const Subject &subj, const G
 inline std::vector<CrossingEvent> crossings(const Subject &subj, const Geodetic &obs,
                                             const Period<TT, MJD> &window, qtty::Degree threshold,
                                             const SearchOptions &opts = {}) {
-  siderust_crossing_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_crossings(subj.c_inner(), obs.to_c(), window.c_inner(), threshold.value(),
-                                  opts.to_c(), &ptr, &count),
-               "crossings(Subject)");
-  return detail::crossings_from_c(ptr, count);
+  return detail::crossing_events(subj.c_inner(), obs.to_c(), window, threshold, opts,
+                                 "crossings(Subject)");
 }
 
 /**
@@ -203,12 +259,8 @@ inline std::vector<CrossingEvent> crossings(const Subject &subj, const Geodetic
 inline std::vector<CulminationEvent> culminations(const Subject &subj, const Geodetic &obs,
                                                   const Period<TT, MJD> &window,
                                                   const SearchOptions &opts = {}) {
-  siderust_culmination_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_culminations(subj.c_inner(), obs.to_c(), window.c_inner(), opts.to_c(),
-                                     &ptr, &count),
-               "culminations(Subject)");
-  return detail::culminations_from_c(ptr, count);
+  return detail::culmination_events(subj.c_inner(), obs.to_c(), window, opts,
+                                    "culminations(Subject)");
 }
 
 /**
@@ -218,13 +270,8 @@ inline std::vector<Period<TT, MJD>> altitude_ranges(const Subject &subj, const G
                                                     const Period<TT, MJD> &window,
                                                     qtty::Degree min_alt, qtty::Degree max_alt,
                                                     const SearchOptions &opts = {}) {
-  tempoch_period_mjd_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_altitude_ranges(subj.c_inner(), obs.to_c(), window.c_inner(),
-                                        min_alt.value(), max_alt.value(), opts.to_c(), &ptr,
-                                        &count),
-               "altitude_ranges(Subject)");
-  return detail::periods_from_c(ptr, count);
+  return detail::altitude_range_periods(subj.c_inner(), obs.to_c(), window, min_alt, max_alt, opts,
+                                        "altitude_ranges(Subject)");
 }
 
 /**
@@ -244,12 +291,8 @@ inline std::vector<AzimuthCrossingEvent> azimuth_crossings(const Subject &subj,
                                                            const Period<TT, MJD> &window,
                                                            qtty::Degree bearing,
                                                            const SearchOptions &opts = {}) {
-  siderust_azimuth_crossing_event_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_azimuth_crossings(subj.c_inner(), obs.to_c(), window.c_inner(),
-                                          bearing.value(), opts.to_c(), &ptr, &count),
-               "azimuth_crossings(Subject)");
-  return detail::az_crossings_from_c(ptr, count);
+  return detail::azimuth_crossing_events(subj.c_inner(), obs.to_c(), window, bearing, opts,
+                                         "azimuth_crossings(Subject)");
 }
 
 /**
@@ -258,12 +301,8 @@ inline std::vector<AzimuthCrossingEvent> azimuth_crossings(const Subject &subj,
 inline std::vector<AzimuthExtremum> azimuth_extrema(const Subject &subj, const Geodetic &obs,
                                                     const Period<TT, MJD> &window,
                                                     const SearchOptions &opts = {}) {
-  siderust_azimuth_extremum_t *ptr = nullptr;
-  uintptr_t count = 0;
-  check_status(siderust_azimuth_extrema(subj.c_inner(), obs.to_c(), window.c_inner(), opts.to_c(),
-                                        &ptr, &count),
-               "azimuth_extrema(Subject)");
-  return detail::az_extrema_from_c(ptr, count);
+  return detail::azimuth_extremum_events(subj.c_inner(), obs.to_c(), window, opts,
+                                         "azimuth_extrema(Subject)");
 }
 
 /**
@@ -273,13 +312,431 @@ inline std::vector<Period<TT, MJD>> in_azimuth_range(const Subject &subj, const
                                                      const Period<TT, MJD> &window,
                                                      qtty::Degree min_deg, qtty::Degree max_deg,
                                                      const SearchOptions &opts = {}) {
+  return detail::in_azimuth_range_periods(subj.c_inner(), obs.to_c(), window, min_deg, max_deg,
+                                          opts, "in_azimuth_range(Subject)");
+}
+
+// ============================================================================
+// Result sinks
+// ============================================================================
+//
+// Each search above also accepts a `sink` in place of its return value. A
+// sink is either a `std::vector<T>`, which is cleared and refilled so its
+// capacity is reused across queries, or any callable invoked once per result
+// with a `const T &`. On the serial path results are handed to the sink
+// straight from the FFI buffer, so a warmed-up buffer or a callback performs
+// no C++ heap allocation per query. With `SearchOptions::parallelism > 1`
+// chunk results are still collected internally before being emitted.
+
+/**
+ * @brief Periods when a subject is above a threshold altitude, into `sink`.
+ */
+template <typename Sink, typename = detail::enable_if_sink_t<Period<TT, MJD>, Sink>>
+inline void above_threshold(const Subject &subj, const Geodetic &obs,
+                            const Period<TT, MJD> &window, qtty::Degree threshold, Sink &&sink,
+                            const SearchOptions &opts = {}) {
+  auto out = detail::make_sink<Period<TT, MJD>>(sink);
+  detail::above_threshold_periods(subj.c_inner(), obs.to_c(), window, threshold, opts,
+                                  "above_threshold(Subject, sink)", out);
+}
+
+/**
+ * @brief Periods when a subject is below a threshold altitude, into `sink`.
+ */
+template <typename Sink, typename = detail::enable_if_sink_t<Period<TT, MJD>, Sink>>
+inline void below_threshold(const Subject &subj, const Geodetic &obs,
+                            const Period<TT, MJD> &window, qtty::Degree threshold, Sink &&sink,
+                            const SearchOptions &opts = {}) {
+  auto out = detail::make_sink<Period<TT, MJD>>(sink);
+  detail::below_threshold_periods(subj.c_inner(), obs.to_c(), window, threshold, opts,
+                                  "below_threshold(Subject, sink)", out);
+}
+
+/**
+ * @brief Threshold-crossing events for a subject, into `sink`.
+ */
+template <typename Sink, typename = detail::enable_if_sink_t<CrossingEvent, Sink>>
+inline void crossings(const Subject &subj, const Geodetic &obs, const Period<TT, MJD> &window,
+                      qtty::Degree threshold, Sink &&sink, const SearchOptions &opts = {}) {
+  auto out = detail::make_sink<CrossingEvent>(sink);
+  detail::crossing_events(subj.c_inner(), obs.to_c(), window, threshold, opts,
+                          "crossings(Subject, sink)", out);
+}
+
+/**
+ * @brief Culmination events for a subject, into `sink`.
+ */
+template <typename Sink, typename = detail::enable_if_sink_t<CulminationEvent, Sink>>
+inline void culminations(const Subject &subj, const Geodetic &obs, const Period<TT, MJD> &window,
+                         Sink &&sink, const SearchOptions &opts = {}) {
+  auto out = detail::make_sink<CulminationEvent>(sink);
+  detail::culmination_events(subj.c_inner(), obs.to_c(), window, opts,
+                             "culminations(Subject, sink)", out);
+}
+
+/**
+ * @brief Periods when a subject's altitude is within [min, max], into `sink`.
+ */
+template <typename Sink, typename = detail::enable_if_sink_t<Period<TT, MJD>, Sink>>
+inline void altitude_ranges(const Subject &subj, const Geodetic &obs,
+                            const Period<TT, MJD> &window, qtty::Degree min_alt,
+                            qtty::Degree max_alt, Sink &&sink, const SearchOptions &opts = {}) {
+  auto out = detail::make_sink<Period<TT, MJD>>(sink);
+  detail::altitude_range_periods(subj.c_inner(), obs.to_c(), window, min_alt, max_alt, opts,
+                                 "altitude_ranges(Subject, sink)", out);
+}
+
+/**
+ * @brief Azimuth bearing-crossing events for a subject, into `sink`.
+ */
+template <typename Sink, typename = detail::enable_if_sink_t<AzimuthCrossingEvent, Sink>>
+inline void azimuth_crossings(const Subject &subj, const Geodetic &obs,
+                              const Period<TT, MJD> &window, qtty::Degree bearing, Sink &&sink,
+                              const SearchOptions &opts = {}) {
+  auto out = detail::make_sink<AzimuthCrossingEvent>(sink);
+  detail::azimuth_crossing_events(subj.c_inner(), obs.to_c(), window, bearing, opts,
+                                  "azimuth_crossings(Subject, sink)", out);
+}
+
+/**
+ * @brief Azimuth extrema for a subject, into `sink`.
+ */
+template <typename Sink, typename = detail::enable_if_sink_t<AzimuthExtremum, Sink>>
+inline void azimuth_extrema(const Subject &subj, const Geodetic &obs,
+                            const Period<TT, MJD> &window, Sink &&sink,
+                            const SearchOptions &opts = {}) {
+  auto out = detail::make_sink<AzimuthExtremum>(sink);
+  detail::azimuth_extremum_events(subj.c_inner(), obs.to_c(), window, opts,
+                                  "azimuth_extrema(Subject, sink)", out);
+}
+
+/**
+ * @brief Periods when a subject's azimuth is within [min_deg, max_deg], into
+ *        `sink`.
+ */
+template <typename Sink, typename = detail::enable_if_sink_t<Period<TT, MJD>, Sink>>
+inline void in_azimuth_range(const Subject &subj, const Geodetic &obs,
+                             const Period<TT, MJD> &window, qtty::Degree min_deg,
+                             qtty::Degree max_deg, Sink &&sink, const SearchOptions &opts = {}) {
+  auto out = detail::make_sink<Period<TT, MJD>>(sink);
+  detail::in_azimuth_range_periods(subj.c_inner(), obs.to_c(), window, min_deg, max_deg, opts,
+                                   "in_azimuth_range(Subject, sink)", out);
+}
+
+// ============================================================================
+// Zero-copy result views
+// ============================================================================
+//
+// The `_view` searches return the FFI-allocated result buffer itself, owned
+// by an `FfiArray` and converted element by element on access, so no copy is
+// made. Each is exactly one FFI search over the whole window:
+// `SearchOptions::parallelism` is ignored, because a parallel search stitches
+// several buffers and has no single buffer to hand out.
+
+/**
+ * @brief Periods when a subject is above a threshold altitude, as a view.
+ */
+inline PeriodList above_threshold_view(const Subject &subj, const Geodetic &obs,
+                                       const Period<TT, MJD> &window, qtty::Degree threshold,
+                                       const SearchOptions &opts = {}) {
+  tempoch_period_mjd_t *ptr = nullptr;
+  uintptr_t count = 0;
+  check_status(siderust_above_threshold(subj.c_inner(), obs.to_c(), window.c_inner(),
+                                        threshold.value(), opts.to_c(), &ptr, &count),
+               "above_threshold_view(Subject)");
+  return PeriodList(ptr, count);
+}
+
+/**
+ * @brief Periods when a subject is below a threshold altitude, as a view.
+ */
+inline PeriodList below_threshold_view(const Subject &subj, const Geodetic &obs,
+                                       const Period<TT, MJD> &window, qtty::Degree threshold,
+                                       const SearchOptions &opts = {}) {
   tempoch_period_mjd_t *ptr = nullptr;
   uintptr_t count = 0;
-  check_status(siderust_in_azimuth_range(subj.c_inner(), obs.to_c(), window.c_inner(),
-                                         min_deg.value(), max_deg.value(), opts.to_c(), &ptr,
-                                         &count),
-               "in_azimuth_range(Subject)");
-  return detail::periods_from_c(ptr, count);
+  check_status(siderust_below_threshold(subj.c_inner(), obs.to_c(), window.c_inner(),
+                                        threshold.value(), opts.to_c(), &ptr, &count),
+               "below_threshold_view(Subject)");
+  return PeriodList(ptr, count);
+}
+
+/**
+ * @brief Threshold-crossing events for a subject, as a view.
+ */
+inline CrossingList crossings_view(const Subject &subj, const Geodetic &obs,
+                                   const Period<TT, MJD> &window, qtty::Degree threshold,
+                                   const SearchOptions &opts = {}) {
+  siderust_crossing_event_t *ptr = nullptr;
+  uintptr_t count = 0;
+  check_status(siderust_crossings(subj.c_inner(), obs.to_c(), window.c_inner(),
+                                  threshold.value(), opts.to_c(), &ptr, &count),
+               "crossings_view(Subject)");
+  return CrossingList(ptr, count);
+}
+
+/**
+ * @brief Culmination events for a subject, as a view.
+ */
+inline CulminationList culminations_view(const Subject &subj, const Geodetic &obs,
+                                         const Period<TT, MJD> &window,
+                                         const SearchOptions &opts = {}) {
+  siderust_culmination_event_t *ptr = nullptr;
+  uintptr_t count = 0;
+  check_status(siderust_culminations(subj.c_inner(), obs.to_c(), window.c_inner(), opts.to_c(),
+                                     &ptr, &count),
+               "culminations_view(Subject)");
+  return CulminationList(ptr, count);
+}
+
+/**
+ * @brief Azimuth-bearing crossing events for a subject, as a view.
+ */
+inline AzimuthCrossingList azimuth_crossings_view(const Subject &subj, const Geodetic &obs,
+                                                  const Period<TT, MJD> &window,
+                                                  qtty::Degree bearing,
+                                                  const SearchOptions &opts = {}) {
+  siderust_azimuth_crossing_event_t *ptr = nullptr;
+  uintptr_t count = 0;
+  check_status(siderust_azimuth_crossings(subj.c_inner(), obs.to_c(), window.c_inner(),
+                                          bearing.value(), opts.to_c(), &ptr, &count),
+               "azimuth_crossings_view(Subject)");
+  return AzimuthCrossingList(ptr, count);
+}
+
+/**
+ * @brief Azimuth extrema for a subject, as a view.
+ */
+inline AzimuthExtremumList azimuth_extrema_view(const Subject &subj, const Geodetic &obs,
+                                                const Period<TT, MJD> &window,
+                                                const SearchOptions &opts = {}) {
+  siderust_azimuth_extremum_t *ptr = nullptr;
+  uintptr_t count = 0;
+  check_status(siderust_azimuth_extrema(subj.c_inner(), obs.to_c(), window.c_inner(),
+                                        opts.to_c(), &ptr, &count),
+               "azimuth_extrema_view(Subject)");
+  return AzimuthExtremumList(ptr, count);
+}
+
+// ============================================================================
+// Station networks (multiple observers)
+// ============================================================================
+
+/**
+ * @brief Altitude (radians) of a subject at one instant from every site of a
+ *        station network.
+ *
+ * Writes `out[i] = altitude_at(subj, observers[i], mjd)`, one FFI call per
+ * site (see `detail::per_site` for what is and is not shared).
+ *
+ * @throws InvalidDimensionError if `out.size() != observers.size()`.
+ */
+inline void altitude_at(const Subject &subj, span<const Geodetic> observers,
+                        const Time<TT, MJD> &mjd, span<qtty::Radian> out) {
+  constexpr const char *op = "altitude_at(Subject, observers)";
+  detail::check_batch_size(observers.size(), out.size(), op);
+  const siderust_subject_t &c_subj = subj.c_inner();
+  double alt = 0.0;
+  for (std::size_t i = 0; i < observers.size(); ++i) {
+    check_status(siderust_altitude_at(c_subj, observers[i].to_c(), mjd.value(), &alt), op);
+    out[i] = qtty::Radian(alt);
+  }
+}
+
+/**
+ * @brief Altitude (radians) of a subject at one instant from every site of a
+ *        station network.
+ */
+inline std::vector<qtty::Radian> altitude_at(const Subject &subj, span<const Geodetic> observers,
+                                             const Time<TT, MJD> &mjd) {
+  std::vector<qtty::Radian> out(observers.size());
+  altitude_at(subj, observers, mjd, span<qtty::Radian>(out));
+  return out;
+}
+
+/**
+ * @brief Periods when a subject is above a threshold altitude, per site.
+ *
+ * `result[i]` holds the periods for `observers[i]`.
+ */
+inline std::vector<std::vector<Period<TT, MJD>>>
+above_threshold(const Subject &subj, span<const Geodetic> observers,
+                const Period<TT, MJD> &window, qtty::Degree threshold,
+                const SearchOptions &opts = {}) {
+  const siderust_subject_t &c_subj = subj.c_inner();
+  return detail::per_site(observers, [&](const Geodetic &obs) {
+    return detail::above_threshold_periods(c_subj, obs.to_c(), window, threshold, opts,
+                                           "above_threshold(Subject, observers)");
+  });
+}
+
+/**
+ * @brief Periods when a subject is below a threshold altitude, per site.
+ *
+ * `result[i]` holds the periods for `observers[i]`.
+ */
+inline std::vector<std::vector<Period<TT, MJD>>>
+below_threshold(const Subject &subj, span<const Geodetic> observers,
+                const Period<TT, MJD> &window, qtty::Degree threshold,
+                const SearchOptions &opts = {}) {
+  const siderust_subject_t &c_subj = subj.c_inner();
+  return detail::per_site(observers, [&](const Geodetic &obs) {
+    return detail::below_threshold_periods(c_subj, obs.to_c(), window, threshold, opts,
+                                           "below_threshold(Subject, observers)");
+  });
+}
+
+/**
+ * @brief Threshold-crossing events for a subject, per site.
+ *
+ * `result[i]` holds the events for `observers[i]`.
+ */
+inline std::vector<std::vector<CrossingEvent>>
+crossings(const Subject &subj, span<const Geodetic> observers, const Period<TT, MJD> &window,
+          qtty::Degree threshold, const SearchOptions &opts = {}) {
+  const siderust_subject_t &c_subj = subj.c_inner();
+  return detail::per_site(observers, [&](const Geodetic &obs) {
+    return detail::crossing_events(c_subj, obs.to_c(), window, threshold, opts,
+                                   "crossings(Subject, observers)");
+  });
+}
+
+// ============================================================================
+// Multi-subject snapshot
+// ============================================================================
+
+namespace detail {
+
+/// TT JD of a TT MJD instant.
+inline Time<TT, JD> mjd_to_jd(const Time<TT, MJD> &mjd) {
+  return Time<TT, JD>(mjd.value() + 2400000.5);
+}
+
+/**
+ * @brief Azimuth and altitude of a (north, east, up) vector of any length.
+ *
+ * Uses the `spherical::Direction<frames::Horizontal>` convention:
+ * `x = cos(alt)·cos(az)`, `y = cos(alt)·sin(az)`, `z = sin(alt)`, with
+ * azimuth measured from North towards East.
+ */
+inline spherical::Direction<frames::Horizontal> horizontal_direction(double x, double y,
+                                                                     double z) {
+  constexpr double RAD2DEG = 180.0 / constants::pi;
+  double az = std::atan2(y, x) * RAD2DEG;
+  if (az < 0.0)
+    az += 360.0;
+  const double alt = std::atan2(z, std::sqrt(x * x + y * y)) * RAD2DEG;
+  return spherical::Direction<frames::Horizontal>(qtty::Degree(az), qtty::Degree(alt));
+}
+
+} // namespace detail
+
+/**
+ * @brief Altitude and azimuth of many ICRS directions at one instant.
+ *
+ * Writes `out[i]` = (azimuth, altitude) of `dirs[i]` as seen from `obs` at
+ * `mjd`, projected through one `HorizontalProjector<frames::ICRS>`: the
+ * per-instant terms (precession-nutation, Earth rotation angle, polar
+ * motion, observer frame) are sampled once and every direction costs a 3×3
+ * product and two `atan2`.
+ *
+ * The result equals `dirs[i].to_horizontal(jd, obs)` to ≲1e-9°. Like that
+ * method it is the geometric rotation of a direction at infinite distance:
+ * annual and diurnal aberration and atmospheric refraction are **not**
+ * applied (they are not rotations of the sky, so no shared matrix can carry
+ * them). The FFI's `altitude_at(Subject::icrs(dir), …)` applies annual
+ * aberration (≤ 20.5″); the `Subject` overload below applies it too.
+ *
+ * @throws InvalidDimensionError if `out.size() != dirs.size()`.
+ */
+inline void horizontal_at(span<const spherical::Direction<frames::ICRS>> dirs,
+                          const Geodetic &obs, const Time<TT, MJD> &mjd,
+                          span<spherical::Direction<frames::Horizontal>> out) {
+  detail::check_batch_size(dirs.size(), out.size(), "horizontal_at(ICRS)");
+  if (dirs.empty())
+    return;
+  const HorizontalProjector<frames::ICRS> proj(obs, detail::mjd_to_jd(mjd));
+  proj.project(dirs, out);
+}
+
+/**
+ * @brief Altitude and azimuth of many ICRS directions at one instant.
+ */
+inline std::vector<spherical::Direction<frames::Horizontal>>
+horizontal_at(span<const spherical::Direction<frames::ICRS>> dirs, const Geodetic &obs,
+              const Time<TT, MJD> &mjd) {
+  std::vector<spherical::Direction<frames::Horizontal>> out(dirs.size());
+  horizontal_at(dirs, obs, mjd, span<spherical::Direction<frames::Horizontal>>(out));
+  return out;
+}
+
+/**
+ * @brief Altitude and azimuth of a list of subjects at one instant.
+ *
+ * Subjects with a fixed ICRS direction — `Icrs` subjects and stars created
+ * without proper motion — share one `HorizontalProjector` and one
+ * evaluation of the Earth's barycentric velocity: each direction is
+ * corrected for annual aberration in C++ and rotated by the sampled matrix,
+ * matching `altitude_at` / `azimuth_at` for the same subject. Bodies,
+ * catalog stars, stars with proper motion and generic targets carry
+ * time-dependent apparent places (light-time, proper motion, parallax) and
+ * are evaluated individually through `altitude_at` / `azimuth_at`; mixed
+ * lists are supported.
+ *
+ * @throws InvalidDimensionError if `out.size() != subjects.size()`.
+ *
+ * @code
+ * std::vector<Subject> targets = ...;
+ * std::vector<spherical::direction::Horizontal> altaz(targets.size());
+ * horizontal_at(targets, obs, now, altaz);
+ * @endcode
+ */
+inline void horizontal_at(span<const Subject> subjects, const Geodetic &obs,
+                          const Time<TT, MJD> &mjd,
+                          span<spherical::Direction<frames::Horizontal>> out) {
+  constexpr const char *op = "horizontal_at(Subject)";
+  detail::check_batch_size(subjects.size(), out.size(), op);
+  const siderust_geodetic_t c_obs = obs.to_c();
+  const double t = mjd.value();
+
+  // Per-instant terms of the fixed directions, built on first use.
+  std::optional<HorizontalProjector<frames::ICRS>> proj;
+  double v_icrs[3] = {};
+  for (std::size_t i = 0; i < subjects.size(); ++i) {
+    if (const auto dir = subjects[i].fixed_direction()) {
+      if (!proj) {
+        const Time<TT, JD> jd = detail::mjd_to_jd(mjd);
+        proj.emplace(obs, jd);
+        double v[3];
+        ephemeris::detail::earth_barycentric_velocity(jd, v);
+        FrameRotation<frames::EclipticMeanJ2000, frames::ICRS>::at(jd).apply_xyz(v, v_icrs, 1);
+      }
+      const auto u = dir->to_cartesian();
+      const double p[3] = {u.x, u.y, u.z};
+      double a[3];
+      detail::aberrate(p, v_icrs, a);
+      const auto h = proj->project(cartesian::Direction<frames::ICRS>(a[0], a[1], a[2]));
+      out[i] = detail::horizontal_direction(h.x, h.y, h.z);
+      continue;
+    }
+    const siderust_subject_t &s = subjects[i].c_inner();
+    double alt_rad = 0.0;
+    double az_deg = 0.0;
+    check_status(siderust_altitude_at(s, c_obs, t, &alt_rad), op);
+    check_status(siderust_azimuth_at(s, c_obs, t, &az_deg), op);
+    out[i] = spherical::Direction<frames::Horizontal>(
+        qtty::Degree(az_deg), qtty::Degree(alt_rad * (180.0 / constants::pi)));
+  }
+}
+
+/**
+ * @brief Altitude and azimuth of a list of subjects at one instant.
+ */
+inline std::vector<spherical::Direction<frames::Horizontal>>
+horizontal_at(span<const Subject> subjects, const Geodetic &obs, const Time<TT, MJD> &mjd) {
+  std::vector<spherical::Direction<frames::Horizontal>> out(subjects.size());
+  horizontal_at(subjects, obs, mjd, span<spherical::Direction<frames::Horizontal>>(out));
+  return out;
 }
 
 } // namespace siderust
@@ -251,19 +251,21 @@ public:
     return qtty::Radian(out).to<qtty::Degree>();
   }
 
+  /// Altitude (degrees) at every instant of `mjds`, marshalling once.
+  void altitude_at(const Geodetic &obs, span<const Time<TT, MJD>> mjds,
+                   span<qtty::Degree> out) const override {
+    detail::altitude_batch(detail::make_generic_target_subject(handle_), obs, mjds, out,
+                           "Target::altitude_at(span)");
+  }
+
   /**
    * @brief Find periods when the target is above a threshold altitude.
    */
   std::vector<Period<TT, MJD>> above_threshold(const Geodetic &obs, const Period<TT, MJD> &window,
                                                qtty::Degree threshold,
                                                const SearchOptions &opts = {}) const override {
-    tempoch_period_mjd_t *ptr = nullptr;
-    uintptr_t count = 0;
-    check_status(siderust_above_threshold(detail::make_generic_target_subject(handle_), obs.to_c(),
-                                          window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                          &count),
-                 "Target::above_threshold");
-    return detail_periods_from_c(ptr, count);
+    return detail::above_threshold_periods(detail::make_generic_target_subject(handle_), obs.to_c(),
+                                           window, threshold, opts, "Target::above_threshold");
   }
 
   /**
@@ -272,13 +274,8 @@ public:
   std::vector<Period<TT, MJD>> below_threshold(const Geodetic &obs, const Period<TT, MJD> &window,
                                                qtty::Degree threshold,
                                                const SearchOptions &opts = {}) const override {
-    tempoch_period_mjd_t *ptr = nullptr;
-    uintptr_t count = 0;
-    check_status(siderust_below_threshold(detail::make_generic_target_subject(handle_), obs.to_c(),
-                                          window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                          &count),
-                 "Target::below_threshold");
-    return detail_periods_from_c(ptr, count);
+    return detail::below_threshold_periods(detail::make_generic_target_subject(handle_), obs.to_c(),
+                                           window, threshold, opts, "Target::below_threshold");
   }
 
   /**
@@ -287,12 +284,8 @@ public:
   std::vector<CrossingEvent> crossings(const Geodetic &obs, const Period<TT, MJD> &window,
                                        qtty::Degree threshold,
                                        const SearchOptions &opts = {}) const override {
-    siderust_crossing_event_t *ptr = nullptr;
-    uintptr_t count = 0;
-    check_status(siderust_crossings(detail::make_generic_target_subject(handle_), obs.to_c(),
-                                    window.c_inner(), threshold.value(), opts.to_c(), &ptr, &count),
-                 "Target::crossings");
-    return detail::crossings_from_c(ptr, count);
+    return detail::crossing_events(detail::make_generic_target_subject(handle_), obs.to_c(), window,
+                                   threshold, opts, "Target::crossings");
   }
 
   /**
@@ -300,12 +293,8 @@ public:
    */
   std::vector<CulminationEvent> culminations(const Geodetic &obs, const Period<TT, MJD> &window,
                                              const SearchOptions &opts = {}) const override {
-    siderust_culmination_event_t *ptr = nullptr;
-    uintptr_t count = 0;
-    check_status(siderust_culminations(detail::make_generic_target_subject(handle_), obs.to_c(),
-                                       window.c_inner(), opts.to_c(), &ptr, &count),
-                 "Target::culminations");
-    return detail::culminations_from_c(ptr, count);
+    return detail::culmination_events(detail::make_generic_target_subject(handle_), obs.to_c(),
+                                      window, opts, "Target::culminations");
   }
 
   // ------------------------------------------------------------------
@@ -329,13 +318,8 @@ public:
   std::vector<AzimuthCrossingEvent>
   azimuth_crossings(const Geodetic &obs, const Period<TT, MJD> &window, qtty::Degree bearing,
                     const SearchOptions &opts = {}) const override {
-    siderust_azimuth_crossing_event_t *ptr = nullptr;
-    uintptr_t count = 0;
-    check_status(siderust_azimuth_crossings(detail::make_generic_target_subject(handle_),
-                                            obs.to_c(), window.c_inner(), bearing.value(),
-                                            opts.to_c(), &ptr, &count),
-                 "Target::azimuth_crossings");
-    return detail::az_crossings_from_c(ptr, count);
+    return detail::azimuth_crossing_events(detail::make_generic_target_subject(handle_), obs.to_c(),
+                                           window, bearing, opts, "Target::azimuth_crossings");
   }
 
   /// Access the underlying C handle (advanced use).
@@ -354,19 +338,6 @@ private:
   spherical::direction::ICRS m_icrs_;
   std::string label_;
   SiderustGenericTarget *handle_ = nullptr;
-
-  /// Build a Period<TT, MJD> vector from a tempoch_period_mjd_t* array.
-  static std::vector<Period<TT, MJD>> detail_periods_from_c(tempoch_period_mjd_t *ptr,
-                                                            uintptr_t count) {
-    std::vector<Period<TT, MJD>> result;
-    result.reserve(count);
-    for (uintptr_t i = 0; i < count; ++i) {
-      result.push_back(
-          Period<TT, MJD>(Time<TT, MJD>(ptr[i].start_mjd), Time<TT, MJD>(ptr[i].end_mjd)));
-    }
-    siderust_periods_free(ptr, count);
-    return result;
-  }
 };
 
 // ============================================================================
@@ -508,49 +479,40 @@ public:
     return qtty::Radian(out).to<qtty::Degree>();
   }
 
+  /// Altitude (degrees) at every instant of `mjds`, marshalling once.
+  void altitude_at(const Geodetic &obs, span<const Time<TT, MJD>> mjds,
+                   span<qtty::Degree> out) const override {
+    detail::altitude_batch(detail::make_generic_target_subject(handle_), obs, mjds, out,
+                           "ProperMotionTarget::altitude_at(span)");
+  }
+
   std::vector<Period<TT, MJD>> above_threshold(const Geodetic &obs, const Period<TT, MJD> &window,
                                                qtty::Degree threshold,
                                                const SearchOptions &opts = {}) const override {
-    tempoch_period_mjd_t *ptr = nullptr;
-    uintptr_t count = 0;
-    check_status(siderust_above_threshold(detail::make_generic_target_subject(handle_), obs.to_c(),
-                                          window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                          &count),
-                 "ProperMotionTarget::above_threshold");
-    return detail_periods_from_c(ptr, count);
+    return detail::above_threshold_periods(detail::make_generic_target_subject(handle_), obs.to_c(),
+                                           window, threshold, opts,
+                                           "ProperMotionTarget::above_threshold");
   }
 
   std::vector<Period<TT, MJD>> below_threshold(const Geodetic &obs, const Period<TT, MJD> &window,
                                                qtty::Degree threshold,
                                                const SearchOptions &opts = {}) const override {
-    tempoch_period_mjd_t *ptr = nullptr;
-    uintptr_t count = 0;
-    check_status(siderust_below_threshold(detail::make_generic_target_subject(handle_), obs.to_c(),
-                                          window.c_inner(), threshold.value(), opts.to_c(), &ptr,
-                                          &count),
-                 "ProperMotionTarget::below_threshold");
-    return detail_periods_from_c(ptr, count);
+    return detail::below_threshold_periods(detail::make_generic_target_subject(handle_), obs.to_c(),
+                                           window, threshold, opts,
+                                           "ProperMotionTarget::below_threshold");
   }
 
   std::vector<CrossingEvent> crossings(const Geodetic &obs, const Period<TT, MJD> &window,
                                        qtty::Degree threshold,
                                        const SearchOptions &opts = {}) const override {
-    siderust_crossing_event_t *ptr = nullptr;
-    uintptr_t count = 0;
-    check_status(siderust_crossings(detail::make_generic_target_subject(handle_), obs.to_c(),
-                                    window.c_inner(), threshold.value(), opts.to_c(), &ptr, &count),
-                 "ProperMotionTarget::crossings");
-    return detail::crossings_from_c(ptr, count);
+    return detail::crossing_events(detail::make_generic_target_subject(handle_), obs.to_c(), window,
+                                   threshold, opts, "ProperMotionTarget::crossings");
   }
 
   std::vector<CulminationEvent> culminations(const Geodetic &obs, const Period<TT, MJD> &window,
                                              const SearchOptions &opts = {}) const override {
-    siderust_culmination_event_t *ptr = nullptr;
-    uintptr_t count = 0;
-    check_status(siderust_culminations(detail::make_generic_target_subject(handle_), obs.to_c(),
-                                       window.c_inner(), opts.to_c(), &ptr, &count),
-                 "ProperMotionTarget::culminations");
-    return detail::culminations_from_c(ptr, count);
+    return detail::culmination_events(detail::make_generic_target_subject(handle_), obs.to_c(),
+                                      window, opts, "ProperMotionTarget::culminations");
   }
 
   // -- Azimuth tracking (implements Trackable) -------------------------------
@@ -566,13 +528,9 @@ public:
   std::vector<AzimuthCrossingEvent>
   azimuth_crossings(const Geodetic &obs, const Period<TT, MJD> &window, qtty::Degree bearing,
                     const SearchOptions &opts = {}) const override {
-    siderust_azimuth_crossing_event_t *ptr = nullptr;
-    uintptr_t count = 0;
-    check_status(siderust_azimuth_crossings(detail::make_generic_target_subject(handle_),
-                                            obs.to_c(), window.c_inner(), bearing.value(),
-                                            opts.to_c(), &ptr, &count),
-                 "ProperMotionTarget::azimuth_crossings");
-    return detail::az_crossings_from_c(ptr, count);
+    return detail::azimuth_crossing_events(detail::make_generic_target_subject(handle_), obs.to_c(),
+                                           window, bearing, opts,
+                                           "ProperMotionTarget::azimuth_crossings");
   }
 
 private:
@@ -581,18 +539,6 @@ private:
   ProperMotion proper_motion_;
   std::string label_;
   SiderustGenericTarget *handle_ = nullptr;
-
-  static std::vector<Period<TT, MJD>> detail_periods_from_c(tempoch_period_mjd_t *ptr,
-                                                            uintptr_t count) {
-    std::vector<Period<TT, MJD>> result;
-    result.reserve(count);
-    for (uintptr_t i = 0; i < count; ++i) {
-      result.push_back(
-          Period<TT, MJD>(Time<TT, MJD>(ptr[i].start_mjd), Time<TT, MJD>(ptr[i].end_mjd)));
-    }
-    siderust_periods_free(ptr, count);
-    return result;
-  }
 };
 
 } // namespace siderust
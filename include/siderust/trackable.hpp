@@ -74,6 +74,22 @@ public:
    */
   virtual qtty::Degree altitude_at(const Geodetic &obs, const Time<TT, MJD> &mjd) const = 0;
 
+  /**
+   * @brief Altitude (degrees) at every instant of `mjds`.
+   *
+   * The default calls `altitude_at(obs, mjds[i])` per instant; the built-in
+   * targets override it to marshal the target and observer once per series.
+   *
+   * @throws InvalidDimensionError if `out.size() != mjds.size()`.
+   */
+  virtual void altitude_at(const Geodetic &obs, span<const Time<TT, MJD>> mjds,
+                           span<qtty::Degree> out) const {
+    detail::check_batch_size(mjds.size(), out.size(), "Target::altitude_at(span)");
+    for (std::size_t i = 0; i < mjds.size(); ++i) {
+      out[i] = altitude_at(obs, mjds[i]);
+    }
+  }
+
   /**
    * @brief Find periods when the object is above a threshold altitude.
    */
@@ -55,6 +55,15 @@ TEST_F(AltitudeTest, SunAboveThreshold) {
   }
 }
 
+TEST_F(AltitudeTest, VectorResultsReservedFromFfiCount) {
+  static_assert(detail::has_reserve<detail::VectorSink<CrossingEvent>>::value,
+                "vector sinks must reserve from the FFI result count");
+  const Period<TT, MJD> month_window(start, start + 30.0_d);
+  const auto events = sun::crossings(obs, month_window, 0.0_deg);
+  EXPECT_GT(events.size(), 0u);
+  EXPECT_EQ(events.capacity(), events.size());
+}
+
 TEST_F(AltitudeTest, SunBelowThreshold) {
   // Astronomical night: sun < -18°
   auto periods = sun::below_threshold(obs, window, -18.0_deg);
@@ -112,6 +121,79 @@ TEST_F(AltitudeTest, SunBelowThresholdMatchesAltitudeRanges) {
   }
 }
 
+TEST_F(AltitudeTest, SunAltitudeRangesParallelMatchesSerial) {
+  const Period<TT, MJD> month_window(Time<TT, MJD>::from_utc({2026, 1, 1, 0, 0, 0}),
+                                     Time<TT, MJD>::from_utc({2026, 2, 1, 0, 0, 0}));
+  const auto serial = sun::altitude_ranges(obs, month_window, -90.0_deg, -12.0_deg);
+  for (const std::size_t threads : {2u, 3u, 8u}) {
+    SearchOptions opts;
+    opts.with_parallelism(threads);
+    ExpectEquivalentPeriods(sun::altitude_ranges(obs, month_window, -90.0_deg, -12.0_deg, opts),
+                            serial, 0.0);
+  }
+}
+
+TEST_F(AltitudeTest, SunCrossingsParallelMatchesSerial) {
+  const Period<TT, MJD> month_window(Time<TT, MJD>::from_utc({2026, 1, 1, 0, 0, 0}),
+                                     Time<TT, MJD>::from_utc({2026, 2, 1, 0, 0, 0}));
+  const auto serial = sun::crossings(obs, month_window, 0.0_deg);
+  SearchOptions opts;
+  opts.with_parallelism(4);
+  const auto parallel = sun::crossings(obs, month_window, 0.0_deg, opts);
+  ASSERT_EQ(parallel.size(), serial.size());
+  for (std::size_t i = 0; i < serial.size(); ++i) {
+    EXPECT_EQ(parallel[i].time.value(), serial[i].time.value());
+    EXPECT_EQ(parallel[i].direction, serial[i].direction);
+  }
+}
+
+TEST_F(AltitudeTest, ParallelResultsIndependentOfThreadCount) {
+  const Period<TT, MJD> month_window(Time<TT, MJD>::from_utc({2026, 1, 1, 0, 0, 0}),
+                                     Time<TT, MJD>::from_utc({2026, 2, 1, 0, 0, 0}));
+  SearchOptions two;
+  two.with_parallelism(2);
+  const auto crossings_ref = sun::crossings(obs, month_window, -6.0_deg, two);
+  const auto nights_ref = sun::below_threshold(obs, month_window, -18.0_deg, two);
+  const auto culm_ref = moon::culminations(obs, month_window, two);
+  for (const std::size_t threads : {3u, 7u, 16u}) {
+    SearchOptions opts;
+    opts.with_parallelism(threads);
+    const auto crossings = sun::crossings(obs, month_window, -6.0_deg, opts);
+    ASSERT_EQ(crossings.size(), crossings_ref.size());
+    for (std::size_t i = 0; i < crossings.size(); ++i)
+      EXPECT_EQ(crossings[i].time.value(), crossings_ref[i].time.value());
+    const auto nights = sun::below_threshold(obs, month_window, -18.0_deg, opts);
+    ExpectEquivalentPeriods(nights, nights_ref, 0.0);
+    const auto culm = moon::culminations(obs, month_window, opts);
+    ASSERT_EQ(culm.size(), culm_ref.size());
+    for (std::size_t i = 0; i < culm.size(); ++i)
+      EXPECT_EQ(culm[i].time.value(), culm_ref[i].time.value());
+  }
+}
+
+TEST_F(AltitudeTest, MoonCulminationsParallelMatchesSerial) {
+  const Period<TT, MJD> month_window(Time<TT, MJD>::from_utc({2026, 1, 1, 0, 0, 0}),
+                                     Time<TT, MJD>::from_utc({2026, 2, 1, 0, 0, 0}));
+  const auto serial = moon::culminations(obs, month_window);
+  SearchOptions opts;
+  opts.with_parallelism(0); // hardware concurrency
+  const auto parallel = moon::culminations(obs, month_window, opts);
+  ASSERT_EQ(parallel.size(), serial.size());
+  for (std::size_t i = 0; i < serial.size(); ++i) {
+    EXPECT_EQ(parallel[i].time.value(), serial[i].time.value());
+    EXPECT_EQ(parallel[i].kind, serial[i].kind);
+  }
+}
+
+TEST_F(AltitudeTest, SunBelowThresholdNetworkMatchesPerSite) {
+  const std::vector<Geodetic> network = {ROQUE_DE_LOS_MUCHACHOS(), EL_PARANAL(), MAUNA_KEA()};
+  const auto nights = sun::below_threshold(network, window, -18.0_deg);
+  ASSERT_EQ(nights.size(), network.size());
+  for (std::size_t i = 0; i < network.size(); ++i) {
+    ExpectEquivalentPeriods(nights[i], sun::below_threshold(network[i], window, -18.0_deg), 0.0);
+  }
+}
+
 // ============================================================================
 // Moon
 // ============================================================================
@@ -139,6 +221,162 @@ TEST_F(AltitudeTest, MoonAboveThresholdAcceptsSearchOptions) {
   }
 }
 
+// ============================================================================
+// Batched altitude series
+// ============================================================================
+
+TEST_F(AltitudeTest, BatchAltitudeMatchesPerCall) {
+  std::vector<Time<TT, MJD>> grid;
+  for (int i = 0; i < 12; ++i) {
+    grid.push_back(start + qtty::Day(i / 12.0));
+  }
+  const auto &vega = VEGA();
+  const auto sun_alt = sun::altitude_at(obs, grid);
+  const auto moon_alt = moon::altitude_at(obs, grid);
+  const auto mars_alt = body::altitude_at(Body::Mars, obs, grid);
+  const auto vega_alt = star_altitude::altitude_at(vega, obs, grid);
+  const spherical::direction::ICRS dir(qtty::Degree(279.23), qtty::Degree(38.78));
+  const auto dir_alt = icrs_altitude::altitude_at(dir, obs, grid);
+
+  const BodyTarget mars(Body::Mars);
+  const StarTarget vega_target(vega);
+  const Target &as_target = mars;
+  std::vector<qtty::Degree> mars_deg(grid.size()), vega_deg(grid.size());
+  as_target.altitude_at(obs, grid, mars_deg);
+  vega_target.altitude_at(obs, grid, vega_deg);
+
+  for (std::size_t i = 0; i < grid.size(); ++i) {
+    EXPECT_EQ(sun_alt[i].value(), sun::altitude_at(obs, grid[i]).value());
+    EXPECT_EQ(moon_alt[i].value(), moon::altitude_at(obs, grid[i]).value());
+    EXPECT_EQ(mars_alt[i].value(), body::altitude_at(Body::Mars, obs, grid[i]).value());
+    EXPECT_EQ(vega_alt[i].value(), star_altitude::altitude_at(vega, obs, grid[i]).value());
+    EXPECT_EQ(dir_alt[i].value(), icrs_altitude::altitude_at(dir, obs, grid[i]).value());
+    EXPECT_NEAR(mars_deg[i].value(), mars.altitude_at(obs, grid[i]).value(), 1e-12);
+    EXPECT_NEAR(vega_deg[i].value(), vega_target.altitude_at(obs, grid[i]).value(), 1e-12);
+  }
+
+  std::vector<qtty::Radian> short_out(grid.size() - 1);
+  EXPECT_THROW(sun::altitude_at(obs, grid, short_out), InvalidDimensionError);
+}
+
+// ============================================================================
+// Ephemeris providers
+// ============================================================================
+
+TEST_F(AltitudeTest, BuiltinProviderMatchesPlainSearch) {
+  const EphemerisProvider builtin;
+  EXPECT_DOUBLE_EQ(sun::altitude_at(obs, start, builtin).value(),
+                   sun::altitude_at(obs, start).value());
+  ExpectEquivalentPeriods(sun::below_threshold(obs, window, -18.0_deg, builtin),
+                          sun::below_threshold(obs, window, -18.0_deg), 0.0);
+  EXPECT_EQ(moon::crossings(obs, window, 0.0_deg, builtin).size(),
+            moon::crossings(obs, window, 0.0_deg).size());
+}
+
+TEST_F(AltitudeTest, ContextProviderForwardsToBuiltinSearch) {
+  const AstroContext ctx(EarthOrientationModel::Iau2000B);
+  ASSERT_TRUE(EphemerisProvider(ctx).is_builtin());
+  ASSERT_TRUE(EphemerisProvider(AstroContext()).has_model());
+
+  // Built-in providers never reach the provider engine, with or without a
+  // context's model.
+  EXPECT_EQ(sun::altitude_at(obs, start, ctx).value(), sun::altitude_at(obs, start).value());
+  const auto reference = sun::crossings(obs, window, 0.0_deg);
+  const auto events = sun::crossings(obs, window, 0.0_deg, AstroContext());
+  ASSERT_EQ(events.size(), reference.size());
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    EXPECT_EQ(events[i].time.value(), reference[i].time.value());
+    EXPECT_EQ(events[i].direction, reference[i].direction);
+  }
+  ExpectEquivalentPeriods(moon::above_threshold(obs, window, 0.0_deg, ctx),
+                          moon::above_threshold(obs, window, 0.0_deg), 0.0);
+  EXPECT_EQ(sun::azimuth_crossings(obs, window, 180.0_deg, ctx).size(),
+            sun::azimuth_crossings(obs, window, 180.0_deg).size());
+}
+
+TEST_F(AltitudeTest, CacheProviderTracksBuiltinSeries) {
+  const Body bodies[] = {Body::Sun, Body::Moon};
+  const EphemerisCache cache(bodies, Time<TT, JD>(start.value() + 2400000.5 - 1.0),
+                             Time<TT, JD>(end_.value() + 2400000.5 + 1.0));
+  const auto opts = SearchOptions().with_tolerance(qtty::Day(1e-5)); // ~0.9 s
+
+  // Apparent places from a cache of the built-in series.
+  EXPECT_NEAR(sun::altitude_at(obs, start, cache).to<qtty::Degree>().value(),
+              sun::altitude_at(obs, start).to<qtty::Degree>().value(), 1.0 / 3600.0);
+  EXPECT_NEAR(moon::altitude_at(obs, start, cache).to<qtty::Degree>().value(),
+              moon::altitude_at(obs, start).to<qtty::Degree>().value(), 1.0 / 3600.0);
+
+  for (Body b : bodies) {
+    const auto reference = body::crossings(b, obs, window, 0.0_deg);
+    const auto events = body::crossings(b, obs, window, 0.0_deg, cache, opts);
+    ASSERT_EQ(events.size(), reference.size());
+    for (std::size_t i = 0; i < events.size(); ++i) {
+      EXPECT_NEAR(events[i].time.value(), reference[i].time.value(), opts.time_tolerance.value());
+      EXPECT_EQ(events[i].direction, reference[i].direction);
+    }
+  }
+
+  ExpectEquivalentPeriods(sun::below_threshold(obs, window, -18.0_deg, cache),
+                          sun::altitude_ranges(obs, window, -90.0_deg, -18.0_deg, cache));
+}
+
+TEST_F(AltitudeTest, CacheProviderAzimuthTracksBuiltinSeries) {
+  const Body bodies[] = {Body::Sun, Body::Moon};
+  const EphemerisCache cache(bodies, Time<TT, JD>(start.value() + 2400000.5 - 1.0),
+                             Time<TT, JD>(end_.value() + 2400000.5 + 1.0));
+  const auto opts = SearchOptions().with_tolerance(qtty::Day(1e-5));
+  const BodyTarget sun_target(Body::Sun);
+
+  for (double bearing : {90.0, 180.0, 270.0}) {
+    const auto reference = sun::azimuth_crossings(obs, window, qtty::Degree(bearing));
+    const auto events = sun::azimuth_crossings(obs, window, qtty::Degree(bearing), cache, opts);
+    ASSERT_EQ(events.size(), reference.size());
+    for (std::size_t i = 0; i < events.size(); ++i) {
+      EXPECT_NEAR(events[i].time.value(), reference[i].time.value(), opts.time_tolerance.value());
+      EXPECT_EQ(events[i].direction, reference[i].direction);
+      EXPECT_NEAR(sun_target.azimuth_at(obs, events[i].time, cache).value(), bearing, 0.05);
+    }
+  }
+
+  const auto reference = moon::azimuth_extrema(obs, window);
+  const auto extrema = moon::azimuth_extrema(obs, window, cache, opts);
+  ASSERT_EQ(extrema.size(), reference.size());
+  for (std::size_t i = 0; i < extrema.size(); ++i) {
+    EXPECT_EQ(extrema[i].kind, reference[i].kind);
+    EXPECT_NEAR(extrema[i].azimuth.value(), reference[i].azimuth.value(), 1.0 / 3600.0);
+  }
+
+  const Subject sun_subject = Subject::body(Body::Sun);
+  const auto via_subject = azimuth_crossings(sun_subject, obs, window, 180.0_deg, cache, opts);
+  const auto via_target = sun_target.azimuth_crossings(obs, window, 180.0_deg, cache, opts);
+  ASSERT_EQ(via_subject.size(), via_target.size());
+  for (std::size_t i = 0; i < via_subject.size(); ++i)
+    EXPECT_EQ(via_subject[i].time.value(), via_target[i].time.value());
+}
+
+TEST_F(AltitudeTest, CacheProviderParallelMatchesSerial) {
+  const Body bodies[] = {Body::Sun};
+  const EphemerisCache cache(bodies, Time<TT, JD>(start.value() + 2400000.5 - 1.0),
+                             Time<TT, JD>(start.value() + 2400000.5 + 32.0));
+  const Period<TT, MJD> month(start, start + 30.0_d);
+  const auto serial = sun::crossings(obs, month, -12.0_deg, cache);
+  SearchOptions opts;
+  opts.with_parallelism(4);
+  const auto parallel = sun::crossings(obs, month, -12.0_deg, cache, opts);
+  ASSERT_EQ(parallel.size(), serial.size());
+  for (std::size_t i = 0; i < serial.size(); ++i) {
+    EXPECT_EQ(parallel[i].time.value(), serial[i].time.value());
+    EXPECT_EQ(parallel[i].direction, serial[i].direction);
+  }
+}
+
+TEST_F(AltitudeTest, CacheProviderRejectsMissingBody) {
+  const Body bodies[] = {Body::Sun};
+  const EphemerisCache cache(bodies, Time<TT, JD>(start.value() + 2400000.5 - 1.0),
+                             Time<TT, JD>(end_.value() + 2400000.5 + 1.0));
+  EXPECT_THROW(moon::crossings(obs, window, 0.0_deg, cache), InvalidArgumentError);
+}
+
 // ============================================================================
 // Star
 // ============================================================================
@@ -2,6 +2,8 @@
 // Copyright (C) 2026 Vallés Puig, Ramon
 
 #include <cmath>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <siderust/siderust.hpp>
 
@@ -178,6 +180,89 @@ TEST(BodycentricTransforms, HeliocentricOrbitWithGeocentricOrbit) {
   EXPECT_NEAR(r, 0.00257, 0.0002);
 }
 
+// ============================================================================
+// Batched trajectories
+// ============================================================================
+
+TEST(BodycentricTransforms, BatchTrajectoryMatchesPerPoint) {
+  using GeoPos = cartesian::Position<Geocentric, EclipticMeanJ2000, AstronomicalUnit>;
+  using BodyPos = cartesian::Position<Bodycentric, EclipticMeanJ2000, AstronomicalUnit>;
+  const BodycentricParams params = BodycentricParams::heliocentric(mars_orbit());
+
+  // Monotone epochs with repeats: two samples per instant.
+  std::vector<GeoPos> traj;
+  std::vector<Time<TT, JD>> epochs;
+  for (int i = 0; i < 40; ++i) {
+    traj.emplace_back(0.001 * i, -0.002 * i, 0.0005 * i);
+    epochs.emplace_back(J2000 + 0.25 * (i / 2));
+  }
+
+  std::vector<BodyPos> body(traj.size());
+  to_bodycentric(span<const GeoPos>(traj), params, epochs, body);
+  std::vector<GeoPos> back(traj.size());
+  to_geocentric(span<const BodyPos>(body), params, epochs, back);
+
+  for (std::size_t i = 0; i < traj.size(); ++i) {
+    const auto ref = to_bodycentric(traj[i], params, epochs[i]);
+    EXPECT_NEAR(body[i].x().value(), ref.x().value(), 1e-12);
+    EXPECT_NEAR(body[i].y().value(), ref.y().value(), 1e-12);
+    EXPECT_NEAR(body[i].z().value(), ref.z().value(), 1e-12);
+    EXPECT_NEAR(back[i].x().value(), traj[i].x().value(), 1e-12);
+    EXPECT_NEAR(back[i].y().value(), traj[i].y().value(), 1e-12);
+    EXPECT_NEAR(back[i].z().value(), traj[i].z().value(), 1e-12);
+  }
+
+  // Packed buffer, transformed in place with one epoch for the batch.
+  std::vector<double> xyz;
+  for (const auto &p : traj) {
+    xyz.insert(xyz.end(), {p.x().value(), p.y().value(), p.z().value()});
+  }
+  const Time<TT, JD> one[] = {epochs.front()};
+  to_bodycentric_xyz<Geocentric, EclipticMeanJ2000, AstronomicalUnit>(xyz.data(), xyz.data(),
+                                                                      traj.size(), params, one);
+  const auto ref = to_bodycentric(traj.back(), params, epochs.front());
+  EXPECT_NEAR(xyz[xyz.size() - 3], ref.x().value(), 1e-12);
+  EXPECT_NEAR(xyz[xyz.size() - 1], ref.z().value(), 1e-12);
+  to_geocentric_xyz<EclipticMeanJ2000, AstronomicalUnit>(xyz.data(), xyz.data(), traj.size(),
+                                                         params, one);
+  EXPECT_NEAR(xyz[xyz.size() - 2], traj.back().y().value(), 1e-12);
+
+  epochs.pop_back();
+  EXPECT_THROW(to_bodycentric(span<const GeoPos>(traj), params, epochs, body),
+               InvalidDimensionError);
+}
+
+TEST(BodycentricTransforms, DenseTrajectoryMatchesPerPoint) {
+  using GeoPos = cartesian::Position<Geocentric, EclipticMeanJ2000, AstronomicalUnit>;
+  using BodyPos = cartesian::Position<Bodycentric, EclipticMeanJ2000, AstronomicalUnit>;
+
+  // A new epoch per point, unsorted, so the offset is interpolated across the
+  // span. The satellite (~5 h period) forces the fit to split its stretches.
+  const BodycentricParams cases[] = {BodycentricParams::heliocentric(mars_orbit()),
+                                     BodycentricParams::geocentric(satellite_orbit())};
+  std::vector<GeoPos> traj;
+  std::vector<Time<TT, JD>> epochs;
+  for (int i = 0; i < 2000; ++i) {
+    traj.emplace_back(1e-4 * (i % 7), -2e-4 * (i % 5), 1e-5 * i);
+    epochs.emplace_back(J2000 + (i % 2 == 0 ? 1.0 : -1.0) * i / 240.0);
+  }
+
+  for (const auto &params : cases) {
+    std::vector<BodyPos> body(traj.size());
+    to_bodycentric(span<const GeoPos>(traj), params, epochs, body);
+    std::vector<GeoPos> back(traj.size());
+    to_geocentric(span<const BodyPos>(body), params, epochs, back);
+    for (std::size_t i = 0; i < traj.size(); ++i) {
+      const auto ref = to_bodycentric(traj[i], params, epochs[i]);
+      EXPECT_NEAR(body[i].x().value(), ref.x().value(), 1e-11);
+      EXPECT_NEAR(body[i].y().value(), ref.y().value(), 1e-11);
+      EXPECT_NEAR(body[i].z().value(), ref.z().value(), 1e-11);
+      EXPECT_NEAR(back[i].x().value(), traj[i].x().value(), 1e-11);
+      EXPECT_NEAR(back[i].z().value(), traj[i].z().value(), 1e-11);
+    }
+  }
+}
+
 // ============================================================================
 // FFI direct: null pointer guard + invalid center
 // ============================================================================
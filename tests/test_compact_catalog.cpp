@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for CompactCatalog: encoding precision bound, proper-motion
+// propagation, label interning and conversion to targets.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <siderust/siderust.hpp>
+
+using namespace siderust;
+
+namespace {
+
+std::vector<spherical::direction::ICRS> sky(std::size_t n) {
+  std::vector<spherical::direction::ICRS> out;
+  for (std::size_t i = 0; i < n; ++i) {
+    const double t = (static_cast<double>(i) + 0.5) / static_cast<double>(n);
+    out.emplace_back(qtty::Degree(std::fmod(137.50776405 * static_cast<double>(i), 360.0)),
+                     qtty::Degree(std::asin(2.0 * t - 1.0) * 180.0 / constants::pi));
+  }
+  // Poles, RA wrap and the octahedron's folds.
+  out.emplace_back(qtty::Degree(0.0), qtty::Degree(90.0));
+  out.emplace_back(qtty::Degree(0.0), qtty::Degree(-90.0));
+  out.emplace_back(qtty::Degree(359.9999999), qtty::Degree(0.0));
+  out.emplace_back(qtty::Degree(45.0), qtty::Degree(-35.26438968));
+  return out;
+}
+
+double sep_mas(const spherical::direction::ICRS &a, const spherical::direction::ICRS &b) {
+  const auto u = a.to_cartesian();
+  const auto v = b.to_cartesian();
+  const double cx = u.y * v.z - u.z * v.y;
+  const double cy = u.z * v.x - u.x * v.z;
+  const double cz = u.x * v.y - u.y * v.x;
+  const double rad =
+      std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), u.x * v.x + u.y * v.y + u.z * v.z);
+  return rad * 180.0 / constants::pi * 3.6e6;
+}
+
+} // namespace
+
+TEST(CompactCatalog, EncodingWithinPrecisionBound) {
+  const auto dirs = sky(100000);
+  const CompactCatalog cat(dirs);
+  ASSERT_EQ(cat.size(), dirs.size());
+  EXPECT_FALSE(cat.has_proper_motion());
+  EXPECT_LE(cat.memory_bytes(), 8 * dirs.size() + 64);
+
+  for (std::size_t i = 0; i < dirs.size(); ++i) {
+    EXPECT_LE(sep_mas(cat.direction(i), dirs[i]), CompactCatalog::kMaxErrorMas) << i;
+  }
+
+  std::vector<spherical::direction::ICRS> chunk(100);
+  cat.decode(500, chunk);
+  EXPECT_EQ(chunk[7].ra().value(), cat.direction(507).ra().value());
+  EXPECT_THROW(cat.decode(dirs.size() - 10, chunk), OutOfRangeError);
+}
+
+TEST(CompactCatalog, ProperMotionMatchesTarget) {
+  // Barnard's star (Hipparcos), propagated 50 years.
+  const spherical::direction::ICRS barnard(qtty::Degree(269.4521), qtty::Degree(4.6933));
+  const ProperMotion pm{AngularRate{qtty::Degree(-798.58 / 3.6e6), qtty::Day(365.25)},
+                        AngularRate{qtty::Degree(10337.8 / 3.6e6), qtty::Day(365.25)},
+                        RaConvention::MuAlphaStar};
+
+  CompactCatalog cat;
+  cat.add(spherical::direction::ICRS(qtty::Degree(10.0), qtty::Degree(20.0)));
+  const auto i = cat.add(barnard, pm, "Barnard");
+  EXPECT_TRUE(cat.has_proper_motion());
+  EXPECT_NEAR(cat.proper_motion(0).dec.deg_per_day(), 0.0, 0.0);
+
+  const Time<TT, JD> later(Time<TT, JD>::J2000().value() + 50.0 * 365.25);
+  const auto moved = cat.direction(i, later);
+  // ~10.34"/yr north: ≈ 516.9" in 50 years, ≈ 39.9" west in RA·cos(dec).
+  EXPECT_NEAR((moved.dec().value() - barnard.dec().value()) * 3600.0, 516.9, 0.5);
+  EXPECT_NEAR((moved.ra().value() - barnard.ra().value()) * 3600.0 *
+                  std::cos(barnard.dec().value() * constants::pi / 180.0),
+              -39.9, 0.5);
+
+  const auto target = cat.proper_motion_target(i);
+  EXPECT_EQ(target.name(), "Barnard");
+  EXPECT_NEAR(target.proper_motion().dec.deg_per_day(), pm.dec.deg_per_day(), 1e-12);
+}
+
+TEST(CompactCatalog, LabelsAreInternedAndSurviveCopies) {
+  CompactCatalog cat;
+  cat.add(spherical::direction::ICRS(qtty::Degree(1.0), qtty::Degree(1.0)));
+  cat.add(spherical::direction::ICRS(qtty::Degree(2.0), qtty::Degree(2.0)), "M45");
+  cat.add(spherical::direction::ICRS(qtty::Degree(3.0), qtty::Degree(3.0)), "M45");
+  EXPECT_EQ(cat.label_count(), 1u);
+  EXPECT_EQ(cat.label(0), "");
+
+  const CompactCatalog copy = cat;
+  CompactCatalog grown = copy;
+  grown.add(spherical::direction::ICRS(qtty::Degree(4.0), qtty::Degree(4.0)), "M45");
+  EXPECT_EQ(grown.label_count(), 1u);
+  EXPECT_EQ(grown.label(3), "M45");
+  EXPECT_EQ(cat.label(2), "M45");
+
+  const auto target = cat.target(1);
+  EXPECT_EQ(target.name(), "M45");
+  EXPECT_NEAR(target.icrs_direction().ra().value(), 2.0, 1e-9);
+  EXPECT_THROW(cat.target(4), OutOfRangeError);
+}
+
+TEST(CompactCatalog, MemoryBytesCountsLabelTable) {
+  const auto dirs = sky(1000);
+  CompactCatalog plain(dirs);
+  CompactCatalog named;
+  named.reserve(dirs.size());
+  for (std::size_t i = 0; i < dirs.size(); ++i) {
+    named.add(dirs[i], "Gaia DR3 " + std::to_string(4295806720ull + 17 * i));
+  }
+  ASSERT_EQ(named.label_count(), dirs.size());
+
+  // Each distinct label: string object, long-string buffer, index node and bucket.
+  const std::size_t columns = plain.memory_bytes() + dirs.size() * sizeof(std::uint32_t);
+  const std::size_t per_label = sizeof(std::string) + std::string("Gaia DR3 4295806720").size() +
+                                1 + 2 * sizeof(void *) + sizeof(std::string_view);
+  EXPECT_GE(named.memory_bytes(), columns + dirs.size() * per_label);
+  EXPECT_LE(named.memory_bytes(), columns + dirs.size() * 3 * per_label);
+
+  // Labels that fit the small-string buffer add no text bytes.
+  CompactCatalog shorts;
+  shorts.add(dirs[0], "M1");
+  CompactCatalog longs;
+  longs.add(dirs[0], std::string(64, 'x'));
+  EXPECT_GE(longs.memory_bytes(), shorts.memory_bytes() + 64);
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <siderust/siderust.hpp>
 
+#include <thread>
+#include <vector>
+
 using namespace siderust;
 
 // ============================================================================
@@ -43,3 +46,92 @@ TEST(AstroContext, OwnedFfiContextModelRoundtrip) {
   detail::OwnedFfiContext fctx(EarthOrientationModel::Iau2000A);
   EXPECT_EQ(fctx.model(), EarthOrientationModel::Iau2000A);
 }
+
+// ============================================================================
+// Shared FFI handle
+// ============================================================================
+
+TEST(AstroContext, FfiHandleIsSharedPerModel) {
+  const AstroContext a(EarthOrientationModel::Iau2006A);
+  const AstroContext b(EarthOrientationModel::Iau2006A);
+  const AstroContext c(EarthOrientationModel::Iau2000B);
+  ASSERT_NE(a.ffi_handle(), nullptr);
+  EXPECT_EQ(a.ffi_handle(), b.ffi_handle());
+  EXPECT_NE(a.ffi_handle(), c.ffi_handle());
+
+  siderust_earth_orientation_model_t model{};
+  check_status(siderust_context_get_model(c.ffi_handle(), &model), "test");
+  EXPECT_EQ(static_cast<EarthOrientationModel>(model), EarthOrientationModel::Iau2000B);
+}
+
+TEST(AstroContext, ToFrameWithMatchesPerCallContext) {
+  const AstroContext ctx(EarthOrientationModel::Iau2000A);
+  const Time<TT, JD> jd(2460000.5);
+  const cartesian::Direction<frames::ICRS> dir(0.6, 0.0, 0.8);
+
+  const auto shared = dir.to_frame_with<frames::EclipticMeanJ2000>(jd, ctx);
+
+  detail::OwnedFfiContext fctx(ctx);
+  siderust_cartesian_pos_t out{};
+  check_status(siderust_cartesian_dir_transform_frame_with_context(
+                   dir.x, dir.y, dir.z, frames::FrameTraits<frames::ICRS>::ffi_id,
+                   frames::FrameTraits<frames::EclipticMeanJ2000>::ffi_id, jd.value(), fctx.get(),
+                   &out),
+               "test");
+  EXPECT_DOUBLE_EQ(shared.x, out.x);
+  EXPECT_DOUBLE_EQ(shared.y, out.y);
+  EXPECT_DOUBLE_EQ(shared.z, out.z);
+}
+
+TEST(AstroContext, FfiHandleSharedAcrossThreads) {
+  const AstroContext ctx(EarthOrientationModel::Iau2006A);
+  const cartesian::Direction<frames::ICRS> dir(0.6, 0.0, 0.8);
+  constexpr int kSteps = 200;
+  const auto jd_at = [](int i) { return Time<TT, JD>(2460000.5 + 0.37 * i); };
+
+  std::vector<cartesian::Direction<frames::EclipticMeanJ2000>> serial;
+  for (int i = 0; i < kSteps; ++i)
+    serial.push_back(dir.to_frame_with<frames::EclipticMeanJ2000>(jd_at(i), ctx));
+
+  constexpr std::size_t kThreads = 4;
+  std::vector<std::size_t> mismatches(kThreads, 0);
+  std::vector<std::thread> workers;
+  for (std::size_t w = 0; w < kThreads; ++w) {
+    workers.emplace_back([&, w] {
+      for (int i = 0; i < kSteps; ++i) {
+        const auto d = dir.to_frame_with<frames::EclipticMeanJ2000>(jd_at(i), ctx);
+        if (d.x != serial[i].x || d.y != serial[i].y || d.z != serial[i].z)
+          ++mismatches[w];
+      }
+    });
+  }
+  for (auto &t : workers)
+    t.join();
+  for (std::size_t w = 0; w < kThreads; ++w)
+    EXPECT_EQ(mismatches[w], 0u);
+}
+
+TEST(AstroContext, EphemerisProviderDefaultsToBuiltin) {
+  const AstroContext ctx(EarthOrientationModel::Iau2000B);
+  EXPECT_TRUE(ctx.ephemeris().is_builtin());
+
+  const EphemerisProvider eph = ctx;
+  EXPECT_EQ(eph.source(), EphemerisSource::Builtin);
+  ASSERT_TRUE(eph.has_model());
+  EXPECT_EQ(eph.model(), EarthOrientationModel::Iau2000B);
+}
+
+TEST(AstroContext, WithEphemerisKeepsProviderAcrossModels) {
+  const Body sun[] = {Body::Sun};
+  const EphemerisCache cache(sun, Time<TT, JD>(2460000.5), Time<TT, JD>(2460002.5));
+
+  const auto ctx = AstroContext().with_ephemeris(cache).with_model<Iau2000A>();
+  EXPECT_EQ(ctx.model(), EarthOrientationModel::Iau2000A);
+  EXPECT_EQ(ctx.ephemeris().source(), EphemerisSource::Cache);
+  EXPECT_EQ(ctx.ephemeris().cache(), &cache);
+  EXPECT_EQ(ctx.ephemeris().runtime(), nullptr);
+
+  const EphemerisProvider eph = ctx;
+  EXPECT_EQ(eph.cache(), &cache);
+  EXPECT_EQ(eph.model(), EarthOrientationModel::Iau2000A);
+}
@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <siderust/siderust.hpp>
 #include <type_traits>
+#include <vector>
 
 using namespace siderust;
 
@@ -215,6 +216,54 @@ TEST(TypedCoordinates, GeodeticToCartesianMember) {
   EXPECT_NEAR(ecef_km.x().value(), 6378.137, 1e-3);
 }
 
+TEST(TypedCoordinates, GeodeticBatchMatchesFfi) {
+  std::vector<Geodetic> sites;
+  for (int i = 0; i < 200; ++i) {
+    sites.emplace_back(-180.0 + 1.8 * i, -90.0 + 0.9 * i, -500.0 + 5.0e4 * (i % 7));
+  }
+  sites.emplace_back(0.0, 90.0, 3.6e7); // pole at geostationary height
+
+  const auto ecef = geodetic_to_ecef(sites);
+  const auto ecef_km = geodetic_to_ecef<qtty::Kilometer>(sites);
+  ASSERT_EQ(ecef.size(), sites.size());
+  for (std::size_t i = 0; i < sites.size(); ++i) {
+    const auto ref = sites[i].to_cartesian();
+    EXPECT_NEAR(ecef[i].x().value(), ref.x().value(), 1e-4);
+    EXPECT_NEAR(ecef[i].y().value(), ref.y().value(), 1e-4);
+    EXPECT_NEAR(ecef[i].z().value(), ref.z().value(), 1e-4);
+    EXPECT_NEAR(ecef_km[i].x().value(), ref.x().value() / 1000.0, 1e-7);
+  }
+
+  std::vector<cartesian::position::ECEF<qtty::Meter>> short_out(3);
+  EXPECT_THROW(geodetic_to_ecef(sites, short_out), InvalidDimensionError);
+}
+
+TEST(TypedCoordinates, EcefToGeodeticRoundtrip) {
+  std::vector<Geodetic> sites;
+  for (int i = 0; i < 181; ++i) {
+    sites.emplace_back(-179.0 + 1.97 * i, -90.0 + i, (i % 3 == 0) ? 4.2e7 : 100.0 * i);
+  }
+  const auto ecef = geodetic_to_ecef(sites);
+  const auto back = ecef_to_geodetic(ecef);
+  for (std::size_t i = 0; i < sites.size(); ++i) {
+    // Compare as positions: longitude is degenerate at the poles.
+    const auto again = back[i].to_cartesian();
+    EXPECT_NEAR(again.x().value(), ecef[i].x().value(), 1e-4);
+    EXPECT_NEAR(again.y().value(), ecef[i].y().value(), 1e-4);
+    EXPECT_NEAR(again.z().value(), ecef[i].z().value(), 1e-4);
+    EXPECT_NEAR(back[i].height.value(), sites[i].height.value(), 1e-4);
+  }
+
+  // Single point, non-metre units, and the geocentre (inside the evolute).
+  const auto roque = ecef_to_geodetic(ROQUE_DE_LOS_MUCHACHOS().to_cartesian<qtty::Kilometer>());
+  EXPECT_NEAR(roque.lat.value(), ROQUE_DE_LOS_MUCHACHOS().lat.value(), 1e-9);
+  EXPECT_NEAR(roque.height.value(), ROQUE_DE_LOS_MUCHACHOS().height.value(), 1e-4);
+
+  const auto centre = ecef_to_geodetic(cartesian::position::ECEF<qtty::Meter>(0.0, 0.0, 0.0));
+  EXPECT_NEAR(centre.lat.value(), 90.0, 1e-12);
+  EXPECT_NEAR(centre.height.value(), -6356752.314245, 1e-4);
+}
+
 // ============================================================================
 // cartesian::Direction::to_frame — new method
 // ============================================================================
@@ -419,3 +468,527 @@ TEST(TypedCoordinates, ToHorizontalPreciseReturnType) {
   [[maybe_unused]] auto hor = dir.to_horizontal_precise(jd, jd_ut1, obs);
   static_assert(std::is_same_v<decltype(hor), spherical::Direction<Horizontal>>);
 }
+
+// ============================================================================
+// FrameRotation — precomputed per-epoch rotation
+// ============================================================================
+
+TEST(TypedCoordinates, FrameRotationMatchesToFrame) {
+  using namespace siderust::frames;
+
+  const Time<TT, JD> jd(2460676.5);
+  const auto rot = FrameRotation<ICRS, EquatorialTrueOfDate>::at(jd);
+
+  const cartesian::Direction<ICRS> dir(0.36, 0.48, 0.8);
+  const auto via_rot = rot.apply(dir);
+  const auto via_ffi = dir.to_frame<EquatorialTrueOfDate>(jd);
+  static_assert(
+      std::is_same_v<decltype(via_rot), const cartesian::Direction<EquatorialTrueOfDate>>);
+  EXPECT_NEAR(via_rot.x, via_ffi.x, 1e-14);
+  EXPECT_NEAR(via_rot.y, via_ffi.y, 1e-14);
+  EXPECT_NEAR(via_rot.z, via_ffi.z, 1e-14);
+
+  using AU = qtty::AstronomicalUnit;
+  const cartesian::Position<centers::Heliocentric, ICRS, AU> pos(1.0, 0.5, 0.2);
+  const auto pos_rot = rot.apply(pos);
+  const auto pos_ffi = pos.to_frame<EquatorialTrueOfDate>(jd);
+  EXPECT_NEAR(pos_rot.x().value(), pos_ffi.x().value(), 1e-14);
+  EXPECT_NEAR(pos_rot.y().value(), pos_ffi.y().value(), 1e-14);
+  EXPECT_NEAR(pos_rot.z().value(), pos_ffi.z().value(), 1e-14);
+}
+
+TEST(TypedCoordinates, FrameRotationInverseAndCompose) {
+  using namespace siderust::frames;
+
+  const auto jd = Time<TT, JD>::J2000();
+  const auto to_ecl = FrameRotation<ICRS, EclipticMeanJ2000>::at(jd);
+  const auto ecl_to_eq = FrameRotation<EclipticMeanJ2000, EquatorialMeanJ2000>::at(jd);
+
+  const cartesian::Direction<ICRS> dir(0.6, 0.0, 0.8);
+  const auto back = to_ecl.inverse().apply(to_ecl.apply(dir));
+  EXPECT_NEAR(back.x, dir.x, 1e-15);
+  EXPECT_NEAR(back.y, dir.y, 1e-15);
+  EXPECT_NEAR(back.z, dir.z, 1e-15);
+
+  const auto composed = to_ecl.then(ecl_to_eq).apply(dir);
+  const auto direct = dir.to_frame<EquatorialMeanJ2000>(jd);
+  EXPECT_NEAR(composed.x, direct.x, 1e-12);
+  EXPECT_NEAR(composed.y, direct.y, 1e-12);
+  EXPECT_NEAR(composed.z, direct.z, 1e-12);
+
+  const auto id = FrameRotation<ICRS, ICRS>::at(jd);
+  EXPECT_DOUBLE_EQ(id.apply(dir).x, dir.x);
+}
+
+TEST(TypedCoordinates, FrameRotationBulkMatchesSingle) {
+  using namespace siderust::frames;
+
+  const auto rot = FrameRotation<ICRS, EclipticMeanJ2000>::at(Time<TT, JD>::J2000());
+  std::vector<cartesian::Direction<ICRS>> in;
+  for (int i = 0; i < 17; ++i) {
+    const double a = 0.37 * i;
+    in.emplace_back(std::cos(a) * 0.6, std::sin(a) * 0.6, 0.8);
+  }
+  std::vector<cartesian::Direction<EclipticMeanJ2000>> out(in.size());
+  rot.apply(in, out);
+
+  std::vector<double> flat_in;
+  for (const auto &d : in) {
+    flat_in.insert(flat_in.end(), {d.x, d.y, d.z});
+  }
+  std::vector<double> flat_out(flat_in.size());
+  rot.apply_xyz(flat_in.data(), flat_out.data(), in.size());
+
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto single = rot.apply(in[i]);
+    EXPECT_DOUBLE_EQ(out[i].x, single.x);
+    EXPECT_DOUBLE_EQ(out[i].y, single.y);
+    EXPECT_DOUBLE_EQ(out[i].z, single.z);
+    EXPECT_DOUBLE_EQ(flat_out[3 * i + 2], single.z);
+  }
+
+  std::vector<cartesian::Direction<EclipticMeanJ2000>> short_out(3);
+  EXPECT_THROW(rot.apply(in, short_out), InvalidDimensionError);
+}
+
+// ============================================================================
+// Structure-of-arrays containers and kernels
+// ============================================================================
+
+TEST(TypedCoordinates, SoaDirectionConversionsMatchScalar) {
+  using namespace siderust::frames;
+
+  std::vector<spherical::Direction<ICRS>> aos;
+  for (int i = 0; i < 37; ++i) {
+    aos.emplace_back(qtty::Degree(9.7 * i), qtty::Degree(-88.0 + 4.8 * i));
+  }
+  const spherical::DirectionArray<ICRS> sph(aos);
+  ASSERT_EQ(sph.size(), aos.size());
+
+  const auto cart = to_cartesian(sph);
+  const auto back = to_spherical(cart);
+  for (std::size_t i = 0; i < aos.size(); ++i) {
+    const auto ref = aos[i].to_cartesian();
+    EXPECT_NEAR(cart[i].x, ref.x, 1e-15);
+    EXPECT_NEAR(cart[i].y, ref.y, 1e-15);
+    EXPECT_NEAR(cart[i].z, ref.z, 1e-15);
+    EXPECT_NEAR(back[i].ra().value(), aos[i].ra().value(), 1e-9);
+    EXPECT_NEAR(back[i].dec().value(), aos[i].dec().value(), 1e-9);
+  }
+}
+
+TEST(TypedCoordinates, SoaKernelsMatchLibmOverFullRange) {
+  using namespace siderust::frames;
+
+  // Longitudes far outside [0, 360) and exact quadrant boundaries exercise the
+  // range reduction of the vectorised kernels.
+  spherical::DirectionArray<ICRS> sph;
+  for (int i = -720; i <= 720; i += 15) {
+    sph.push_back(spherical::Direction<ICRS>(qtty::Degree(i + 0.0), qtty::Degree(i % 90)));
+    sph.push_back(
+        spherical::Direction<ICRS>(qtty::Degree(i * 1.37 + 0.3), qtty::Degree((i % 89) * 1.01)));
+  }
+  const auto cart = to_cartesian(sph);
+  const auto back = to_spherical(cart);
+  for (std::size_t i = 0; i < sph.size(); ++i) {
+    const double a = std::fmod(sph.azimuth()[i], 360.0) * constants::pi / 180.0;
+    const double p = sph.polar()[i] * constants::pi / 180.0;
+    EXPECT_NEAR(cart.x()[i], std::cos(p) * std::cos(a), 2e-15);
+    EXPECT_NEAR(cart.y()[i], std::cos(p) * std::sin(a), 2e-15);
+    EXPECT_NEAR(cart.z()[i], std::sin(p), 2e-15);
+
+    const double x = cart.x()[i], y = cart.y()[i], z = cart.z()[i];
+    double lon = std::atan2(y, x) * 180.0 / constants::pi;
+    lon += lon < 0.0 ? 360.0 : 0.0;
+    if (std::abs(z) < 1.0 - 1e-12) {
+      EXPECT_NEAR(back.azimuth()[i], lon, 1e-12);
+    }
+    EXPECT_NEAR(back.polar()[i], std::atan2(z, std::hypot(x, y)) * 180.0 / constants::pi,
+                1e-12);
+  }
+}
+
+TEST(TypedCoordinates, SoaPositionConversionsMatchScalar) {
+  using namespace siderust::frames;
+  using AU = qtty::AstronomicalUnit;
+  using CartPos = cartesian::Position<centers::Heliocentric, EclipticMeanJ2000, AU>;
+
+  cartesian::PositionArray<centers::Heliocentric, EclipticMeanJ2000, AU> cart;
+  cart.push_back(CartPos(1.0, 0.5, 0.2));
+  cart.push_back(CartPos(-0.3, -2.0, 0.7));
+  cart.push_back(CartPos(0.0, 0.0, -5.0));
+
+  const auto sph = to_spherical(cart);
+  for (std::size_t i = 0; i < cart.size(); ++i) {
+    const auto ref = cart[i].to_spherical();
+    EXPECT_NEAR(sph[i].lon().value(), ref.lon().value(), 1e-12);
+    EXPECT_NEAR(sph[i].lat().value(), ref.lat().value(), 1e-12);
+    EXPECT_NEAR(sph[i].distance().value(), ref.distance().value(), 1e-12);
+  }
+
+  const auto round = to_cartesian(sph);
+  for (std::size_t i = 0; i < cart.size(); ++i) {
+    EXPECT_NEAR(round.x()[i], cart.x()[i], 1e-12);
+    EXPECT_NEAR(round.y()[i], cart.y()[i], 1e-12);
+    EXPECT_NEAR(round.z()[i], cart.z()[i], 1e-12);
+  }
+}
+
+TEST(TypedCoordinates, SoaAngularSeparationMatchesScalar) {
+  using namespace siderust::frames;
+
+  const spherical::Direction<ICRS> ref(qtty::Degree(279.2348), qtty::Degree(38.7836));
+  spherical::DirectionArray<ICRS> dirs;
+  dirs.push_back(ref);
+  dirs.push_back(spherical::Direction<ICRS>(qtty::Degree(99.2348), qtty::Degree(-38.7836)));
+  for (int i = 0; i < 20; ++i) {
+    dirs.push_back(spherical::Direction<ICRS>(qtty::Degree(18.0 * i), qtty::Degree(4.0 * i - 40)));
+  }
+
+  const auto sep = angular_separation(dirs, ref);
+  ASSERT_EQ(sep.size(), dirs.size());
+  EXPECT_NEAR(sep[0].value(), 0.0, 1e-9);
+  EXPECT_NEAR(sep[1].value(), 180.0, 1e-9);
+  for (std::size_t i = 0; i < dirs.size(); ++i) {
+    EXPECT_NEAR(sep[i].value(), dirs[i].angular_separation(ref).value(), 1e-10);
+  }
+
+  std::vector<qtty::Degree> short_out(2);
+  EXPECT_THROW(angular_separation(dirs, ref, short_out), InvalidDimensionError);
+}
+
+// ============================================================================
+// HorizontalProjector — cached observer + epoch projection
+// ============================================================================
+
+namespace {
+
+std::vector<spherical::Direction<frames::ICRS>> projector_sample_sky() {
+  std::vector<spherical::Direction<frames::ICRS>> dirs;
+  for (int i = 0; i < 24; ++i) {
+    dirs.emplace_back(qtty::Degree(15.0 * i + 3.0), qtty::Degree(-70.0 + 6.0 * i));
+  }
+  return dirs;
+}
+
+void expect_same_unit_vector(const spherical::Direction<frames::Horizontal> &a,
+                             const spherical::Direction<frames::Horizontal> &b) {
+  // Compare unit vectors so near-zenith azimuth noise does not matter.
+  const auto va = a.to_cartesian();
+  const auto vb = b.to_cartesian();
+  EXPECT_NEAR(va.x, vb.x, 1e-10);
+  EXPECT_NEAR(va.y, vb.y, 1e-10);
+  EXPECT_NEAR(va.z, vb.z, 1e-10);
+}
+
+} // namespace
+
+TEST(TypedCoordinates, HorizontalProjectorMatchesToHorizontal) {
+  const auto obs = ROQUE_DE_LOS_MUCHACHOS();
+  const Time<TT, JD> jd(2460500.25);
+  const HorizontalProjector<frames::ICRS> proj(obs, jd);
+
+  for (const auto &d : projector_sample_sky()) {
+    expect_same_unit_vector(proj.project(d), d.to_horizontal(jd, obs));
+  }
+}
+
+TEST(TypedCoordinates, HorizontalProjectorMatchesPreciseAndContextPaths) {
+  const auto obs = ROQUE_DE_LOS_MUCHACHOS();
+  const Time<TT, JD> jd(2460500.25);
+  const Time<UT1, JD> jd_ut1(2460500.25 - 69.0 / 86400.0);
+  const AstroContext ctx(EarthOrientationModel::Iau2006A);
+
+  const HorizontalProjector<frames::EquatorialMeanJ2000> precise(obs, jd, jd_ut1);
+  const HorizontalProjector<frames::EquatorialMeanJ2000> with_ctx(obs, jd, ctx);
+  for (const auto &icrs : projector_sample_sky()) {
+    const spherical::Direction<frames::EquatorialMeanJ2000> d(icrs.ra(), icrs.dec());
+    expect_same_unit_vector(precise.project(d), d.to_horizontal_precise(jd, jd_ut1, obs));
+    expect_same_unit_vector(with_ctx.project(d), d.to_horizontal_with(jd, obs, ctx));
+  }
+}
+
+TEST(TypedCoordinates, HorizontalProjectorBulkMatchesSingle) {
+  const auto obs = ROQUE_DE_LOS_MUCHACHOS();
+  const HorizontalProjector<> proj(obs, Time<TT, JD>(2460500.25));
+  const auto sky = projector_sample_sky();
+
+  std::vector<spherical::Direction<frames::Horizontal>> aos(sky.size());
+  proj.project(sky, aos);
+
+  spherical::DirectionArray<frames::Horizontal> soa;
+  proj.project(spherical::DirectionArray<frames::ICRS>(sky), soa);
+  ASSERT_EQ(soa.size(), sky.size());
+
+  for (std::size_t i = 0; i < sky.size(); ++i) {
+    const auto single = proj.project(sky[i]);
+    EXPECT_NEAR(aos[i].az().value(), single.az().value(), 1e-12);
+    EXPECT_NEAR(aos[i].alt().value(), single.alt().value(), 1e-12);
+    EXPECT_NEAR(soa[i].az().value(), single.az().value(), 1e-9);
+    EXPECT_NEAR(soa[i].alt().value(), single.alt().value(), 1e-9);
+  }
+
+  std::vector<spherical::Direction<frames::Horizontal>> short_out(1);
+  EXPECT_THROW(proj.project(sky, short_out), InvalidDimensionError);
+}
+
+// ============================================================================
+// InterpolatedRotation — epoch-interpolated rotations
+// ============================================================================
+
+namespace {
+
+template <typename F>
+double angle_between_deg(const cartesian::Direction<F> &a, const cartesian::Direction<F> &b) {
+  const double cx = a.y * b.z - a.z * b.y;
+  const double cy = a.z * b.x - a.x * b.z;
+  const double cz = a.x * b.y - a.y * b.x;
+  const double dot = a.x * b.x + a.y * b.y + a.z * b.z;
+  return std::atan2(std::sqrt(cx * cx + cy * cy + cz * cz), dot) * 180.0 / constants::pi;
+}
+
+} // namespace
+
+TEST(TypedCoordinates, InterpolatedFrameRotationWithinBudget) {
+  using namespace siderust::frames;
+
+  const Time<TT, JD> start(2460676.75);
+  const Time<TT, JD> end(2460677.25);
+  const qtty::Degree budget(1e-3 / 3600.0);
+  const auto rot = interpolate_frame_rotation<ICRS, EquatorialTrueOfDate>(start, end, budget);
+  EXPECT_GE(rot.segment_count(), 1u);
+
+  const cartesian::Direction<ICRS> dir(0.36, 0.48, 0.8);
+  for (int i = 0; i <= 50; ++i) {
+    const Time<TT, JD> jd(start.value() + 0.5 * i / 50.0);
+    const auto interp = rot.apply(jd, dir);
+    const auto exact = dir.to_frame<EquatorialTrueOfDate>(jd);
+    EXPECT_LE(angle_between_deg(interp, exact), budget.value());
+  }
+
+  EXPECT_THROW(rot.at(Time<TT, JD>(end.value() + 0.1)), OutOfRangeError);
+  EXPECT_THROW((interpolate_frame_rotation<ICRS, EquatorialTrueOfDate>(end, start)),
+               InvalidArgumentError);
+}
+
+TEST(TypedCoordinates, InterpolatedHorizontalWithinBudget) {
+  const auto obs = ROQUE_DE_LOS_MUCHACHOS();
+  const Time<TT, JD> start(2460500.85);
+  const Time<TT, JD> end(2460501.15);
+  const qtty::Degree budget(1e-3 / 3600.0);
+  const auto rot = interpolate_horizontal(obs, start, end, budget);
+
+  // Earth rotation forces subdivision, but far fewer samples than a 10 Hz track.
+  EXPECT_GT(rot.segment_count(), 1u);
+  EXPECT_LT(rot.sample_count(), 2000u);
+
+  const spherical::Direction<frames::ICRS> vega(qtty::Degree(279.2348), qtty::Degree(38.7836));
+  std::vector<Time<TT, JD>> times;
+  std::vector<spherical::Direction<frames::ICRS>> track;
+  for (int i = 0; i <= 60; ++i) {
+    times.emplace_back(start.value() + 0.3 * i / 60.0);
+    track.push_back(vega);
+  }
+  std::vector<spherical::Direction<frames::Horizontal>> out(track.size());
+  rot.apply(times, track, out);
+
+  for (std::size_t i = 0; i < track.size(); ++i) {
+    const auto exact = vega.to_horizontal(times[i], obs).to_cartesian();
+    EXPECT_LE(angle_between_deg(out[i].to_cartesian(), exact), budget.value() + 1e-9);
+  }
+}
+
+TEST(TypedCoordinates, ToFrameWithInterpolatedRotation) {
+  using namespace siderust::frames;
+
+  const Time<TT, JD> start(2460676.75);
+  const Time<TT, JD> end(2460677.25);
+  const qtty::Degree budget(1e-3 / 3600.0);
+  const auto rot = interpolate_frame_rotation<ICRS, EquatorialTrueOfDate>(start, end, budget);
+
+  const cartesian::Direction<ICRS> cart(0.36, 0.48, 0.8);
+  const spherical::Direction<ICRS> sph(qtty::Degree(279.2348), qtty::Degree(38.7836));
+  for (int i = 0; i <= 20; ++i) {
+    const Time<TT, JD> jd(start.value() + 0.5 * i / 20.0);
+
+    const cartesian::Direction<EquatorialTrueOfDate> c = cart.to_frame(jd, rot);
+    const auto c_applied = rot.apply(jd, cart);
+    EXPECT_DOUBLE_EQ(c.x, c_applied.x);
+    EXPECT_DOUBLE_EQ(c.y, c_applied.y);
+    EXPECT_DOUBLE_EQ(c.z, c_applied.z);
+    EXPECT_LE(angle_between_deg(c, cart.to_frame<EquatorialTrueOfDate>(jd)), budget.value());
+
+    const spherical::Direction<EquatorialTrueOfDate> s = sph.to_frame(jd, rot);
+    const auto s_exact = sph.to_frame<EquatorialTrueOfDate>(jd);
+    EXPECT_LE(angle_between_deg(s.to_cartesian(), s_exact.to_cartesian()),
+              budget.value() + 1e-9);
+  }
+
+  EXPECT_THROW(cart.to_frame(Time<TT, JD>(end.value() + 0.1), rot), OutOfRangeError);
+}
+
+// ============================================================================
+// Compile-time frame paths
+// ============================================================================
+
+TEST(TypedCoordinates, FramePathTraits) {
+  using namespace siderust::frames;
+
+  static_assert(has_fixed_rotation_v<ICRS, Galactic>);
+  static_assert(has_frame_path_v<Galactic, EquatorialTrueOfDate>);
+  static_assert(is_composite_path_v<Galactic, EquatorialTrueOfDate>);
+  static_assert(!is_composite_path_v<ICRS, EquatorialTrueOfDate>);
+  static_assert(is_fixed_path_v<Galactic, ICRF>);
+  static_assert(!is_fixed_path_v<Galactic, EclipticMeanJ2000>);
+  static_assert(!has_frame_path_v<Galactic, ECEF>);
+  static_assert(has_dated_rotation_v<EquatorialMeanOfDate, EclipticOfDate>);
+  static_assert(has_frame_path_v<Galactic, EclipticOfDate>);
+  static_assert(has_frame_path_v<EclipticOfDate, EquatorialTrueOfDate>);
+  static_assert(is_composite_path_v<EclipticOfDate, EquatorialMeanOfDate>);
+  static_assert(!has_frame_path_v<EclipticOfDate, ECEF>);
+
+  // Fixed paths collapse to constexpr matrices.
+  constexpr auto gal = FrameRotation<ICRS, Galactic>::fixed();
+  constexpr auto round = gal.then(FrameRotation<Galactic, ICRF>::fixed());
+  static_assert(round.matrix()[0][0] > 0.999999999);
+  static_assert(round.matrix()[2][2] > 0.999999999);
+}
+
+TEST(TypedCoordinates, GalacticFixedRotation) {
+  using namespace siderust::frames;
+
+  // Galactic centre and north galactic pole (ICRS, Hipparcos definition).
+  const spherical::Direction<ICRS> centre(qtty::Degree(266.40499), qtty::Degree(-28.93617));
+  const spherical::Direction<ICRS> pole(qtty::Degree(192.85948), qtty::Degree(27.12825));
+  const auto jd = Time<TT, JD>::J2000();
+
+  const auto c = centre.to_frame<Galactic>(jd);
+  EXPECT_NEAR(c.lat().value(), 0.0, 1e-4);
+  EXPECT_NEAR(std::remainder(c.lon().value(), 360.0), 0.0, 1e-4);
+  EXPECT_NEAR(pole.to_frame<Galactic>(jd).lat().value(), 90.0, 1e-4);
+
+  const auto back = c.to_frame<ICRS>(jd);
+  EXPECT_NEAR(back.ra().value(), centre.ra().value(), 1e-9);
+  EXPECT_NEAR(back.dec().value(), centre.dec().value(), 1e-9);
+}
+
+TEST(TypedCoordinates, CompositeFramePathMatchesManualHops) {
+  using namespace siderust::frames;
+
+  const spherical::Direction<Galactic> dir(qtty::Degree(121.17), qtty::Degree(-21.57));
+  const Time<TT, JD> jd(2460676.5);
+
+  const auto fused = dir.to_cartesian().to_frame<EquatorialTrueOfDate>(jd);
+  const auto manual = dir.to_frame<ICRS>(jd).to_cartesian().to_frame<EquatorialTrueOfDate>(jd);
+  EXPECT_NEAR(fused.x, manual.x, 1e-12);
+  EXPECT_NEAR(fused.y, manual.y, 1e-12);
+  EXPECT_NEAR(fused.z, manual.z, 1e-12);
+
+  const auto to_ecl = FrameRotation<Galactic, EclipticMeanJ2000>::at(jd);
+  const auto via_ecl = to_ecl.apply(dir.to_cartesian());
+  const auto ecl_ref = dir.to_frame<ICRS>(jd).to_cartesian().to_frame<EclipticMeanJ2000>(jd);
+  EXPECT_NEAR(via_ecl.x, ecl_ref.x, 1e-12);
+  EXPECT_NEAR(via_ecl.y, ecl_ref.y, 1e-12);
+  EXPECT_NEAR(via_ecl.z, ecl_ref.z, 1e-12);
+}
+
+TEST(TypedCoordinates, EclipticOfDateDatedRotation) {
+  using namespace siderust::frames;
+
+  // The ecliptic pole of J2000 sits at RA 270°, Dec 90° − ε with the IAU 2006
+  // mean obliquity ε = 84381.406″.
+  const auto j2000 = Time<TT, JD>::J2000();
+  const double eps_deg = 84381.406 / 3600.0;
+  const spherical::Direction<EquatorialMeanOfDate> pole(qtty::Degree(270.0),
+                                                        qtty::Degree(90.0 - eps_deg));
+  EXPECT_NEAR(pole.to_frame<EclipticOfDate>(j2000).lat().value(), 90.0, 1e-9);
+
+  // The obliquity decreases by ≈47″ per century.
+  const Time<TT, JD> jd(2460676.5);
+  const double eps_now = DatedRotation<EquatorialMeanOfDate, EclipticOfDate>::obliquity(jd);
+  EXPECT_NEAR(eps_now * 180.0 / constants::pi * 3600.0, 84381.406 - 46.836769 * 0.25, 0.01);
+
+  // Galactic → ICRS → EquatorialMeanOfDate → EclipticOfDate fuses into one
+  // rotation; the reverse path undoes it.
+  const spherical::Direction<Galactic> dir(qtty::Degree(121.17), qtty::Degree(-21.57));
+  const auto fused = FrameRotation<Galactic, EclipticOfDate>::at(jd).apply(dir.to_cartesian());
+  const auto mean = dir.to_frame<ICRS>(jd).to_cartesian().to_frame<EquatorialMeanOfDate>(jd);
+  const double c = std::cos(eps_now), s = std::sin(eps_now);
+  EXPECT_NEAR(fused.x, mean.x, 1e-12);
+  EXPECT_NEAR(fused.y, c * mean.y + s * mean.z, 1e-12);
+  EXPECT_NEAR(fused.z, -s * mean.y + c * mean.z, 1e-12);
+
+  const auto back = fused.to_frame<Galactic>(jd);
+  const auto ref = dir.to_cartesian();
+  EXPECT_NEAR(back.x, ref.x, 1e-12);
+  EXPECT_NEAR(back.y, ref.y, 1e-12);
+  EXPECT_NEAR(back.z, ref.z, 1e-12);
+}
+
+TEST(TypedCoordinates, HorizontalProjectorFromEclipticOfDate) {
+  const auto obs = ROQUE_DE_LOS_MUCHACHOS();
+  const Time<TT, JD> jd(2460500.25);
+  const HorizontalProjector<frames::EclipticOfDate> proj(obs, jd);
+  const HorizontalProjector<frames::EquatorialMeanOfDate> mean(obs, jd);
+
+  const spherical::Direction<frames::Galactic> gal(qtty::Degree(30.0), qtty::Degree(5.0));
+  const auto ecl = gal.to_frame<frames::EclipticOfDate>(jd);
+  expect_same_unit_vector(proj.project(ecl),
+                          mean.project(ecl.to_frame<frames::EquatorialMeanOfDate>(jd)));
+}
+
+TEST(TypedCoordinates, HorizontalProjectorFromGalactic) {
+  const auto obs = ROQUE_DE_LOS_MUCHACHOS();
+  const Time<TT, JD> jd(2460500.25);
+  const HorizontalProjector<frames::Galactic> proj(obs, jd);
+
+  const spherical::Direction<frames::Galactic> dir(qtty::Degree(30.0), qtty::Degree(5.0));
+  expect_same_unit_vector(proj.project(dir),
+                          dir.to_frame<frames::ICRS>(jd).to_horizontal(jd, obs));
+}
+
+// ============================================================================
+// Batched center shifts
+// ============================================================================
+
+TEST(TypedCoordinates, BatchedCenterShiftMatchesPerCall) {
+  using namespace siderust::frames;
+  using namespace siderust::centers;
+  using HelioPos = cartesian::Position<Heliocentric, ICRS, qtty::AstronomicalUnit>;
+  using GeoPos = cartesian::Position<Geocentric, ICRS, qtty::AstronomicalUnit>;
+
+  std::vector<HelioPos> helio;
+  std::vector<Time<TT, JD>> epochs;
+  for (int i = 0; i < 30; ++i) {
+    helio.emplace_back(1.0 + 0.01 * i, -0.5 + 0.02 * i, 0.1);
+    epochs.emplace_back(2460000.5 + (i / 10)); // three distinct epochs
+  }
+
+  std::vector<GeoPos> geo(helio.size());
+  to_center<Geocentric>(span<const HelioPos>(helio), epochs, geo);
+
+  CenterShift<Heliocentric, Geocentric, ICRS> shift;
+  std::vector<GeoPos> memo(helio.size());
+  shift.apply(helio, epochs, memo);
+  EXPECT_EQ(shift.cached(), 3u);
+
+  for (std::size_t i = 0; i < helio.size(); ++i) {
+    const auto ref = helio[i].to_center<Geocentric>(epochs[i]);
+    EXPECT_NEAR(geo[i].x().value(), ref.x().value(), 1e-12);
+    EXPECT_NEAR(geo[i].y().value(), ref.y().value(), 1e-12);
+    EXPECT_NEAR(geo[i].z().value(), ref.z().value(), 1e-12);
+    EXPECT_NEAR(memo[i].x().value(), ref.x().value(), 1e-12);
+    EXPECT_NEAR(memo[i].z().value(), ref.z().value(), 1e-12);
+  }
+
+  // SoA snapshot at a memoised epoch adds no new entry.
+  const cartesian::PositionArray<Heliocentric, ICRS, qtty::AstronomicalUnit> soa(helio);
+  cartesian::PositionArray<Geocentric, ICRS, qtty::AstronomicalUnit> soa_out;
+  shift.apply(soa, epochs.front(), soa_out);
+  EXPECT_EQ(shift.cached(), 3u);
+  EXPECT_NEAR(soa_out[5].y().value(), helio[5].to_center<Geocentric>(epochs.front()).y().value(),
+              1e-12);
+
+  epochs.resize(2);
+  EXPECT_THROW(shift.apply(helio, epochs, memo), InvalidDimensionError);
+}
@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for DirectionIndex: cone search, k-nearest neighbours and
+// cross-matching against a brute-force angular_separation scan.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <siderust/siderust.hpp>
+
+using namespace siderust;
+
+namespace {
+
+std::vector<spherical::Direction<frames::ICRS>> catalog(std::size_t n) {
+  std::vector<spherical::Direction<frames::ICRS>> out;
+  out.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double t = (static_cast<double>(i) + 0.5) / static_cast<double>(n);
+    out.emplace_back(qtty::Degree(std::fmod(137.50776405 * static_cast<double>(i), 360.0)),
+                     qtty::Degree(std::asin(2.0 * t - 1.0) * 180.0 / constants::pi));
+  }
+  return out;
+}
+
+std::vector<std::size_t> brute_cone(const std::vector<spherical::Direction<frames::ICRS>> &cat,
+                                    const spherical::Direction<frames::ICRS> &c, double radius) {
+  std::vector<std::size_t> out;
+  for (std::size_t i = 0; i < cat.size(); ++i) {
+    if (cat[i].angular_separation(c).value() <= radius)
+      out.push_back(i);
+  }
+  return out;
+}
+
+std::vector<std::size_t> indices(const std::vector<DirectionMatch> &matches) {
+  std::vector<std::size_t> out;
+  for (const auto &m : matches)
+    out.push_back(m.index);
+  std::sort(out.begin(), out.end());
+  return out;
+}
+
+} // namespace
+
+TEST(DirectionIndex, ConeMatchesBruteForce) {
+  const auto cat = catalog(5000);
+  const DirectionIndex<frames::ICRS> index(cat);
+  ASSERT_EQ(index.size(), cat.size());
+
+  const spherical::Direction<frames::ICRS> centers[] = {
+      {qtty::Degree(10.0), qtty::Degree(20.0)},
+      {qtty::Degree(359.9), qtty::Degree(-5.0)}, // RA wrap
+      {qtty::Degree(0.0), qtty::Degree(89.5)},   // pole
+  };
+  for (const auto &c : centers) {
+    const auto hits = index.cone(c, qtty::Degree(6.0));
+    EXPECT_EQ(indices(hits), brute_cone(cat, c, 6.0));
+    for (std::size_t i = 1; i < hits.size(); ++i) {
+      EXPECT_LE(hits[i - 1].separation.value(), hits[i].separation.value());
+    }
+    for (const auto &h : hits) {
+      EXPECT_NEAR(h.separation.value(), cat[h.index].angular_separation(c).value(), 1e-9);
+    }
+  }
+
+  EXPECT_EQ(index.cone(centers[0], qtty::Degree(180.0)).size(), cat.size());
+}
+
+TEST(DirectionIndex, NearestMatchesBruteForce) {
+  const auto cat = catalog(3000);
+  const DirectionIndex<frames::ICRS> index(cat, DirectionIndexOptions().with_leaf_size(4));
+  const spherical::Direction<frames::ICRS> c(qtty::Degree(123.4), qtty::Degree(-33.3));
+
+  std::vector<std::pair<double, std::size_t>> brute;
+  for (std::size_t i = 0; i < cat.size(); ++i)
+    brute.emplace_back(cat[i].angular_separation(c).value(), i);
+  std::sort(brute.begin(), brute.end());
+
+  const auto knn = index.nearest(c, 10);
+  ASSERT_EQ(knn.size(), 10u);
+  for (std::size_t i = 0; i < knn.size(); ++i) {
+    EXPECT_EQ(knn[i].index, brute[i].second);
+    EXPECT_NEAR(knn[i].separation.value(), brute[i].first, 1e-9);
+  }
+
+  EXPECT_EQ(index.nearest(c, cat.size() + 5).size(), cat.size());
+  EXPECT_TRUE(DirectionIndex<frames::ICRS>().nearest(c, 3).empty());
+}
+
+TEST(DirectionIndex, ParallelBuildAndCrossMatchAreDeterministic) {
+  const auto cat = catalog(20000);
+  const DirectionIndex<frames::ICRS> serial(cat);
+  const DirectionIndex<frames::ICRS> parallel(cat, DirectionIndexOptions().with_parallelism(4));
+
+  // Queries: every 97th catalog entry nudged by a few arcseconds.
+  std::vector<spherical::Direction<frames::ICRS>> queries;
+  for (std::size_t i = 0; i < cat.size(); i += 97) {
+    queries.emplace_back(qtty::Degree(cat[i].ra().value() + 0.001),
+                         qtty::Degree(cat[i].dec().value()));
+  }
+
+  const qtty::Degree radius(0.01);
+  const auto a = serial.cross_match(queries, radius);
+  const auto b = parallel.cross_match(queries, radius, 3);
+  ASSERT_EQ(a.size(), b.size());
+  ASSERT_GE(a.size(), queries.size());
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    EXPECT_EQ(a[i].query, b[i].query);
+    EXPECT_EQ(a[i].index, b[i].index);
+    EXPECT_LE(a[i].separation.value(), radius.value());
+  }
+}
+
+TEST(DirectionIndex, CartesianInputAndOptionsValidation) {
+  std::vector<cartesian::Direction<frames::ICRS>> unit = {
+      {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  const DirectionIndex<frames::ICRS> index(unit);
+  const auto hit = index.nearest(cartesian::Direction<frames::ICRS>(0.0, 0.1, 0.995), 1);
+  ASSERT_EQ(hit.size(), 1u);
+  EXPECT_EQ(hit[0].index, 2u);
+
+  EXPECT_THROW(DirectionIndex<frames::ICRS>(unit, DirectionIndexOptions().with_leaf_size(0)),
+               InvalidArgumentError);
+}
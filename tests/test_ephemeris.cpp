@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <gtest/gtest.h>
 #include <siderust/siderust.hpp>
@@ -45,6 +46,246 @@ TEST(Ephemeris, MoonGeocentric) {
   EXPECT_NEAR(r, 384400.0, 25000.0);
 }
 
+TEST(Ephemeris, SeriesMatchesPerEpoch) {
+  std::vector<Time<TT, JD>> jd;
+  for (int i = 0; i < 97; ++i)
+    jd.push_back(Time<TT, JD>(2451545.0 + 37.25 * i));
+
+  std::vector<cartesian::position::EclipticMeanJ2000<qtty::AstronomicalUnit>> mars(jd.size());
+  ephemeris::mars_heliocentric(jd, mars);
+  cartesian::PositionArray<centers::Geocentric, frames::EclipticMeanJ2000, qtty::Kilometer> moon;
+  ephemeris::moon_geocentric(jd, moon, 4);
+  ASSERT_EQ(moon.size(), jd.size());
+
+  for (std::size_t i = 0; i < jd.size(); ++i) {
+    const auto m = ephemeris::mars_heliocentric(jd[i]);
+    EXPECT_DOUBLE_EQ(mars[i].x().value(), m.x().value());
+    EXPECT_DOUBLE_EQ(mars[i].y().value(), m.y().value());
+    EXPECT_DOUBLE_EQ(mars[i].z().value(), m.z().value());
+    const auto l = ephemeris::moon_geocentric(jd[i]);
+    EXPECT_DOUBLE_EQ(moon.x()[i], l.x().value());
+    EXPECT_DOUBLE_EQ(moon.y()[i], l.y().value());
+    EXPECT_DOUBLE_EQ(moon.z()[i], l.z().value());
+  }
+}
+
+TEST(Ephemeris, SeriesParallelMatchesSerial) {
+  std::vector<Time<TT, JD>> jd;
+  for (int i = 0; i < 365; ++i)
+    jd.push_back(Time<TT, JD>(2460000.5 + i));
+
+  cartesian::PositionArray<centers::Barycentric, frames::EclipticMeanJ2000,
+                           qtty::AstronomicalUnit>
+      serial, parallel;
+  static_assert(std::is_same_v<decltype(serial), ephemeris::BarycentricPositions>);
+  ephemeris::jupiter_barycentric(jd, serial);
+  ephemeris::jupiter_barycentric(jd, parallel, 0);
+  ASSERT_EQ(parallel.size(), serial.size());
+  for (std::size_t i = 0; i < jd.size(); ++i) {
+    EXPECT_EQ(parallel.x()[i], serial.x()[i]);
+    EXPECT_EQ(parallel.y()[i], serial.y()[i]);
+    EXPECT_EQ(parallel.z()[i], serial.z()[i]);
+  }
+}
+
+TEST(Ephemeris, SeriesSizeMismatchThrows) {
+  std::vector<Time<TT, JD>> jd(3, Time<TT, JD>::J2000());
+  std::vector<cartesian::position::HelioBarycentric<qtty::AstronomicalUnit>> out(2);
+  EXPECT_THROW(ephemeris::sun_barycentric(jd, out), InvalidDimensionError);
+}
+
+// ============================================================================
+// Snapshot
+// ============================================================================
+
+TEST(EphemerisSnapshot, MatchesPerBodyFunctions) {
+  const Time<TT, JD> jd(2460800.5);
+  const auto sky = ephemeris::snapshot(jd);
+  EXPECT_FALSE(sky.has_velocities());
+  ASSERT_EQ(sky.states().size(), ephemeris::Snapshot::bodies().size());
+
+  const auto mars = ephemeris::mars_heliocentric(jd);
+  EXPECT_DOUBLE_EQ(sky[Body::Mars].heliocentric.x().value(), mars.x().value());
+  EXPECT_DOUBLE_EQ(sky[Body::Mars].heliocentric.z().value(), mars.z().value());
+
+  // Barycentric positions are heliocentric + the Sun's offset.
+  const auto jup = ephemeris::jupiter_barycentric(jd);
+  EXPECT_NEAR(sky[Body::Jupiter].barycentric.x().value(), jup.x().value(), 1e-4);
+  EXPECT_NEAR(sky[Body::Jupiter].barycentric.y().value(), jup.y().value(), 1e-4);
+  const auto sun = ephemeris::sun_barycentric(jd);
+  EXPECT_DOUBLE_EQ(sky[Body::Sun].barycentric.x().value(), sun.x().value());
+
+  // Geocentric Moon comes straight from ELP2000.
+  const auto moon = ephemeris::moon_geocentric(jd);
+  EXPECT_NEAR(sky[Body::Moon].geocentric.x().to<qtty::Kilometer>().value(), moon.x().value(),
+              1e-3);
+  EXPECT_NEAR(sky.earth().geocentric.x().value(), 0.0, 1e-15);
+}
+
+TEST(EphemerisSnapshot, Velocities) {
+  const auto sky = ephemeris::snapshot(Time<TT, JD>(2460800.5), true);
+  ASSERT_TRUE(sky.has_velocities());
+
+  const auto speed = [](const CartesianVelocity &v) {
+    return std::sqrt(v.vx * v.vx + v.vy * v.vy + v.vz * v.vz);
+  };
+  EXPECT_NEAR(speed(sky.earth().heliocentric_velocity), 0.0172, 0.0005); // ~29.8 km/s
+  EXPECT_NEAR(speed(sky[Body::Moon].geocentric_velocity), 5.9e-4, 0.4e-4); // ~1.02 km/s
+  EXPECT_NEAR(speed(sky[Body::Sun].heliocentric_velocity), 0.0, 1e-15);
+}
+
+TEST(EphemerisSnapshot, HorizontalMatchesBodyTargets) {
+  const Time<TT, JD> jd(2460800.5 + 0.9);
+  const Time<TT, MJD> mjd(jd.value() - 2400000.5);
+  const auto site = ROQUE_DE_LOS_MUCHACHOS();
+  const auto sky = ephemeris::snapshot(jd);
+
+  std::vector<BodyTarget> targets;
+  for (Body b : {Body::Sun, Body::Moon, Body::Mars, Body::Jupiter, Body::Saturn})
+    targets.emplace_back(b);
+  std::vector<spherical::Direction<frames::Horizontal>> altaz(targets.size());
+  horizontal_at(targets, site, sky, altaz);
+
+  // Apparent places: light-time and annual aberration are applied, so the
+  // snapshot agrees with the FFI to the arcsecond.
+  const double tol = 1.0 / 3600.0;
+  for (std::size_t i = 0; i < targets.size(); ++i) {
+    const double alt = targets[i].altitude_at(site, mjd).value();
+    EXPECT_NEAR(altaz[i].polar().value(), alt, tol) << targets[i].name();
+    EXPECT_NEAR(std::remainder(altaz[i].azimuth().value() -
+                                   targets[i].azimuth_at(site, mjd).value(),
+                               360.0),
+                0.0, tol / std::cos(alt * constants::pi / 180.0))
+        << targets[i].name();
+  }
+
+  // The Moon's topocentric altitude agrees with the FFI's moon::altitude_at.
+  const auto moon_alt = moon::altitude_at(site, mjd).to<qtty::Degree>().value();
+  EXPECT_NEAR(altaz[1].polar().value(), moon_alt, tol);
+
+  // Snapshot velocities and the backward difference give the same places.
+  const auto moving = horizontal_at(ephemeris::Snapshot::bodies(), site,
+                                    ephemeris::snapshot(jd, true));
+  const auto still = horizontal_at(ephemeris::Snapshot::bodies(), site, sky);
+  for (std::size_t i = 0; i < moving.size(); ++i) {
+    EXPECT_NEAR(moving[i].polar().value(), still[i].polar().value(), 0.01 / 3600.0);
+    EXPECT_NEAR(std::remainder(moving[i].azimuth().value() - still[i].azimuth().value(), 360.0),
+                0.0, 0.01 / 3600.0 / std::cos(moving[i].polar().value() * constants::pi / 180.0));
+  }
+}
+
+TEST(EphemerisSnapshot, MoonIncludesDiurnalParallax) {
+  const Time<TT, JD> jd(2460800.5);
+  const Time<TT, MJD> mjd(jd.value() - 2400000.5);
+  const auto site = ROQUE_DE_LOS_MUCHACHOS();
+  const auto sky = ephemeris::snapshot(jd);
+
+  const Body moon[] = {Body::Moon};
+  const auto topo = horizontal_at(moon, site, sky)[0];
+  const std::vector<spherical::direction::ICRS> dir = {sky.icrs_direction(Body::Moon)};
+  const auto geo = horizontal_at(dir, site, mjd)[0];
+
+  // Parallax in altitude ≈ horizontal parallax (0.90°–1.01°) × cos(alt).
+  const double cos_alt = std::cos(topo.polar().value() * constants::pi / 180.0);
+  const double parallax = geo.polar().value() - topo.polar().value();
+  EXPECT_GT(parallax, 0.85 * cos_alt);
+  EXPECT_LT(parallax, 1.05 * cos_alt);
+}
+
+// ============================================================================
+// EphemerisCache
+// ============================================================================
+
+TEST(EphemerisCache, MatchesSeriesWithinTolerance) {
+  const Time<TT, JD> start(2460800.5), end(2460860.5);
+  const Body bodies[] = {Body::Sun, Body::Moon, Body::Mars};
+  const EphemerisCache cache(bodies, start, end);
+
+  const double au_km = qtty::AstronomicalUnit(1.0).to<qtty::Kilometer>().value();
+  const double tol_km = cache.tolerance().value() * 10.0; // check points bound the fit error
+  for (Body b : bodies) {
+    EXPECT_LE(cache.fit_error(b).value(), cache.tolerance().value()) << BodyTarget(b).name();
+  }
+
+  for (int i = 0; i <= 60; ++i) {
+    const Time<TT, JD> jd(start.value() + i * 0.987);
+    const auto earth = ephemeris::earth_heliocentric(jd);
+    const auto mars = ephemeris::mars_heliocentric(jd);
+    const auto moon = ephemeris::moon_geocentric(jd);
+
+    const auto sun_c = cache.geocentric(Body::Sun, jd);
+    EXPECT_NEAR(sun_c.x().value() * au_km, -earth.x().value() * au_km, tol_km);
+    EXPECT_NEAR(sun_c.z().value() * au_km, -earth.z().value() * au_km, tol_km);
+
+    const auto mars_c = cache.geocentric(Body::Mars, jd);
+    EXPECT_NEAR(mars_c.y().value() * au_km, (mars.y().value() - earth.y().value()) * au_km, tol_km);
+
+    const auto moon_c = cache.geocentric(Body::Moon, jd);
+    EXPECT_NEAR(moon_c.x().value() * au_km, moon.x().value(), tol_km);
+    EXPECT_NEAR(moon_c.y().value() * au_km, moon.y().value(), tol_km);
+  }
+}
+
+TEST(EphemerisCache, VelocityMatchesFiniteDifference) {
+  const Time<TT, JD> start(2460800.5), end(2460830.5);
+  const Body bodies[] = {Body::Moon};
+  const EphemerisCache cache(bodies, start, end);
+
+  const Time<TT, JD> jd(2460815.3);
+  const double h = 1e-3;
+  const auto lo = cache.geocentric(Body::Moon, Time<TT, JD>(jd.value() - h));
+  const auto hi = cache.geocentric(Body::Moon, Time<TT, JD>(jd.value() + h));
+  const auto v = cache.geocentric_velocity(Body::Moon, jd);
+  EXPECT_NEAR(v.vx, (hi.x().value() - lo.x().value()) / (2 * h), 1e-9);
+  EXPECT_NEAR(v.vy, (hi.y().value() - lo.y().value()) / (2 * h), 1e-9);
+  EXPECT_NEAR(v.vz, (hi.z().value() - lo.z().value()) / (2 * h), 1e-9);
+}
+
+TEST(EphemerisCache, Errors) {
+  const Time<TT, JD> start(2460800.5), end(2460810.5);
+  const Body sun[] = {Body::Sun};
+  const EphemerisCache cache(sun, start, end);
+
+  EXPECT_TRUE(cache.contains(Body::Sun));
+  EXPECT_FALSE(cache.contains(Body::Moon));
+  EXPECT_THROW(cache.geocentric(Body::Moon, start), InvalidArgumentError);
+  EXPECT_THROW(cache.geocentric(Body::Sun, Time<TT, JD>(end.value() + 1.0)), OutOfRangeError);
+  EXPECT_NO_THROW(cache.geocentric(Body::Sun, end));
+  EXPECT_THROW(EphemerisCache(sun, end, start), InvalidArgumentError);
+  EXPECT_GT(cache.bytes_per_year(), 0.0);
+}
+
+TEST(EphemerisCache, SegmentEndsWithinTolerance) {
+  const Time<TT, JD> start(2460800.5), end(2460830.5);
+  const Body moon[] = {Body::Moon};
+  const EphemerisCache cache(moon, start, end);
+  ASSERT_LE(cache.fit_error(Body::Moon).value(), cache.tolerance().value());
+
+  // Segment boundaries are where the fit is weakest; they are now checked.
+  const double len = cache.segment_length(Body::Moon).value();
+  const double au_km = qtty::AstronomicalUnit(1.0).to<qtty::Kilometer>().value();
+  for (double t = start.value(); t <= end.value() + 1e-9; t += len) {
+    const Time<TT, JD> jd(std::min(t, end.value()));
+    const auto c = cache.geocentric(Body::Moon, jd);
+    const auto m = ephemeris::moon_geocentric(jd);
+    const double dx = c.x().value() * au_km - m.x().value();
+    const double dy = c.y().value() * au_km - m.y().value();
+    const double dz = c.z().value() * au_km - m.z().value();
+    EXPECT_LE(std::sqrt(dx * dx + dy * dy + dz * dz), cache.tolerance().value()) << t;
+  }
+}
+
+TEST(EphemerisCache, UnmetToleranceThrows) {
+  const Time<TT, JD> start(2460800.5), end(2460830.5);
+  const Body moon[] = {Body::Moon};
+  const auto coarse = EphemerisCacheOptions().with_degree(4).with_max_refinements(0);
+  EXPECT_EQ(coarse.max_refinements, 0u);
+  EXPECT_THROW(EphemerisCache(moon, start, end, coarse), InvalidArgumentError);
+  auto loose = coarse;
+  loose.with_tolerance(qtty::Kilometer(1e5));
+  EXPECT_NO_THROW(EphemerisCache(moon, start, end, loose));
+}
+
 // ============================================================================
 // RuntimeEphemeris — type correctness and error handling
 // ============================================================================
@@ -62,6 +62,17 @@ TEST(Oem, ParseMinimalDocument) {
   EXPECT_GT(states[1].epoch_jd, states[0].epoch_jd);
 }
 
+TEST(Oem, ParseViewMatchesParse) {
+  const auto states = oem::parse(kMinimalOem);
+  const oem::StateVectorList view = oem::parse_view(kMinimalOem);
+  ASSERT_EQ(view.size(), states.size());
+  for (std::size_t i = 0; i < view.size(); ++i) {
+    EXPECT_DOUBLE_EQ(view[i].epoch_jd, states[i].epoch_jd);
+    EXPECT_DOUBLE_EQ(view[i].pos_km[0], states[i].pos_km[0]);
+    EXPECT_DOUBLE_EQ(view[i].vel_kms[1], states[i].vel_kms[1]);
+  }
+}
+
 TEST(Oem, ParseLisaSampleFromSubmodule) {
   const std::string doc = read_lisa_oem1();
   if (doc.empty()) {
@@ -4,6 +4,8 @@
 // Tests for the SkyGrid sampler mirrored from siderust::coordinates::SkyGrid.
 
 #include <cmath>
+#include <type_traits>
+#include <utility>
 
 #include <gtest/gtest.h>
 #include <siderust/siderust.hpp>
@@ -46,3 +48,34 @@ TEST(SkyGrid, AltRangeMaskReducesCells) {
   masked.with_alt_range(qtty::Degree(30.0), qtty::Degree(90.0));
   EXPECT_LT(masked.cells().size(), full.cells().size());
 }
+
+TEST(SkyGrid, CellsViewMatchesCells) {
+  auto grid = SkyGrid::with_steps(qtty::Degree(15.0), qtty::Degree(30.0));
+  const auto cells = grid.cells();
+  const SkyGridCellList view = grid.cells_view();
+  ASSERT_EQ(view.size(), cells.size());
+  EXPECT_EQ(grid.size(), cells.size());
+
+  std::size_t i = 0;
+  for (const auto cell : view) {
+    EXPECT_DOUBLE_EQ(cell.direction.alt().value(), cells[i].direction.alt().value());
+    EXPECT_DOUBLE_EQ(cell.direction.az().value(), cells[i].direction.az().value());
+    EXPECT_DOUBLE_EQ(view.raw()[i].solid_angle_sr, cells[i].solid_angle.value());
+    ++i;
+  }
+  EXPECT_EQ(view.end() - view.begin(), static_cast<std::ptrdiff_t>(cells.size()));
+}
+
+TEST(SkyGrid, CellsViewIsMoveOnly) {
+  SkyGridCellList a = SkyGrid::uniform(qtty::Degree(30.0)).cells_view();
+  const std::size_t n = a.size();
+  ASSERT_GT(n, 0u);
+
+  SkyGridCellList b = std::move(a);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), n);
+
+  b.reset();
+  EXPECT_TRUE(b.empty());
+  EXPECT_FALSE(std::is_copy_constructible<SkyGridCellList>::value);
+}
@@ -0,0 +1,785 @@
+// SPDX-License-Identifier: AGPL-3.0-or-later
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for the header-only SPK reader and the mapped RuntimeEphemeris mode,
+// against small synthetic DAF kernels written by the test itself.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <siderust/siderust.hpp>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+using namespace siderust;
+
+namespace {
+
+struct SyntheticSegment {
+  std::int32_t target;
+  std::int32_t center;
+  std::int32_t type; // 2 or 3
+  double init;       // first record start [s]
+  double interval;   // record length [s]
+  std::size_t records;
+  std::size_t ncoef;
+  // coefficient (record, component, k)
+  double (*coef)(std::size_t, std::size_t, std::size_t);
+  std::int32_t frame = spk::frame::J2000;
+};
+
+template <typename T> void put(std::vector<std::uint8_t> &buf, std::size_t off, T v, bool swap) {
+  std::uint8_t b[sizeof(T)];
+  std::memcpy(b, &v, sizeof(T));
+  if (swap)
+    std::reverse(b, b + sizeof(T));
+  std::memcpy(buf.data() + off, b, sizeof(T));
+}
+
+bool host_little() {
+  const std::uint16_t one = 1;
+  std::uint8_t first;
+  std::memcpy(&first, &one, 1);
+  return first == 1;
+}
+
+/// Serialise `segs` as a DAF/SPK file: file record, one summary record, one
+/// name record, then the segment data.
+std::vector<std::uint8_t> build_spk(const std::vector<SyntheticSegment> &segs,
+                                    bool big_endian = false) {
+  const bool swap = big_endian == host_little();
+  std::vector<std::uint8_t> buf(3 * 1024, 0);
+  std::memcpy(buf.data(), "DAF/SPK ", 8);
+  put<std::int32_t>(buf, 8, 2, swap);
+  put<std::int32_t>(buf, 12, 6, swap);
+  put<std::int32_t>(buf, 76, 2, swap);
+  put<std::int32_t>(buf, 80, 2, swap);
+  std::memcpy(buf.data() + 88, big_endian ? "BIG-IEEE" : "LTL-IEEE", 8);
+
+  const std::size_t summary = 1024;
+  put<double>(buf, summary, 0.0, swap);
+  put<double>(buf, summary + 8, 0.0, swap);
+  put<double>(buf, summary + 16, static_cast<double>(segs.size()), swap);
+
+  for (std::size_t i = 0; i < segs.size(); ++i) {
+    const auto &s = segs[i];
+    const std::size_t comps = s.type == 3 ? 6 : 3;
+    const std::size_t rsize = 2 + comps * s.ncoef;
+    const std::size_t begin = buf.size() / 8 + 1;
+    std::vector<double> words;
+    for (std::size_t r = 0; r < s.records; ++r) {
+      words.push_back(s.init + (static_cast<double>(r) + 0.5) * s.interval);
+      words.push_back(0.5 * s.interval);
+      for (std::size_t c = 0; c < comps; ++c) {
+        for (std::size_t k = 0; k < s.ncoef; ++k)
+          words.push_back(s.coef(r, c, k));
+      }
+    }
+    words.push_back(s.init);
+    words.push_back(s.interval);
+    words.push_back(static_cast<double>(rsize));
+    words.push_back(static_cast<double>(s.records));
+    const std::size_t end = begin + words.size() - 1;
+
+    const std::size_t off = buf.size();
+    buf.resize(off + words.size() * 8);
+    for (std::size_t w = 0; w < words.size(); ++w)
+      put<double>(buf, off + w * 8, words[w], swap);
+
+    const std::size_t sum = summary + 24 + i * 40;
+    put<double>(buf, sum, s.init, swap);
+    put<double>(buf, sum + 8, s.init + s.interval * static_cast<double>(s.records), swap);
+    put<std::int32_t>(buf, sum + 16, s.target, swap);
+    put<std::int32_t>(buf, sum + 20, s.center, swap);
+    put<std::int32_t>(buf, sum + 24, s.frame, swap);
+    put<std::int32_t>(buf, sum + 28, s.type, swap);
+    put<std::int32_t>(buf, sum + 32, static_cast<std::int32_t>(begin), swap);
+    put<std::int32_t>(buf, sum + 36, static_cast<std::int32_t>(end), swap);
+  }
+  return buf;
+}
+
+std::string write_temp(const std::string &name, const std::vector<std::uint8_t> &bytes) {
+  const std::string path = ::testing::TempDir() + name;
+  std::ofstream f(path, std::ios::binary);
+  f.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  return path;
+}
+
+double cheb(double x, std::size_t k) { return std::cos(static_cast<double>(k) * std::acos(x)); }
+
+double smooth(std::size_t r, std::size_t c, std::size_t k) {
+  return (k == 0 ? 1000.0 * static_cast<double>(c + 1) + static_cast<double>(r) : 0.0) +
+         (k > 0 ? 1.0 / static_cast<double>(k + c) : 0.0);
+}
+
+/// Expected value of component `c` from `smooth` at `et`.
+double expected(const SyntheticSegment &s, std::size_t c, double et) {
+  const auto r = static_cast<std::size_t>(std::floor((et - s.init) / s.interval));
+  const double mid = s.init + (static_cast<double>(r) + 0.5) * s.interval;
+  const double x = (et - mid) / (0.5 * s.interval);
+  double v = 0.0;
+  for (std::size_t k = 0; k < s.ncoef; ++k)
+    v += s.coef(r, c, k) * cheb(x, k);
+  return v;
+}
+
+const SyntheticSegment kEarth{399, 3, 2, -86400.0, 43200.0, 4, 5, smooth};
+
+/// Sun, EMB, Earth and Moon segments over J2000 ± 10 days with constant
+/// positions (km) plus a linear term on the EMB x axis, in NAIF `frame`.
+std::vector<std::uint8_t> planetary_kernel(std::int32_t frame = spk::frame::J2000) {
+  const auto emb = [](std::size_t, std::size_t c, std::size_t k) -> double {
+    return k == 0 ? 1.0e8 * static_cast<double>(c + 1) : (k == 1 && c == 0 ? 43200.0 : 0.0);
+  };
+  const auto earth = [](std::size_t, std::size_t c, std::size_t k) -> double {
+    return k == 0 ? 4000.0 * static_cast<double>(c + 1) : 0.0;
+  };
+  const auto moon = [](std::size_t, std::size_t c, std::size_t k) -> double {
+    return k == 0 ? -3.0e5 * static_cast<double>(c + 1) : 0.0;
+  };
+  const auto sun = [](std::size_t, std::size_t c, std::size_t k) -> double {
+    return k == 0 ? 5.0e5 * static_cast<double>(c == 0) : 0.0;
+  };
+  const double start = -10 * 86400.0;
+  return build_spk({{10, 0, 2, start, 86400.0, 20, 3, sun, frame},
+                    {3, 0, 2, start, 86400.0, 20, 3, emb, frame},
+                    {399, 3, 2, start, 86400.0, 20, 3, earth, frame},
+                    {301, 3, 2, start, 86400.0, 20, 3, moon, frame}});
+}
+
+#if defined(__linux__)
+/// Resident set size of this process in bytes, from /proc/self/statm.
+std::size_t process_rss() {
+  std::ifstream f("/proc/self/statm");
+  std::size_t pages = 0, resident = 0;
+  f >> pages >> resident;
+  return resident * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+}
+#endif
+
+} // namespace
+
+TEST(SpkKernel, ParsesSummariesAndEvaluatesType2) {
+  const auto bytes = build_spk({kEarth});
+  const spk::Kernel k(bytes.data(), bytes.size());
+
+  ASSERT_EQ(k.segments().size(), 1u);
+  const auto &seg = k.segments()[0];
+  EXPECT_EQ(seg.target, 399);
+  EXPECT_EQ(seg.center, 3);
+  EXPECT_EQ(seg.type, 2);
+  EXPECT_EQ(seg.record_count, 4u);
+  EXPECT_EQ(seg.coefficients(), 5u);
+
+  for (double et : {-86400.0, -50000.0, 0.0, 12345.6, 86000.0}) {
+    const auto st = k.state(399, 3, et);
+    for (std::size_t c = 0; c < 3; ++c)
+      EXPECT_NEAR(st.position[c], expected(kEarth, c, et), 1e-9);
+  }
+
+  // Velocity is the derivative of the position polynomial.
+  const double et = 1000.0, h = 1e-2;
+  const spk::State mid = k.state(399, 3, et);
+  const spk::State lo = k.state(399, 3, et - h);
+  const spk::State hi = k.state(399, 3, et + h);
+  for (std::size_t c = 0; c < 3; ++c)
+    EXPECT_NEAR(mid.velocity[c], (hi.position[c] - lo.position[c]) / (2 * h), 1e-9);
+}
+
+TEST(SpkKernel, BigEndianFileMatches) {
+  const auto little = build_spk({kEarth}, false);
+  const auto big = build_spk({kEarth}, true);
+  const spk::Kernel a(little.data(), little.size());
+  const spk::Kernel b(big.data(), big.size());
+  const auto sa = a.state(399, 3, 777.0);
+  const auto sb = b.state(399, 3, 777.0);
+  for (std::size_t c = 0; c < 3; ++c) {
+    EXPECT_DOUBLE_EQ(sa.position[c], sb.position[c]);
+    EXPECT_DOUBLE_EQ(sa.velocity[c], sb.velocity[c]);
+  }
+}
+
+TEST(SpkKernel, Type3UsesStoredVelocity) {
+  SyntheticSegment s = kEarth;
+  s.type = 3;
+  const auto bytes = build_spk({s});
+  const spk::Kernel k(bytes.data(), bytes.size());
+  const auto st = k.state(399, 3, 5000.0);
+  for (std::size_t c = 0; c < 3; ++c) {
+    EXPECT_NEAR(st.position[c], expected(s, c, 5000.0), 1e-9);
+    EXPECT_NEAR(st.velocity[c], expected(s, c + 3, 5000.0), 1e-9);
+  }
+}
+
+TEST(SpkKernel, MappedFileMatchesInMemory) {
+  const auto bytes = build_spk({kEarth});
+  const spk::Kernel mem(bytes.data(), bytes.size());
+  const spk::Kernel mapped(write_temp("siderust_spk_mapped.bsp", bytes));
+  EXPECT_EQ(mapped.mapped_bytes(), bytes.size());
+  const auto a = mem.state(399, 3, -4242.0);
+  const auto b = mapped.state(399, 3, -4242.0);
+  for (std::size_t c = 0; c < 3; ++c)
+    EXPECT_DOUBLE_EQ(a.position[c], b.position[c]);
+}
+
+TEST(SpkKernel, Errors) {
+  const auto bytes = build_spk({kEarth});
+  const spk::Kernel k(bytes.data(), bytes.size());
+  EXPECT_THROW(k.state(399, 3, 1e6), OutOfRangeError);
+  EXPECT_THROW(k.state(301, 3, 0.0), OutOfRangeError);
+
+  std::vector<std::uint8_t> junk(2048, 0);
+  EXPECT_THROW(spk::Kernel(junk.data(), junk.size()), DataLoadError);
+  EXPECT_THROW(spk::Kernel("/nonexistent/path/de440.bsp"), DataLoadError);
+}
+
+TEST(RuntimeEphemeris, MappedModeChainsSegments) {
+  const auto path = write_temp("siderust_runtime_mapped.bsp", planetary_kernel());
+
+  const RuntimeEphemeris eph(
+      path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+  ASSERT_TRUE(eph.is_mapped());
+  EXPECT_TRUE(static_cast<bool>(eph));
+  EXPECT_EQ(eph.kernel().segments().size(), 4u);
+
+  const Time<TT, JD> jd(2451545.25);
+  const auto norm = [](double x, double y, double z) { return std::sqrt(x * x + y * y + z * z); };
+  const double au = qtty::AstronomicalUnit(1.0).to<qtty::Kilometer>().value();
+
+  // Rotations preserve lengths, so compare norms of the chained vectors.
+  const auto m = eph.moon_geocentric(jd);
+  EXPECT_NEAR(norm(m.x().value(), m.y().value(), m.z().value()),
+              norm(-3.0e5 - 4000.0, -6.0e5 - 8000.0, -9.0e5 - 12000.0), 1e-6);
+
+  // J2000.25 is a quarter into its record, where the linear term is -21600 km.
+  const double emb_x = 1.0e8 - 21600.0;
+  const auto e = eph.earth_barycentric(jd);
+  EXPECT_NEAR(norm(e.x().value(), e.y().value(), e.z().value()) * au,
+              norm(emb_x + 4000.0, 2.0e8 + 8000.0, 3.0e8 + 12000.0), 1e-2);
+
+  const auto h = eph.earth_heliocentric(jd);
+  EXPECT_NEAR(norm(h.x().value(), h.y().value(), h.z().value()) * au,
+              norm(emb_x + 4000.0 - 5.0e5, 2.0e8 + 8000.0, 3.0e8 + 12000.0), 1e-2);
+
+  // d/dt of 43200 * T1((et - mid) / 43200) is 1 km/s along ICRF x.
+  const auto v = eph.earth_barycentric_velocity(jd);
+  EXPECT_NEAR(norm(v.vx, v.vy, v.vz), 86400.0 / au, 1e-12);
+}
+
+TEST(SpkKernel, SpanRestrictionClipsCoverage) {
+  const auto bytes = build_spk({kEarth});
+  const spk::Kernel full(bytes.data(), bytes.size());
+  const spk::Kernel k(bytes.data(), bytes.size(), spk::LoadOptions().with_span(-20000.0, 20000.0));
+
+  ASSERT_EQ(k.segments().size(), 1u);
+  EXPECT_EQ(k.segments()[0].record_count, 2u);
+  EXPECT_DOUBLE_EQ(k.segments()[0].start_et, -20000.0);
+  EXPECT_DOUBLE_EQ(k.segments()[0].end_et, 20000.0);
+  for (double et : {-20000.0, -1.0, 0.0, 19999.0}) {
+    const auto a = full.state(399, 3, et);
+    const auto b = k.state(399, 3, et);
+    for (std::size_t c = 0; c < 3; ++c)
+      EXPECT_DOUBLE_EQ(a.position[c], b.position[c]);
+  }
+  EXPECT_THROW(k.state(399, 3, 50000.0), OutOfRangeError);
+  EXPECT_THROW(k.state(399, 3, -20001.0), OutOfRangeError);
+  EXPECT_THROW(spk::Kernel(bytes.data(), bytes.size(), spk::LoadOptions().with_span(1.0, 0.0)),
+               InvalidArgumentError);
+}
+
+TEST(SpkKernel, TargetSubsetKeepsChain) {
+  const auto bytes = planetary_kernel();
+  const spk::Kernel k(bytes.data(), bytes.size(),
+                      spk::LoadOptions().with_targets({spk::naif::Moon}));
+  ASSERT_EQ(k.segments().size(), 2u); // 3 wrt 0 and 301 wrt 3
+  EXPECT_NE(k.find(spk::naif::Moon, spk::naif::EarthMoonBarycenter, 0.0), nullptr);
+  EXPECT_NE(k.find(spk::naif::EarthMoonBarycenter, spk::naif::SolarSystemBarycenter, 0.0),
+            nullptr);
+  EXPECT_THROW(k.state(spk::naif::Sun, spk::naif::SolarSystemBarycenter, 0.0), OutOfRangeError);
+}
+
+TEST(SpkKernel, ResidentCopyMatchesMapping) {
+  const auto big = build_spk({kEarth}, true);
+  const spk::Kernel mapped(big.data(), big.size());
+  const spk::Kernel resident(
+      big.data(), big.size(),
+      spk::LoadOptions().with_span(0.0, 86400.0).with_resident(true));
+
+  EXPECT_EQ(resident.storage(), spk::Storage::Resident);
+  // Records 2 and 3 (of 4) are retained: 2 × (2 + 3 × 5) doubles.
+  EXPECT_EQ(resident.resident_bytes(), 2u * 17u * sizeof(double));
+  for (double et : {0.0, 30000.0, 86000.0}) {
+    const auto a = mapped.state(399, 3, et);
+    const auto b = resident.state(399, 3, et);
+    for (std::size_t c = 0; c < 3; ++c) {
+      EXPECT_DOUBLE_EQ(a.position[c], b.position[c]);
+      EXPECT_DOUBLE_EQ(a.velocity[c], b.velocity[c]);
+    }
+  }
+}
+
+TEST(SpkKernel, PagedCacheStaysWithinBudget) {
+  const auto bytes = build_spk({kEarth});
+  const std::size_t record = 17 * sizeof(double);
+  const spk::Kernel mapped(bytes.data(), bytes.size());
+  const spk::Kernel paged(bytes.data(), bytes.size(),
+                          spk::LoadOptions().with_cache_bytes(2 * record));
+
+  EXPECT_EQ(paged.storage(), spk::Storage::Paged);
+  EXPECT_EQ(paged.resident_bytes(), 0u);
+  for (int pass = 0; pass < 2; ++pass) {
+    for (double et : {-80000.0, -30000.0, 10000.0, 60000.0}) {
+      const auto a = mapped.state(399, 3, et);
+      const auto b = paged.state(399, 3, et);
+      for (std::size_t c = 0; c < 3; ++c)
+        EXPECT_DOUBLE_EQ(a.position[c], b.position[c]);
+      EXPECT_LE(paged.resident_bytes(), 2 * record);
+    }
+  }
+  EXPECT_EQ(paged.resident_bytes(), 2 * record);
+}
+
+TEST(SpkKernel, PagedFileReadsMatchMapping) {
+  const auto path = write_temp("siderust_paged_big_endian.bsp", build_spk({kEarth}, true));
+  const spk::Kernel mapped(path);
+  const spk::Kernel paged(path, spk::LoadOptions().with_cache_bytes(17 * sizeof(double)));
+
+  EXPECT_EQ(paged.storage(), spk::Storage::Paged);
+  EXPECT_EQ(paged.mapped_bytes(), mapped.mapped_bytes());
+  for (double et : {-80000.0, -30000.0, 10000.0, 60000.0, -80000.0}) {
+    const auto a = mapped.state(399, 3, et);
+    const auto b = paged.state(399, 3, et);
+    for (std::size_t c = 0; c < 3; ++c) {
+      EXPECT_DOUBLE_EQ(a.position[c], b.position[c]);
+      EXPECT_DOUBLE_EQ(a.velocity[c], b.velocity[c]);
+    }
+  }
+}
+
+TEST(SpkKernel, PagedCacheConcurrentMissesMatchMapping) {
+  const auto path = write_temp("siderust_paged_threads.bsp", build_spk({kEarth}));
+  const std::size_t record = 17 * sizeof(double);
+  const spk::Kernel mapped(path);
+  const spk::Kernel paged(path, spk::LoadOptions().with_cache_bytes(2 * record));
+
+  // Threads miss on the same and on different records at once; each load
+  // runs outside the cache lock and only one copy of a record is kept.
+  constexpr std::size_t kThreads = 4;
+  std::vector<std::size_t> mismatches(kThreads, 0);
+  std::vector<std::thread> workers;
+  for (std::size_t w = 0; w < kThreads; ++w) {
+    workers.emplace_back([&, w] {
+      for (int i = 0; i < 400; ++i) {
+        const double et = -80000.0 + 400.0 * i + 3000.0 * static_cast<double>(w % 2);
+        if (paged.state(399, 3, et).position[0] != mapped.state(399, 3, et).position[0])
+          ++mismatches[w];
+      }
+    });
+  }
+  for (auto &t : workers)
+    t.join();
+  for (std::size_t w = 0; w < kThreads; ++w)
+    EXPECT_EQ(mismatches[w], 0u);
+  EXPECT_LE(paged.resident_bytes(), 2 * record);
+}
+
+TEST(SpkKernel, PagedFileResidencyStaysWithinBudget) {
+#if !defined(__linux__)
+  GTEST_SKIP() << "resident set size is read from /proc/self/statm";
+#else
+  constexpr std::size_t kRecords = 50000;
+  constexpr double kInterval = 3600.0;
+  const SyntheticSegment big{399, 3, 2, 0.0, kInterval, kRecords, 13, smooth};
+  std::string path;
+  std::size_t file_size = 0;
+  {
+    const auto bytes = build_spk({big});
+    file_size = bytes.size();
+    path = write_temp("siderust_paged_rss.bsp", bytes);
+  }
+  constexpr std::size_t kBudget = std::size_t{1} << 20;
+  ASSERT_GT(file_size, 8 * kBudget);
+
+  const auto scan = [&](const spk::Kernel &k) {
+    double sum = 0.0;
+    for (std::size_t r = 0; r < kRecords; ++r)
+      sum += k.state(399, 3, (static_cast<double>(r) + 0.5) * kInterval).position[0];
+    return sum;
+  };
+  const auto growth = [](std::size_t before) {
+    const std::size_t now = process_rss();
+    return now > before ? now - before : 0;
+  };
+
+  const std::size_t before = process_rss();
+  const spk::Kernel paged(path, spk::LoadOptions().with_cache_bytes(kBudget));
+  const double paged_sum = scan(paged);
+  EXPECT_LE(paged.resident_bytes(), kBudget);
+  // Budget plus per-entry bookkeeping and allocator slack; far below the file.
+  EXPECT_LT(growth(before), kBudget + (std::size_t{4} << 20));
+
+  // The same scan through the mapping leaves every touched page resident,
+  // which shows the measurement sees mapped pages at all.
+  const std::size_t mapped_before = process_rss();
+  const spk::Kernel mapped(path);
+  EXPECT_DOUBLE_EQ(scan(mapped), paged_sum);
+  EXPECT_GT(growth(mapped_before), file_size / 2);
+#endif
+}
+
+TEST(RuntimeEphemeris, PeriodRestrictedLoad) {
+  const auto path = write_temp("siderust_runtime_period.bsp", planetary_kernel());
+  const Time<TT, JD> jd(2451545.25);
+
+  const RuntimeEphemeris mapped(
+      path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+  const RuntimeEphemeris restricted(
+      path, RuntimeEphemerisOptions()
+                .with_period({Time<TT, JD>(2451544.5), Time<TT, JD>(2451546.5)})
+                .with_bodies({spk::naif::Earth, spk::naif::Moon})
+                .with_memory_budget(4096));
+
+  ASSERT_TRUE(restricted.has_kernel());
+  EXPECT_FALSE(restricted.is_mapped());
+  EXPECT_EQ(restricted.kernel().segments().size(), 3u);
+
+  const auto a = mapped.moon_geocentric(jd);
+  const auto b = restricted.moon_geocentric(jd);
+  EXPECT_DOUBLE_EQ(a.x().value(), b.x().value());
+  EXPECT_DOUBLE_EQ(a.z().value(), b.z().value());
+  EXPECT_LE(restricted.kernel().resident_bytes(), 4096u);
+
+  EXPECT_THROW(restricted.moon_geocentric(Time<TT, JD>(2451550.5)), OutOfRangeError);
+  EXPECT_THROW(restricted.sun_barycentric(jd), OutOfRangeError);
+}
+
+TEST(SpkKernel, ChainThroughCommonAncestor) {
+  const auto bytes = planetary_kernel();
+  const spk::Kernel k(bytes.data(), bytes.size());
+  const double et = 3600.0;
+
+  struct Link {
+    std::int32_t target, center;
+    double sign;
+  };
+  const auto sum = [&](std::initializer_list<Link> links) {
+    spk::State out{};
+    for (const Link &l : links) {
+      const auto s = k.state(*k.find(l.target, l.center, et), et);
+      for (std::size_t c = 0; c < 3; ++c) {
+        out.position[c] += l.sign * s.position[c];
+        out.velocity[c] += l.sign * s.velocity[c];
+      }
+    }
+    return out;
+  };
+  constexpr std::int32_t ssb = spk::naif::SolarSystemBarycenter;
+  constexpr std::int32_t emb = spk::naif::EarthMoonBarycenter;
+
+  // Moon wrt Sun: 301 → 3 → 0 ← 10.
+  const auto chain = k.chain(spk::naif::Moon, spk::naif::Sun);
+  EXPECT_EQ(chain.size(), 3u);
+  EXPECT_EQ(chain.frame(), spk::frame::J2000);
+  const auto a = k.state(chain, et);
+  const auto b = sum({{spk::naif::Moon, emb, 1.0}, {emb, ssb, 1.0}, {spk::naif::Sun, ssb, -1.0}});
+  for (std::size_t c = 0; c < 3; ++c) {
+    EXPECT_DOUBLE_EQ(a.position[c], b.position[c]);
+    EXPECT_DOUBLE_EQ(a.velocity[c], b.velocity[c]);
+  }
+
+  // EMB wrt Earth descends only: 3 ← 399.
+  EXPECT_EQ(k.chain(emb, spk::naif::Earth).size(), 1u);
+  const auto up = k.state(emb, spk::naif::Earth, et);
+  const auto earth = sum({{spk::naif::Earth, emb, 1.0}});
+  for (std::size_t c = 0; c < 3; ++c)
+    EXPECT_DOUBLE_EQ(up.position[c], -earth.position[c]);
+
+  EXPECT_EQ(k.chain(spk::naif::Earth, spk::naif::Earth).size(), 0u);
+  EXPECT_EQ(k.bodies().size(), 4u);
+  EXPECT_THROW(k.chain(spk::naif::Mars, spk::naif::Sun), OutOfRangeError);
+  EXPECT_THROW(k.state(chain, 1e7), OutOfRangeError);
+}
+
+TEST(SpkKernel, ChainRejectsMixedFrames) {
+  SyntheticSegment moon = kEarth;
+  moon.target = spk::naif::Moon;
+  moon.frame = spk::frame::EclipJ2000;
+  const auto bytes = build_spk({kEarth, moon});
+  const spk::Kernel k(bytes.data(), bytes.size());
+  EXPECT_EQ(k.chain(spk::naif::Moon, spk::naif::EarthMoonBarycenter).frame(),
+            spk::frame::EclipJ2000);
+  EXPECT_THROW(k.chain(spk::naif::Moon, spk::naif::Earth), InvalidArgumentError);
+
+  // Every candidate segment of a link counts, not only the last one: an
+  // ECLIPJ2000 Earth segment ahead of a J2000 one mixes frames even though
+  // the link's highest-precedence segment matches the Moon's.
+  SyntheticSegment early = kEarth;
+  early.frame = spk::frame::EclipJ2000;
+  SyntheticSegment moon_j2000 = kEarth;
+  moon_j2000.target = spk::naif::Moon;
+  const auto stacked = build_spk({early, kEarth, moon_j2000});
+  const spk::Kernel s(stacked.data(), stacked.size());
+  EXPECT_THROW(s.chain(spk::naif::Moon, spk::naif::Earth), InvalidArgumentError);
+  EXPECT_THROW(s.chain(spk::naif::Earth, spk::naif::EarthMoonBarycenter), InvalidArgumentError);
+  EXPECT_EQ(s.chain(spk::naif::Moon, spk::naif::EarthMoonBarycenter).frame(), spk::frame::J2000);
+}
+
+TEST(RuntimeEphemeris, EclipticKernelSkipsRotation) {
+  const auto path =
+      write_temp("siderust_runtime_eclip.bsp", planetary_kernel(spk::frame::EclipJ2000));
+  RuntimeEphemeris eph(path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+  const Time<TT, JD> jd(2451545.25);
+  const double au = qtty::AstronomicalUnit(1.0).to<qtty::Kilometer>().value();
+
+  // ECLIPJ2000 vectors are already in the target frame: no rotation.
+  const auto m = eph.moon_geocentric(jd);
+  EXPECT_NEAR(m.x().value(), -3.0e5 - 4000.0, 1e-6);
+  EXPECT_NEAR(m.y().value(), -6.0e5 - 8000.0, 1e-6);
+  EXPECT_NEAR(m.z().value(), -9.0e5 - 12000.0, 1e-6);
+
+  const auto h = eph.earth_heliocentric(jd);
+  EXPECT_NEAR(h.x().value() * au, 1.0e8 - 21600.0 + 4000.0 - 5.0e5, 1e-2);
+  EXPECT_NEAR(h.y().value() * au, 2.0e8 + 8000.0, 1e-2);
+  EXPECT_NEAR(h.z().value() * au, 3.0e8 + 12000.0, 1e-2);
+
+  const auto v = eph.earth_barycentric_velocity(jd);
+  EXPECT_NEAR(v.vx, 86400.0 / au, 1e-12);
+  EXPECT_NEAR(v.vy, 0.0, 1e-12);
+  EXPECT_NEAR(v.vz, 0.0, 1e-12);
+
+  const auto s = eph.sun_barycentric(jd);
+  const auto e = eph.earth_barycentric(jd);
+  const auto generic = eph.state(spk::naif::Earth, spk::naif::Sun, jd);
+  EXPECT_DOUBLE_EQ(generic.position.x().value(), h.x().value());
+  EXPECT_NEAR(e.x().value() - s.x().value(), h.x().value(), 1e-12);
+
+  auto reader = eph.reader();
+  const auto rm = reader.moon_geocentric(jd);
+  EXPECT_DOUBLE_EQ(rm.x().value(), m.x().value());
+  EXPECT_DOUBLE_EQ(rm.y().value(), m.y().value());
+  EXPECT_DOUBLE_EQ(rm.z().value(), m.z().value());
+  const auto rh = reader.earth_heliocentric(jd);
+  EXPECT_DOUBLE_EQ(rh.z().value(), h.z().value());
+
+  // A moved-from handle has no kernel to return.
+  const RuntimeEphemeris moved(std::move(eph));
+  EXPECT_EQ(moved.kernel().segments().size(), 4u);
+  EXPECT_FALSE(eph.has_kernel());
+  EXPECT_THROW(eph.kernel(), InvalidArgumentError);
+}
+
+TEST(RuntimeEphemeris, FfiLoadedKernelsAnswerState) {
+  const auto bytes = planetary_kernel();
+  const auto path = write_temp("siderust_runtime_ffi_state.bsp", bytes);
+  const RuntimeEphemeris mapped(
+      path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+  const Time<TT, JD> jd(2451545.25);
+  const auto expected = mapped.state(spk::naif::Moon, spk::naif::Sun, jd);
+
+  // The bytes constructor keeps its own copy of the records.
+  std::vector<std::uint8_t> scratch = bytes;
+  const RuntimeEphemeris from_bytes(scratch.data(), scratch.size());
+  std::fill(scratch.begin(), scratch.end(), std::uint8_t{0});
+  EXPECT_TRUE(from_bytes.has_kernel());
+
+  // The path constructors load through siderust-ffi and map the file for
+  // state() on first use.
+  const RuntimeEphemeris ffi(path);
+  EXPECT_FALSE(ffi.has_kernel());
+
+  for (const RuntimeEphemeris *eph : {&from_bytes, &ffi}) {
+    const auto s = eph->state(spk::naif::Moon, spk::naif::Sun, jd);
+    EXPECT_DOUBLE_EQ(s.position.x().value(), expected.position.x().value());
+    EXPECT_DOUBLE_EQ(s.velocity.vy, expected.velocity.vy);
+    auto reader = eph->reader();
+    const auto r = reader.state(spk::naif::Moon, spk::naif::Sun, jd);
+    EXPECT_DOUBLE_EQ(r.position.z().value(), expected.position.z().value());
+    EXPECT_EQ(eph->kernel().segments().size(), 4u);
+  }
+}
+
+TEST(RuntimeEphemeris, GenericStateMatchesNamedQueries) {
+  const auto path = write_temp("siderust_runtime_state.bsp", planetary_kernel());
+  const RuntimeEphemeris eph(
+      path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+  const Time<TT, JD> jd(2451545.25);
+
+  const auto earth = eph.state(spk::naif::Earth, spk::naif::SolarSystemBarycenter, jd);
+  const auto named = eph.earth_barycentric(jd);
+  EXPECT_DOUBLE_EQ(earth.position.x().value(), named.x().value());
+  EXPECT_DOUBLE_EQ(earth.position.y().value(), named.y().value());
+  EXPECT_DOUBLE_EQ(earth.position.z().value(), named.z().value());
+  const auto v = eph.earth_barycentric_velocity(jd);
+  EXPECT_NEAR(earth.velocity.vx, v.vx, 1e-15);
+  EXPECT_NEAR(earth.velocity.vy, v.vy, 1e-15);
+  EXPECT_NEAR(earth.velocity.vz, v.vz, 1e-15);
+
+  std::vector<Time<TT, JD>> days;
+  for (int i = 0; i < 16; ++i)
+    days.push_back(Time<TT, JD>(2451540.0 + 0.5 * i));
+  const auto series = eph.state(spk::naif::Moon, spk::naif::Sun, days, 0);
+  ASSERT_EQ(series.size(), days.size());
+  for (std::size_t i = 0; i < days.size(); ++i) {
+    const auto one = eph.state(spk::naif::Moon, spk::naif::Sun, days[i]);
+    EXPECT_DOUBLE_EQ(series[i].position.x().value(), one.position.x().value());
+    EXPECT_DOUBLE_EQ(series[i].velocity.vz, one.velocity.vz);
+  }
+
+  std::vector<EphemerisState> wrong(3);
+  EXPECT_THROW(eph.state(spk::naif::Moon, spk::naif::Sun, days, wrong), InvalidDimensionError);
+  EXPECT_THROW(eph.state(spk::naif::Mars, spk::naif::Sun, jd), OutOfRangeError);
+}
+
+TEST(SpkCursor, MatchesKernelOnMonotoneScan) {
+  const auto bytes = planetary_kernel();
+  const spk::Kernel k(bytes.data(), bytes.size());
+  const auto chain = k.chain(spk::naif::Moon, spk::naif::Sun);
+  spk::Cursor cursor(k);
+
+  std::size_t n = 0;
+  for (double et = -800000.0; et <= 800000.0; et += 3600.0, ++n) {
+    const auto a = k.state(chain, et);
+    const auto b = cursor.state(chain, et);
+    for (std::size_t c = 0; c < 3; ++c) {
+      EXPECT_DOUBLE_EQ(a.position[c], b.position[c]);
+      EXPECT_DOUBLE_EQ(a.velocity[c], b.velocity[c]);
+    }
+  }
+  // Three links, one miss per daily record each.
+  EXPECT_EQ(cursor.hits() + cursor.misses(), 3 * n);
+  EXPECT_LE(cursor.misses(), 3u * 20u);
+  EXPECT_THROW(cursor.state(chain, 1e7), OutOfRangeError);
+}
+
+TEST(SpkCursor, LaterSegmentTakesPrecedence) {
+  SyntheticSegment patch = kEarth;
+  patch.init = 0.0;
+  patch.records = 1;
+  patch.coef = [](std::size_t, std::size_t c, std::size_t k) -> double {
+    return k == 0 ? -50.0 * static_cast<double>(c + 1) : 0.0;
+  };
+  const auto bytes = build_spk({kEarth, patch});
+  const spk::Kernel k(bytes.data(), bytes.size());
+  const auto chain = k.chain(spk::naif::Earth, spk::naif::EarthMoonBarycenter);
+  spk::Cursor cursor(k);
+  for (double et : {-100.0, -1.0, 0.0, 100.0, 43200.0, 43300.0, 50000.0, 100.0}) {
+    const auto a = k.state(chain, et);
+    const auto b = cursor.state(chain, et);
+    EXPECT_DOUBLE_EQ(a.position[0], b.position[0]);
+  }
+  EXPECT_DOUBLE_EQ(cursor.state(chain, 100.0).position[0], -50.0);
+}
+
+TEST(RuntimeEphemeris, ReadersPerThreadMatchSharedQueries) {
+  const auto path = write_temp("siderust_runtime_reader.bsp", planetary_kernel());
+  const RuntimeEphemeris eph(
+      path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+
+  constexpr std::size_t kThreads = 4;
+  std::vector<std::size_t> mismatches(kThreads, 0), hits(kThreads, 0);
+  std::vector<std::thread> workers;
+  for (std::size_t w = 0; w < kThreads; ++w) {
+    workers.emplace_back([&, w] {
+      auto reader = eph.reader();
+      for (int i = 0; i < 200; ++i) {
+        const Time<TT, JD> jd(2451536.0 + 0.05 * i + 0.01 * static_cast<double>(w));
+        if (reader.moon_geocentric(jd).x().value() != eph.moon_geocentric(jd).x().value() ||
+            reader.earth_heliocentric(jd).y().value() !=
+                eph.earth_heliocentric(jd).y().value() ||
+            reader.sun_barycentric(jd).z().value() != eph.sun_barycentric(jd).z().value() ||
+            reader.state(spk::naif::Moon, spk::naif::Sun, jd).position.x().value() !=
+                eph.state(spk::naif::Moon, spk::naif::Sun, jd).position.x().value())
+          ++mismatches[w];
+      }
+      hits[w] = reader.hits();
+    });
+  }
+  for (auto &t : workers)
+    t.join();
+  for (std::size_t w = 0; w < kThreads; ++w) {
+    EXPECT_EQ(mismatches[w], 0u);
+    EXPECT_GT(hits[w], 0u);
+  }
+}
+
+TEST(RuntimeEphemeris, ProviderDrivesAltitudeSearches) {
+  const auto path = write_temp("siderust_runtime_search.bsp", planetary_kernel());
+  const RuntimeEphemeris eph(
+      path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+  const Geodetic site = ROQUE_DE_LOS_MUCHACHOS();
+  const Period<TT, MJD> window(Time<TT, MJD>(51539.5), Time<TT, MJD>(51549.5));
+
+  const auto events = sun::crossings(site, window, qtty::Degree(-6.0), eph);
+  ASSERT_GE(events.size(), 2u);
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    const auto alt = sun::altitude_at(site, events[i].time, eph).to<qtty::Degree>();
+    EXPECT_NEAR(alt.value(), -6.0, 1e-5);
+    if (i > 0)
+      EXPECT_NE(events[i].direction, events[i - 1].direction);
+  }
+
+  const auto below = sun::below_threshold(site, window, qtty::Degree(-6.0), eph);
+  ASSERT_FALSE(below.empty());
+  for (const auto &p : below) {
+    const Time<TT, MJD> mid(0.5 * (p.start().value() + p.end().value()));
+    EXPECT_LT(sun::altitude_at(site, mid, eph).to<qtty::Degree>().value(), -6.0);
+  }
+
+  SearchOptions opts;
+  opts.with_parallelism(3);
+  const auto parallel = moon::culminations(site, window, eph, opts);
+  const auto serial = moon::culminations(site, window, eph);
+  ASSERT_EQ(parallel.size(), serial.size());
+  for (std::size_t i = 0; i < serial.size(); ++i) {
+    EXPECT_NEAR(parallel[i].time.value(), serial[i].time.value(), 1e-6);
+    EXPECT_EQ(parallel[i].kind, serial[i].kind);
+  }
+
+  const Time<TT, MJD> outside(51560.0);
+  EXPECT_THROW(sun::altitude_at(site, outside, eph), OutOfRangeError);
+}
+
+TEST(RuntimeEphemeris, ProviderFindsEventsInEdgeIntervals) {
+  const auto path = write_temp("siderust_runtime_edges.bsp", planetary_kernel());
+  const RuntimeEphemeris eph(
+      path, RuntimeEphemerisOptions().with_mode(EphemerisLoadMode::Mapped));
+  const Geodetic site = ROQUE_DE_LOS_MUCHACHOS();
+  const Period<TT, MJD> days(Time<TT, MJD>(51541.0), Time<TT, MJD>(51543.0));
+  const auto all = sun::culminations(site, days, eph);
+  ASSERT_GE(all.size(), 2u);
+  const CulminationEvent top = all[0].kind == CulminationKind::Max ? all[0] : all[1];
+
+  // Ten minutes either side of the window ends: inside the first and last
+  // 30-minute sampling intervals.
+  const double t = top.time.value();
+  const double ten_minutes = 10.0 / 1440.0;
+  const Period<TT, MJD> after_start(Time<TT, MJD>(t - ten_minutes), Time<TT, MJD>(t + 0.3));
+  const Period<TT, MJD> before_end(Time<TT, MJD>(t - 0.3), Time<TT, MJD>(t + ten_minutes));
+  for (const auto &window : {after_start, before_end}) {
+    const auto found = sun::culminations(site, window, eph);
+    ASSERT_EQ(found.size(), 1u);
+    EXPECT_EQ(found[0].kind, CulminationKind::Max);
+    EXPECT_NEAR(found[0].time.value(), t, 1e-6);
+
+    // A threshold grazed just below the culmination is crossed twice
+    // inside the edge interval.
+    const qtty::Degree graze(top.altitude.value() - 0.02);
+    const auto events = sun::crossings(site, window, graze, eph);
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0].direction, CrossingDirection::Rising);
+    EXPECT_EQ(events[1].direction, CrossingDirection::Setting);
+    EXPECT_LT(events[0].time.value(), t);
+    EXPECT_GT(events[1].time.value(), t);
+    EXPECT_EQ(sun::above_threshold(site, window, graze, eph).size(), 1u);
+  }
+}
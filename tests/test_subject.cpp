@@ -71,6 +71,42 @@ TEST(SubjectTest, AltitudeAtTarget) {
   EXPECT_TRUE(std::isfinite(alt.value()));
 }
 
+// ── altitude_at (batch) ──────────────────────────────────────────────────────
+
+TEST(SubjectTest, AltitudeAtSpanMatchesPerCall) {
+  auto subj = Subject::body(Body::Sun);
+  std::vector<Time<TT, MJD>> grid;
+  for (int i = 0; i < 24; ++i) {
+    grid.push_back(Time<TT, MJD>(60000.0 + i / 24.0));
+  }
+  std::vector<qtty::Radian> out(grid.size());
+  altitude_at(subj, paris(), grid, out);
+  for (std::size_t i = 0; i < grid.size(); ++i) {
+    EXPECT_EQ(out[i].value(), altitude_at(subj, paris(), grid[i]).value());
+  }
+}
+
+TEST(SubjectTest, AltitudeAtGridMatchesSpan) {
+  auto subj = Subject::icrs(
+      spherical::Direction<frames::ICRS>(qtty::Degree(279.23), qtty::Degree(38.78)));
+  std::vector<Time<TT, MJD>> grid;
+  for (int i = 0; i < 10; ++i) {
+    grid.push_back(Time<TT, MJD>(60000.0 + i * 0.1));
+  }
+  auto from_span = altitude_at(subj, paris(), grid);
+  auto from_grid = altitude_at(subj, paris(), Time<TT, MJD>(60000.0), qtty::Day(0.1), grid.size());
+  ASSERT_EQ(from_span.size(), from_grid.size());
+  for (std::size_t i = 0; i < grid.size(); ++i) {
+    EXPECT_NEAR(from_span[i].value(), from_grid[i].value(), 1e-12);
+  }
+}
+
+TEST(SubjectTest, AltitudeAtSpanSizeMismatchThrows) {
+  std::vector<Time<TT, MJD>> grid(3, mid_day());
+  std::vector<qtty::Radian> out(2);
+  EXPECT_THROW(altitude_at(Subject::body(Body::Sun), paris(), grid, out), InvalidDimensionError);
+}
+
 // ── above_threshold ──────────────────────────────────────────────────────────
 
 TEST(SubjectTest, AboveThresholdBody) {
@@ -198,6 +234,90 @@ TEST(SubjectTest, InAzimuthRangeBody) {
   EXPECT_GT(periods.size(), 0u);
 }
 
+// ── Result sinks ─────────────────────────────────────────────────────────────
+
+TEST(SubjectTest, AboveThresholdBufferSinkMatchesVector) {
+  auto subj = Subject::body(Body::Sun);
+  auto expected = above_threshold(subj, paris(), one_day(), qtty::Degree(0));
+
+  std::vector<Period<TT, MJD>> buffer;
+  buffer.reserve(16);
+  above_threshold(subj, paris(), one_day(), qtty::Degree(0), buffer);
+  ASSERT_EQ(buffer.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_DOUBLE_EQ(buffer[i].start().value(), expected[i].start().value());
+    EXPECT_DOUBLE_EQ(buffer[i].end().value(), expected[i].end().value());
+  }
+
+  // A second query into the same buffer replaces its contents in place.
+  const auto *storage = buffer.data();
+  above_threshold(subj, paris(), one_day(), qtty::Degree(0), buffer);
+  EXPECT_EQ(buffer.size(), expected.size());
+  EXPECT_EQ(buffer.data(), storage);
+}
+
+TEST(SubjectTest, CrossingsCallbackSinkMatchesVector) {
+  auto subj = Subject::body(Body::Sun);
+  auto expected = crossings(subj, paris(), one_day(), qtty::Degree(0));
+
+  std::vector<CrossingEvent> seen;
+  crossings(subj, paris(), one_day(), qtty::Degree(0),
+            [&](const CrossingEvent &ev) { seen.push_back(ev); });
+  ASSERT_EQ(seen.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_DOUBLE_EQ(seen[i].time.value(), expected[i].time.value());
+    EXPECT_EQ(seen[i].direction, expected[i].direction);
+  }
+}
+
+TEST(SubjectTest, AzimuthSinksMatchVector) {
+  auto subj = Subject::body(Body::Sun);
+
+  std::size_t n_crossings = 0;
+  azimuth_crossings(subj, paris(), one_day(), qtty::Degree(180),
+                    [&](const AzimuthCrossingEvent &) { ++n_crossings; });
+  EXPECT_EQ(n_crossings, azimuth_crossings(subj, paris(), one_day(), qtty::Degree(180)).size());
+
+  std::vector<Period<TT, MJD>> ranges;
+  in_azimuth_range(subj, paris(), one_day(), qtty::Degree(90), qtty::Degree(270), ranges);
+  EXPECT_EQ(ranges.size(),
+            in_azimuth_range(subj, paris(), one_day(), qtty::Degree(90), qtty::Degree(270)).size());
+}
+
+// ── Zero-copy views ──────────────────────────────────────────────────────────
+
+TEST(SubjectTest, ViewsMatchVectorSearches) {
+  auto subj = Subject::body(Body::Sun);
+  const Period<TT, MJD> week(Time<TT, MJD>(60000.0), Time<TT, MJD>(60007.0));
+
+  const CrossingList crossings_list = crossings_view(subj, paris(), week, qtty::Degree(0));
+  const auto crossings_vec = crossings(subj, paris(), week, qtty::Degree(0));
+  ASSERT_EQ(crossings_list.size(), crossings_vec.size());
+  for (std::size_t i = 0; i < crossings_vec.size(); ++i) {
+    EXPECT_EQ(crossings_list[i].time.value(), crossings_vec[i].time.value());
+    EXPECT_EQ(crossings_list[i].direction, crossings_vec[i].direction);
+  }
+
+  const PeriodList above = above_threshold_view(subj, paris(), week, qtty::Degree(0));
+  const auto above_vec = above_threshold(subj, paris(), week, qtty::Degree(0));
+  ASSERT_EQ(above.size(), above_vec.size());
+  for (std::size_t i = 0; i < above_vec.size(); ++i) {
+    EXPECT_EQ(above[i].start().value(), above_vec[i].start().value());
+    EXPECT_EQ(above[i].end().value(), above_vec[i].end().value());
+  }
+
+  EXPECT_EQ(below_threshold_view(subj, paris(), week, qtty::Degree(0)).size(),
+            below_threshold(subj, paris(), week, qtty::Degree(0)).size());
+  EXPECT_EQ(culminations_view(subj, paris(), week).size(),
+            culminations(subj, paris(), week).size());
+  EXPECT_EQ(azimuth_crossings_view(subj, paris(), week, qtty::Degree(180)).size(),
+            azimuth_crossings(subj, paris(), week, qtty::Degree(180)).size());
+  EXPECT_EQ(azimuth_extrema_view(subj, paris(), week).size(),
+            azimuth_extrema(subj, paris(), week).size());
+
+  EXPECT_FALSE(std::is_copy_constructible<CrossingList>::value);
+}
+
 // ── Consistency: Subject vs old API ──────────────────────────────────────────
 
 TEST(SubjectTest, BodyAltitudeConsistency) {
@@ -217,6 +337,113 @@ TEST(SubjectTest, StarAltitudeConsistency) {
   EXPECT_DOUBLE_EQ(alt_subject.value(), alt_star.value());
 }
 
+// ── Station networks ─────────────────────────────────────────────────────────
+
+static std::vector<Geodetic> network() {
+  return {paris(), ROQUE_DE_LOS_MUCHACHOS(), EL_PARANAL()};
+}
+
+TEST(SubjectTest, AltitudeAtNetworkMatchesPerSite) {
+  auto subj = Subject::body(Body::Moon);
+  auto sites = network();
+  auto alts = altitude_at(subj, sites, mid_day());
+  ASSERT_EQ(alts.size(), sites.size());
+  for (std::size_t i = 0; i < sites.size(); ++i) {
+    EXPECT_EQ(alts[i].value(), altitude_at(subj, sites[i], mid_day()).value());
+  }
+}
+
+TEST(SubjectTest, AboveThresholdNetworkMatchesPerSite) {
+  auto subj = Subject::body(Body::Sun);
+  auto sites = network();
+  auto per_site = above_threshold(subj, sites, one_day(), qtty::Degree(0));
+  ASSERT_EQ(per_site.size(), sites.size());
+  for (std::size_t i = 0; i < sites.size(); ++i) {
+    auto expected = above_threshold(subj, sites[i], one_day(), qtty::Degree(0));
+    ASSERT_EQ(per_site[i].size(), expected.size());
+    for (std::size_t k = 0; k < expected.size(); ++k) {
+      EXPECT_EQ(per_site[i][k].start().value(), expected[k].start().value());
+      EXPECT_EQ(per_site[i][k].end().value(), expected[k].end().value());
+    }
+  }
+}
+
+TEST(SubjectTest, CrossingsNetworkMatchesPerSite) {
+  auto subj = Subject::body(Body::Sun);
+  auto sites = network();
+  auto per_site = crossings(subj, sites, one_day(), qtty::Degree(0));
+  ASSERT_EQ(per_site.size(), sites.size());
+  for (std::size_t i = 0; i < sites.size(); ++i) {
+    EXPECT_EQ(per_site[i].size(), crossings(subj, sites[i], one_day(), qtty::Degree(0)).size());
+  }
+}
+
+// ── horizontal_at (multi-subject snapshot) ──────────────────────────────────
+
+static double azimuth_diff_deg(double a, double b) {
+  double d = std::fmod(std::abs(a - b), 360.0);
+  return d > 180.0 ? 360.0 - d : d;
+}
+
+TEST(SubjectTest, HorizontalAtIcrsMatchesToHorizontal) {
+  std::vector<spherical::direction::ICRS> dirs;
+  for (int i = 0; i < 12; ++i) {
+    dirs.emplace_back(qtty::Degree(30.0 * i), qtty::Degree(-75.0 + 13.0 * i));
+  }
+  const Time<TT, JD> jd(mid_day().value() + 2400000.5);
+  auto altaz = horizontal_at(dirs, paris(), mid_day());
+  ASSERT_EQ(altaz.size(), dirs.size());
+  for (std::size_t i = 0; i < dirs.size(); ++i) {
+    const auto exact = dirs[i].to_horizontal(jd, paris());
+    EXPECT_NEAR(altaz[i].alt().value(), exact.alt().value(), 1e-9);
+    EXPECT_LT(azimuth_diff_deg(altaz[i].az().value(), exact.az().value()), 1e-9);
+
+    // The per-subject FFI path may add apparent-place corrections that the
+    // shared rotation leaves out; aberration bounds them to ≈20.5″.
+    auto subj = Subject::icrs(dirs[i]);
+    double alt_deg = altitude_at(subj, paris(), mid_day()).value() * 180.0 / constants::pi;
+    EXPECT_NEAR(altaz[i].alt().value(), alt_deg, 0.006);
+  }
+}
+
+TEST(SubjectTest, HorizontalAtMixedSubjects) {
+  Star vega = Star::catalog("VEGA");
+  const Star fixed = Star::create(
+      "Fixed", StellarProperties{qtty::LightYear(100.0), SolarMass{1.0}, SolarRadius{1.0},
+                                 SolarLuminosity{1.0}},
+      spherical::direction::ICRS(101.29_deg, -16.72_deg), Time<TT, JD>::J2000());
+  ASSERT_TRUE(fixed.fixed_position().has_value());
+  std::vector<Subject> subjects = {
+      Subject::body(Body::Sun), Subject::star(vega),
+      Subject::icrs(spherical::direction::ICRS(279.23_deg, 38.78_deg)), Subject::star(fixed)};
+  EXPECT_FALSE(subjects[1].fixed_direction().has_value());
+  EXPECT_TRUE(subjects[2].fixed_direction().has_value());
+  EXPECT_TRUE(subjects[3].fixed_direction().has_value());
+
+  // Every kind matches the per-subject queries, aberration included.
+  auto altaz = horizontal_at(subjects, paris(), mid_day());
+  ASSERT_EQ(altaz.size(), subjects.size());
+  for (std::size_t i = 0; i < subjects.size(); ++i) {
+    double alt_deg = altitude_at(subjects[i], paris(), mid_day()).value() * 180.0 / constants::pi;
+    EXPECT_NEAR(altaz[i].alt().value(), alt_deg, 1e-6);
+    EXPECT_NEAR(altaz[i].az().value(), azimuth_at(subjects[i], paris(), mid_day()).value(), 1e-5);
+  }
+
+  // The ICRS-direction overload stays geometric: it differs by aberration.
+  const auto icrs = horizontal_at(std::vector<spherical::direction::ICRS>{
+                                      spherical::direction::ICRS(279.23_deg, 38.78_deg)},
+                                  paris(), mid_day());
+  const double shift = std::abs(altaz[2].alt().value() - icrs[0].alt().value());
+  EXPECT_GT(shift, 0.0);
+  EXPECT_LT(shift, 20.6 / 3600.0);
+}
+
+TEST(SubjectTest, HorizontalAtSizeMismatchThrows) {
+  std::vector<Subject> subjects = {Subject::body(Body::Sun)};
+  std::vector<spherical::direction::Horizontal> out(2);
+  EXPECT_THROW(horizontal_at(subjects, paris(), mid_day(), out), InvalidDimensionError);
+}
+
 // ============================================================================
 // ProperMotionTarget
 // ============================================================================